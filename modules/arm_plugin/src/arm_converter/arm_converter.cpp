@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <unordered_set>
+
 #include <ie_algorithm.hpp>
 
+#include <arm_compute/runtime/OffsetLifetimeManager.h>
+#include <arm_compute/runtime/PoolManager.h>
+
 #include "arm_converter/arm_converter.hpp"
 #include "opset/opset.hpp"
 
@@ -42,8 +47,8 @@ std::size_t AxisCast(const std::size_t axis, const std::size_t shapeSize) {
     return shapeSize - axis - 1;
 }
 
-Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg) :
-    _model{model}, _cfg{cfg} {
+Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg, SharedWeights* sharedWeights) :
+    _cfg{cfg}, _model{model}, _sharedWeights{sharedWeights} {
     Register<opset::Parameter>();
     Register<opset::Constant>();
     Register<opset::ArmConvolution>();
@@ -191,26 +196,35 @@ Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configu
             auto sourceOutput = input.get_source_output();
             layer._inputs.emplace(input, &(_layers.at(sourceOutput.get_node()->get_instance_id())._outputs.at(sourceOutput)));
         }
-        if (!ngraph::op::is_output(node)) {
-            for (auto&& output : node->outputs()) {
-                std::unique_ptr<arm_compute::Tensor> tensor(new arm_compute::Tensor);
-                auto tensorShape = ShapeCast(output.get_partial_shape().get_max_shape());
-                auto outputDataType = output.get_element_type();
-                auto quantizedOutput = (outputDataType == ngraph::element::u8 || outputDataType == ngraph::element::i8);
-                arm_compute::TensorInfo tensorInfo;
-                if (quantizedOutput && _cfg._lpt) {
-                    arm_compute::DataType dataType;
-                    switch (outputDataType) {
-                        case ngraph::element::Type_t::u8 : dataType = arm_compute::DataType::QASYMM8; break;
-                        case ngraph::element::Type_t::i8 : dataType = arm_compute::DataType::QASYMM8_SIGNED; break;
-                        default: IE_THROW() << "Arm Plugin: Unsupported Data Type: " << outputDataType << " " << *node;
-                    }
-                    tensorInfo = {tensorShape, 1, dataType, arm_compute::QuantizationInfo{1, 0}};
-                } else {
-                    tensorInfo = {tensorShape, 1, DataTypeCast(output.get_element_type())};
+        auto makeTensor = [&] (const ngraph::Output<ngraph::Node>& output) {
+            auto tensor = std::make_shared<arm_compute::Tensor>();
+            auto tensorShape = ShapeCast(output.get_partial_shape().get_max_shape());
+            auto outputDataType = output.get_element_type();
+            auto quantizedOutput = (outputDataType == ngraph::element::u8 || outputDataType == ngraph::element::i8);
+            arm_compute::TensorInfo tensorInfo;
+            if (quantizedOutput && _cfg._lpt) {
+                arm_compute::DataType dataType;
+                switch (outputDataType) {
+                    case ngraph::element::Type_t::u8 : dataType = arm_compute::DataType::QASYMM8; break;
+                    case ngraph::element::Type_t::i8 : dataType = arm_compute::DataType::QASYMM8_SIGNED; break;
+                    default: IE_THROW() << "Arm Plugin: Unsupported Data Type: " << outputDataType << " " << *node;
                 }
-                tensor->allocator()->init(tensorInfo);
-                layer._outputs.emplace(output, Tensor{std::move(tensor)});
+                tensorInfo = {tensorShape, 1, dataType, arm_compute::QuantizationInfo{1, 0}};
+            } else {
+                tensorInfo = {tensorShape, 1, DataTypeCast(output.get_element_type())};
+            }
+            tensor->allocator()->init(tensorInfo);
+            return tensor;
+        };
+        if (_sharedWeights != nullptr && ngraph::op::is_constant(node)) {
+            auto& tensor = _sharedWeights->_constants[node->get_instance_id()];
+            if (tensor == nullptr) {
+                tensor = makeTensor(node->output(0));
+            }
+            layer._outputs.emplace(node->output(0), Tensor{tensor});
+        } else if (!ngraph::op::is_output(node)) {
+            for (auto&& output : node->outputs()) {
+                layer._outputs.emplace(output, Tensor{makeTensor(output)});
             }
         }
     }
@@ -228,31 +242,37 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
     if (!unsupported.empty()) {
         IE_THROW() << "Arm Plugin: Nodes from " << _model->get_friendly_name() << " are not supported by plugin:\n" << unsupported;
     }
-    for (const auto& node : orderedOps) {
-        Conversion::Ptr conversion;
-        try {
-            conversion = _conversions.at(node->get_type_info())(*node);
-        } catch(std::exception& e) {
-            unsupported += ("\t" + node->get_friendly_name() +
-                " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + e.what() + ";\n");
-        }
-        if (conversion != nullptr) {
-            auto status = conversion->Validate();
-            if (status.error_code() != arm_compute::ErrorCode::OK) {
+    // Validation doesn't depend on infer request, so it is done once if weights are shared
+    if ((_sharedWeights == nullptr) || !_sharedWeights->_prepared) {
+        for (const auto& node : orderedOps) {
+            Conversion::Ptr conversion;
+            try {
+                conversion = _conversions.at(node->get_type_info())(*node);
+            } catch(std::exception& e) {
                 unsupported += ("\t" + node->get_friendly_name() +
-                    " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + status.error_description() + ";\n");
+                    " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + e.what() + ";\n");
+            }
+            if (conversion != nullptr) {
+                auto status = conversion->Validate();
+                if (status.error_code() != arm_compute::ErrorCode::OK) {
+                    unsupported += ("\t" + node->get_friendly_name() +
+                        " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + status.error_description() + ";\n");
+                }
             }
         }
-    }
-    if (!unsupported.empty()) {
-        IE_THROW() << "Arm Plugin: Nodes from " << _model->get_friendly_name() << " are not supported:\n" << unsupported;
+        if (!unsupported.empty()) {
+            IE_THROW() << "Arm Plugin: Nodes from " << _model->get_friendly_name() << " are not supported:\n" << unsupported;
+        }
     }
     std::map<ngraph::Output<ngraph::Node>, std::size_t> counter;
     for (auto&& node : orderedOps) {
         const auto& nodeID = node->get_instance_id();
         if (ngraph::op::is_constant(node)) {
             auto constNode = safe_cast<opset::Constant>(node);
-            _layers.at(nodeID)._outputs.begin()->second._tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            auto& tensor = _layers.at(nodeID)._outputs.begin()->second._tensor;
+            if (tensor->buffer() == nullptr) {
+                tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            }
         } else if (!ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
             auto conversion = _conversions.at(node->get_type_info())(*node);
             for (auto&& output : node->outputs()) {
@@ -295,6 +315,40 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
     return std::move(_layers);
 }
 
+void SharedWeights::Prepare(const std::shared_ptr<const ov::Model>& model, const Configuration& cfg) {
+    _memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(
+        std::make_shared<arm_compute::OffsetLifetimeManager>(), std::make_shared<arm_compute::PoolManager>());
+    _memoryGroup = std::make_unique<arm_compute::MemoryGroup>(_memoryManager);
+    _prototype = Converter{model, cfg, this}.Configure(_memoryManager, *_memoryGroup);
+    _memoryManager->populate(_allocator, 1);
+    // Only functions which transform weights through the weights manager are prepared. They are kept
+    // as the weights manager refers to transformations they own and to tensors of their inputs,
+    // the rest of the prototype is released
+    std::unordered_set<std::size_t> kept;
+    {
+        arm_compute::MemoryGroupResourceScope scope{*_memoryGroup};
+        for (auto&& layer : _prototype) {
+            if ((layer.second._function != nullptr) && layer.second._weightsManaged) {
+                layer.second._function->prepare();
+                kept.emplace(layer.first);
+                for (auto&& input : layer.second._inputs) {
+                    kept.emplace(input.first.get_source_output().get_node()->get_instance_id());
+                }
+            }
+        }
+    }
+    for (auto itLayer = _prototype.begin(); itLayer != _prototype.end();) {
+        if (contains(kept, itLayer->first)) {
+            ++itLayer;
+        } else {
+            itLayer = _prototype.erase(itLayer);
+        }
+    }
+    // Intermediate tensors of the prototype are not used after preparation
+    _memoryManager->clear();
+    _prepared = true;
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Parameter& node) {
     return {};
 }
@@ -9,9 +9,15 @@
 #include <ie_algorithm.hpp>
 #include <ngraph/function.hpp>
 
+#include <arm_compute/runtime/Allocator.h>
 #include <arm_compute/runtime/IFunction.h>
+#include <arm_compute/runtime/IWeightsManager.h>
+#include <arm_compute/runtime/MemoryGroup.h>
+#include <arm_compute/runtime/MemoryManagerOnDemand.h>
 #include <arm_compute/runtime/Tensor.h>
 
+#include <mutex>
+
 #include "arm_config.hpp"
 #include "opset/opset.hpp"
 
@@ -69,7 +75,7 @@ struct Output : ngraph::Output<ngraph::Node> {
 };
 
 struct Tensor {
-    std::unique_ptr<arm_compute::Tensor>    _tensor;
+    std::shared_ptr<arm_compute::Tensor>    _tensor;
     std::unique_ptr<arm_compute::Tensor>    _notPaddedTensor;
 };
 
@@ -140,6 +146,33 @@ struct Layer {
     std::map<Input, Tensor*>                    _inputs;
     std::map<Output, Tensor>                    _outputs;
     std::string                                 _execType;
+    // The function transforms its weights through the shared weights manager
+    bool                                        _weightsManaged = false;
+};
+
+/**
+ * @brief Weights of an executable network which are shared by all its infer requests.
+ * Tensors of constants are created once. Weights transformed by Arm Compute functions which accept
+ * a weights manager, e.g. reshaped for GEMM, are transformed once by functions of the prototype
+ * layers and are reused by infer requests. Only the prototype layers which own the transformations
+ * and the layers producing their inputs live as long as the executable network.
+ */
+struct SharedWeights {
+    using Ptr = std::shared_ptr<SharedWeights>;
+    /**
+     * Configures and prepares the prototype layers, should be called once before infer requests are configured
+     */
+    void Prepare(const std::shared_ptr<const ov::Model>& model, const Configuration& cfg);
+
+    // Guards configuration and preparation of functions which use shared weights
+    std::mutex                                                              _mutex;
+    arm_compute::IWeightsManager                                            _weightsManager;
+    std::unordered_map<std::size_t, std::shared_ptr<arm_compute::Tensor>>   _constants;
+    arm_compute::Allocator                                                  _allocator;
+    std::shared_ptr<arm_compute::MemoryManagerOnDemand>                     _memoryManager;
+    std::unique_ptr<arm_compute::MemoryGroup>                               _memoryGroup;
+    Layer::Map                                                              _prototype;
+    bool                                                                    _prepared = false;
 };
 
 static std::size_t GetNodeId(const ngraph::Input<const ngraph::Node>& input) {
@@ -155,19 +188,29 @@ static std::size_t GetNodeId(const std::vector<ngraph::Output<const ngraph::Node
     return outputs.front().get_node()->get_instance_id();
 }
 
-template<typename ACFunction, bool Flag>
+template<typename ACFunction, bool Flag, bool WeightsManaged>
 struct MakeFunction;
 
 template<typename ACFunction>
-struct MakeFunction<ACFunction, true> {
-    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager) {
+struct MakeFunction<ACFunction, true, true> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                     arm_compute::IWeightsManager* weightsManager) {
+        return std::make_unique<ACFunction>(memoryManager, weightsManager);
+    }
+};
+
+template<typename ACFunction>
+struct MakeFunction<ACFunction, true, false> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                     arm_compute::IWeightsManager*) {
         return std::make_unique<ACFunction>(memoryManager);
     }
 };
 
 template<typename ACFunction>
-struct MakeFunction<ACFunction, false> {
-    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>&) {
+struct MakeFunction<ACFunction, false, false> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>&,
+                     arm_compute::IWeightsManager*) {
         return std::make_unique<ACFunction>();
     }
 };
@@ -213,10 +256,15 @@ struct Converter {
 
         template<std::size_t... I>
         void ConfigureImpl(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager, std::index_sequence<I...>) {
+            constexpr bool weightsManaged =
+                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>, arm_compute::IWeightsManager*>::value;
             auto function = MakeFunction<ACFunction,
-                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>>::value>::Make(memoryManager);
+                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>>::value,
+                weightsManaged>::Make(memoryManager, _converter.GetWeightsManager());
             function->configure(MakeConversionArg(std::get<I>(_args))...);
-            _converter._layers.at(GetNodeId(std::get<0>(_args)))._function = std::move(function);
+            auto& layer = _converter._layers.at(GetNodeId(std::get<0>(_args)));
+            layer._function = std::move(function);
+            layer._weightsManaged = weightsManaged && (_converter.GetWeightsManager() != nullptr);
         }
         void Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager) override {
             ConfigureImpl(memoryManager, std::make_index_sequence<sizeof...(Args)>{});
@@ -400,7 +448,11 @@ struct Converter {
         return std::make_unique<ConversionCallableImpl<Callable, Args...>>(*this, std::forward<Callable>(callable), std::forward<Args>(args)...);
     }
 
-    Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg);
+    Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg, SharedWeights* sharedWeights = nullptr);
+
+    arm_compute::IWeightsManager* GetWeightsManager() {
+        return _sharedWeights == nullptr ? nullptr : &(_sharedWeights->_weightsManager);
+    }
 
     Layer::Map Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
                          arm_compute::MemoryGroup& memoryGroup);
@@ -409,6 +461,7 @@ struct Converter {
     Conversion::Ptr Convert(const NodeType& node);
 
     using ConvertFn = std::function<Conversion::Ptr(const ngraph::Node&)>;
+    using MakeNodeFn = std::function<std::shared_ptr<ngraph::Node>()>;
     template<typename NodeType>
     void Register() {
         _conversions.emplace(NodeType::get_type_info_static(), [this] (const ngraph::Node& node) {
@@ -417,11 +470,17 @@ struct Converter {
                 " current type_info: ", NodeType::get_type_info_static());
             return Convert(static_cast<const NodeType&>(node));
         });
+        _makeNodes.emplace(NodeType::get_type_info_static(), [] {
+            return std::make_shared<NodeType>();
+        });
     }
 
     const Configuration                             _cfg;
     std::map<ngraph::Node::type_info_t, ConvertFn>  _conversions;
+    // Creates nodes of supported types to be filled by attribute visitors, e.g. on network import
+    std::map<ngraph::Node::type_info_t, MakeNodeFn> _makeNodes;
     std::shared_ptr<const ov::Model>                _model;
+    SharedWeights*                                  _sharedWeights;
     Layer::Map                                      _layers;
 };
 
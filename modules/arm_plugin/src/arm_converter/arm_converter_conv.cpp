@@ -6,6 +6,8 @@
 #include <src/cpu/kernels/CpuConvertQuantizedSignednessKernel.h>
 #include <arm_compute/runtime/NEON/NEScheduler.h>
 #include <arm_compute/runtime/NEON/functions/NEConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h>
 #include <arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h>
 #include "arm_converter/arm_converter.hpp"
 
@@ -37,11 +39,13 @@ static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& no
 
 struct NEConvolutionLayerQI final: public arm_compute::IFunction {
 public:
-    NEConvolutionLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+    NEConvolutionLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr,
+                         arm_compute::IWeightsManager* weights_manager = nullptr):
         _memory_manager(memory_manager), _memory_group{std::make_unique<arm_compute::MemoryGroup>(memory_manager)},
+        _weights_manager(weights_manager),
         _i_sgn(nullptr), _w_sgn(nullptr), _conv(nullptr),
         _input(nullptr), _ip(nullptr), _inputqi(),
-        _weights(nullptr), _wp(nullptr), _weightsqi(),
+        _weights(nullptr), _wp(nullptr), _weightsqi(), _w_copy(false), _is_prepared(false),
         _output(nullptr), _qi(nullptr), _outputqi() {}
     NEConvolutionLayerQI(const NEConvolutionLayerQI &) = delete;
     NEConvolutionLayerQI &operator=(const NEConvolutionLayerQI &) = delete;
@@ -104,8 +108,28 @@ public:
             _outputqi.info()->set_quantization_info(*qi);
         }
 
-        _conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
-        _conv->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output, conv_info, weights_info, dilation, act_info);
+        // Weights reshaped by GEMM and Winograd convolutions are shared by infer requests through the weights manager,
+        // if the function reads the weights tensor directly
+        auto weights_manager = (conv_weights == _weights) ? _weights_manager : nullptr;
+        auto conv_output = _qi ? &_outputqi : _output;
+        switch (arm_compute::NEConvolutionLayer::get_convolution_method(conv_input->info(), conv_weights->info(), conv_output->info(),
+                                                                        conv_info, weights_info, dilation, act_info)) {
+            case arm_compute::ConvolutionMethod::GEMM: {
+                auto conv = std::make_unique<arm_compute::NEGEMMConvolutionLayer>(_memory_manager, weights_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, weights_info, dilation, act_info);
+                _conv = std::move(conv);
+            } break;
+            case arm_compute::ConvolutionMethod::WINOGRAD: {
+                auto conv = std::make_unique<arm_compute::NEWinogradConvolutionLayer>(_memory_manager, weights_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, act_info);
+                _conv = std::move(conv);
+            } break;
+            default: {
+                auto conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, weights_info, dilation, act_info);
+                _conv = std::move(conv);
+            } break;
+        }
 
         if (_i_sgn) {
             _inputqi.allocator()->allocate();
@@ -116,8 +140,14 @@ public:
         if (_w_sgn) {
             _weightsqi.allocator()->allocate();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
-            //Backpropagate possible weights padding change
-            _weights->info()->extend_padding(_weightsqi.info()->padding());
+            if (_weights->info()->is_resizable()) {
+                //Backpropagate possible weights padding change
+                _weights->info()->extend_padding(_weightsqi.info()->padding());
+            } else {
+                // Constants are shared by infer requests and are never changed, so padded weights are copied once
+                _weightsqi.allocator()->allocate();
+                _w_copy = true;
+            }
         }
     }
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
@@ -156,8 +186,18 @@ public:
 
         return arm_compute::NEConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, weights_info, dilation, act_info);
     }
+    void prepare() override {
+        if (!_is_prepared) {
+            if (_w_copy) _weightsqi.copy_from(*_weights);
+            // Imported weights are available only in run()
+            if (_w_copy || (!_wp && !_w_sgn)) _conv->prepare();
+            if (_w_copy && !_weightsqi.is_used()) _weightsqi.allocator()->free();
+            _is_prepared = true;
+        }
+    }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_conv.get(), "Kernel didn't configured");
+        prepare();
         std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
@@ -176,7 +216,7 @@ public:
                 { arm_compute::TensorType::ACL_DST, &_weightsqi }
             };
             arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        } else if (_wp && !_w_copy) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
@@ -186,24 +226,27 @@ public:
         }
         _conv->run();
         if (!_i_sgn && _ip) _inputqi.allocator()->free();
-        if (_wp) _weightsqi.allocator()->free();
+        if (_wp && !_w_copy) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
 
 protected:
     std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
     std::unique_ptr<arm_compute::MemoryGroup> _memory_group;
+    arm_compute::IWeightsManager *_weights_manager;
     const arm_compute::QuantizationInfo *_ip;
     arm_compute::ITensor *_input;
     arm_compute::Tensor _inputqi;
     const arm_compute::QuantizationInfo *_wp;
     const arm_compute::ITensor *_weights;
     arm_compute::Tensor _weightsqi;
+    bool _w_copy;
+    bool _is_prepared;
     const arm_compute::QuantizationInfo *_qi;
     arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
     std::unique_ptr<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel> _i_sgn, _w_sgn;
-    std::unique_ptr<arm_compute::NEConvolutionLayer> _conv;
+    std::unique_ptr<arm_compute::IFunction> _conv;
 };
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolution& node) {
     arm_compute::PadStrideInfo conv_info;
@@ -237,7 +280,7 @@ public:
         _memory_manager(memory_manager), _memory_group{std::make_unique<arm_compute::MemoryGroup>(memory_manager)},
         _i_sgn(nullptr), _w_sgn(nullptr), _conv(nullptr),
         _input(nullptr), _ip(nullptr), _inputqi(),
-        _weights(nullptr), _wp(nullptr), _weightsqi(),
+        _weights(nullptr), _wp(nullptr), _weightsqi(), _w_copy(false), _is_prepared(false),
         _output(nullptr), _qi(nullptr), _outputqi() {}
     NEDepthwiseConvolutionLayerQI(const NEDepthwiseConvolutionLayerQI &) = delete;
     NEDepthwiseConvolutionLayerQI &operator=(const NEDepthwiseConvolutionLayerQI &) = delete;
@@ -312,8 +355,14 @@ public:
         if (_w_sgn) {
             _weightsqi.allocator()->allocate();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
-            //Backpropagate possible weights padding change
-            _weights->info()->extend_padding(_weightsqi.info()->padding());
+            if (_weights->info()->is_resizable()) {
+                //Backpropagate possible weights padding change
+                _weights->info()->extend_padding(_weightsqi.info()->padding());
+            } else {
+                // Constants are shared by infer requests and are never changed, so padded weights are copied once
+                _weightsqi.allocator()->allocate();
+                _w_copy = true;
+            }
         }
     }
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
@@ -353,8 +402,18 @@ public:
         return arm_compute::NEDepthwiseConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output,
                                                                   conv_info, depth_multiplier, act_info, dilation);
     }
+    void prepare() override {
+        if (!_is_prepared) {
+            if (_w_copy) _weightsqi.copy_from(*_weights);
+            // Imported weights are available only in run()
+            if (_w_copy || (!_wp && !_w_sgn)) _conv->prepare();
+            if (_w_copy && !_weightsqi.is_used()) _weightsqi.allocator()->free();
+            _is_prepared = true;
+        }
+    }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_conv.get(), "Kernel didn't configured");
+        prepare();
         std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
@@ -373,7 +432,7 @@ public:
                 { arm_compute::TensorType::ACL_DST, &_weightsqi }
             };
             arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        } else if (_wp && !_w_copy) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
@@ -383,7 +442,7 @@ public:
         }
         _conv->run();
         if (!_i_sgn && _ip) _inputqi.allocator()->free();
-        if (_wp) _weightsqi.allocator()->free();
+        if (_wp && !_w_copy) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
 
@@ -396,6 +455,8 @@ protected:
     const arm_compute::QuantizationInfo *_wp;
     const arm_compute::ITensor *_weights;
     arm_compute::Tensor _weightsqi;
+    bool _w_copy;
+    bool _is_prepared;
     const arm_compute::QuantizationInfo *_qi;
     arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
@@ -407,12 +468,17 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmGroupCo
     arm_compute::Size2D dilation;
     std::tie(conv_info, dilation) = ConvParameters(node);
     auto ngraphWeightsShape = node.input(Weights).get_shape();
-    _layers.at(node.get_instance_id())._inputs.at(node.input(Weights))->_tensor->info()->set_tensor_shape(ShapeCast({
+    auto weightsShape = ShapeCast({
         ngraphWeightsShape[1],
         ngraphWeightsShape[0]*ngraphWeightsShape[2],
         ngraphWeightsShape[3],
         ngraphWeightsShape[4]
-    }));
+    });
+    auto weightsInfo = _layers.at(node.get_instance_id())._inputs.at(node.input(Weights))->_tensor->info();
+    // Constant weights may be shared with infer requests which are already running
+    if (weightsInfo->tensor_shape() != weightsShape) {
+        weightsInfo->set_tensor_shape(weightsShape);
+    }
 
     auto iInfoIt = node.get_rt_info().find("InputPrescaleInfo");
     const arm_compute::QuantizationInfo* iInfo = iInfoIt == node.get_rt_info().end() ? nullptr :
@@ -12,11 +12,13 @@ namespace ArmPlugin {
 enum InputArg {Features, Weights, Bias};
 struct NEFullyConnectedLayerQI final: public arm_compute::IFunction {
 public:
-    NEFullyConnectedLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+    NEFullyConnectedLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr,
+                            arm_compute::IWeightsManager* weights_manager = nullptr):
         _memory_manager(memory_manager), _memory_group{std::make_unique<arm_compute::MemoryGroup>(memory_manager)},
+        _weights_manager(weights_manager),
         _i_sgn(nullptr), _w_sgn(nullptr), _fconn(nullptr),
         _input(nullptr), _ip(nullptr), _inputqi(),
-        _weights(nullptr), _wp(nullptr), _weightsqi(),
+        _weights(nullptr), _wp(nullptr), _weightsqi(), _w_copy(false), _is_prepared(false),
         _output(nullptr), _qi(nullptr), _outputqi() {}
     NEFullyConnectedLayerQI(const NEFullyConnectedLayerQI &) = delete;
     NEFullyConnectedLayerQI &operator=(const NEFullyConnectedLayerQI &) = delete;
@@ -77,7 +79,8 @@ public:
             _outputqi.info()->set_quantization_info(*qi);
         }
 
-        _fconn = std::make_unique<arm_compute::NEFullyConnectedLayer>(_memory_manager);
+        // Reshaped weights are shared by infer requests through the weights manager, if the function reads the weights tensor directly
+        _fconn = std::make_unique<arm_compute::NEFullyConnectedLayer>(_memory_manager, (conv_weights == _weights) ? _weights_manager : nullptr);
         _fconn->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output);
 
         if (_i_sgn) {
@@ -89,8 +92,14 @@ public:
         if (_w_sgn) {
             _weightsqi.allocator()->allocate();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
-            //Backpropagate possible weights padding change
-            _weights->info()->extend_padding(_weightsqi.info()->padding());
+            if (_weights->info()->is_resizable()) {
+                //Backpropagate possible weights padding change
+                _weights->info()->extend_padding(_weightsqi.info()->padding());
+            } else {
+                // Constants are shared by infer requests and are never changed, so padded weights are copied once
+                _weightsqi.allocator()->allocate();
+                _w_copy = true;
+            }
         }
     }
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
@@ -127,8 +136,18 @@ public:
 
         return arm_compute::NEFullyConnectedLayer::validate(&vld_input, &vld_weights, biases, &vld_output);
     }
+    void prepare() override {
+        if (!_is_prepared) {
+            if (_w_copy) _weightsqi.copy_from(*_weights);
+            // Imported weights are available only in run()
+            if (_w_copy || (!_wp && !_w_sgn)) _fconn->prepare();
+            if (_w_copy && !_weightsqi.is_used()) _weightsqi.allocator()->free();
+            _is_prepared = true;
+        }
+    }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_fconn.get(), "Kernel didn't configured");
+        prepare();
         std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
@@ -147,7 +166,7 @@ public:
                 { arm_compute::TensorType::ACL_DST, &_weightsqi }
             };
             arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        } else if (_wp && !_w_copy) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
@@ -157,19 +176,22 @@ public:
         }
         _fconn->run();
         if (!_i_sgn && _ip) _inputqi.allocator()->free();
-        if (_wp) _weightsqi.allocator()->free();
+        if (_wp && !_w_copy) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
 
 protected:
     std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
     std::unique_ptr<arm_compute::MemoryGroup> _memory_group;
+    arm_compute::IWeightsManager *_weights_manager;
     const arm_compute::QuantizationInfo *_ip;
     arm_compute::ITensor *_input;
     arm_compute::Tensor _inputqi;
     const arm_compute::QuantizationInfo *_wp;
     const arm_compute::ITensor *_weights;
     arm_compute::Tensor _weightsqi;
+    bool _w_copy;
+    bool _is_prepared;
     const arm_compute::QuantizationInfo *_qi;
     arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
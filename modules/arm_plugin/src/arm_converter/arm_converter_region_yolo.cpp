@@ -3,23 +3,19 @@
 
 
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/region_yolo.hpp>
+#include "arm_converter/arm_detection_postprocessing.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::RegionYolo& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    static_cast<int>(node.get_num_coords()),
-                                    static_cast<int>(node.get_num_classes()),
-                                    static_cast<int>(node.get_num_regions()),
-                                    node.get_do_softmax(),
-                                    node.get_mask());
+    auto make = [&] (auto type) {
+        RegionYolo<decltype(type)> regionYolo{node.get_input_shape(0),
+                                              node.get_num_coords(),
+                                              node.get_num_classes(),
+                                              node.get_num_regions(),
+                                              node.get_do_softmax(),
+                                              node.get_mask()};
+        return this->MakeConversion(regionYolo, node.input(0), node.output(0));
     };
-    return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::region_yolo),
-        node.input(0), floatTypes);
+    return CallSwitch(make, node.input(0), floatTypes);
 }
 }  //  namespace ArmPlugin
@@ -2,10 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cmath>
+
+#include <ie_parallel.hpp>
+#include <arm_compute/core/Validate.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMM.h>
+#include <ngraph/op/util/op_types.hpp>
 #include <ngraph/runtime/reference/reverse_sequence.hpp>
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/sequences.hpp>
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace ArmPlugin {
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReverseSequence& node) {
@@ -24,6 +35,555 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReverseSeq
         node.input(1), indexTypes);
 }
 
+enum class RecurrentCell {LSTM, GRU, RNN};
+enum class RecurrentActivation {Sigmoid, Tanh, Relu};
+
+struct RecurrentSequenceInfo {
+    RecurrentCell                               cell;
+    std::vector<RecurrentActivation>            activations;
+    float                                       clip;
+    ngraph::op::RecurrentSequenceDirection      direction;
+    bool                                        linearBeforeReset;
+    // Packed weights are kept between runs if weights and recurrence weights are constants
+    bool                                        constantWeights;
+};
+
+namespace {
+struct ScalarOps {
+    using Type = float;
+    static Type Load(const float* ptr) {return *ptr;}
+    static void Store(float* ptr, Type value) {*ptr = value;}
+    static Type Dup(float value) {return value;}
+    static Type Add(Type l, Type r) {return l + r;}
+    static Type Sub(Type l, Type r) {return l - r;}
+    static Type Mul(Type l, Type r) {return l * r;}
+    static Type Clip(Type value, float clip) {
+        return clip > 0.f ? std::min(std::max(value, -clip), clip) : value;
+    }
+    static Type Activate(RecurrentActivation activation, Type value) {
+        switch (activation) {
+            case RecurrentActivation::Sigmoid : return 1.f / (1.f + std::exp(-value));
+            case RecurrentActivation::Tanh    : return std::tanh(value);
+            default                           : return std::max(value, 0.f);
+        }
+    }
+};
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+struct NeonOps {
+    using Type = float32x4_t;
+    static Type Load(const float* ptr) {return vld1q_f32(ptr);}
+    static void Store(float* ptr, Type value) {vst1q_f32(ptr, value);}
+    static Type Dup(float value) {return vdupq_n_f32(value);}
+    static Type Add(Type l, Type r) {return vaddq_f32(l, r);}
+    static Type Sub(Type l, Type r) {return vsubq_f32(l, r);}
+    static Type Mul(Type l, Type r) {return vmulq_f32(l, r);}
+    static Type Clip(Type value, float clip) {
+        return clip > 0.f ? vminq_f32(vmaxq_f32(value, vdupq_n_f32(-clip)), vdupq_n_f32(clip)) : value;
+    }
+    static Type Reciprocal(Type value) {
+#if defined(__aarch64__)
+        return vdivq_f32(vdupq_n_f32(1.f), value);
+#else
+        auto reciprocal = vrecpeq_f32(value);
+        reciprocal = vmulq_f32(vrecpsq_f32(value, reciprocal), reciprocal);
+        return vmulq_f32(vrecpsq_f32(value, reciprocal), reciprocal);
+#endif
+    }
+    // Polynomial approximation from Cephes library, arguments are clamped so 2^n stays a normal number
+    static Type Exp(Type value) {
+        auto x = vminq_f32(vmaxq_f32(value, vdupq_n_f32(-87.f)), vdupq_n_f32(88.f));
+        auto fx = vmlaq_f32(vdupq_n_f32(0.5f), x, vdupq_n_f32(1.44269504088896341f));
+        const auto truncated = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+        const auto greater = vcgtq_f32(truncated, fx);
+        fx = vsubq_f32(truncated, vreinterpretq_f32_u32(vandq_u32(greater, vreinterpretq_u32_f32(vdupq_n_f32(1.f)))));
+        x = vmlsq_f32(x, fx, vdupq_n_f32(0.693359375f));
+        x = vmlsq_f32(x, fx, vdupq_n_f32(-2.12194440e-4f));
+        auto y = vdupq_n_f32(1.9875691500e-4f);
+        y = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), y, x);
+        y = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), y, x);
+        y = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), y, x);
+        y = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), y, x);
+        y = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), y, x);
+        y = vaddq_f32(vmlaq_f32(x, y, vmulq_f32(x, x)), vdupq_n_f32(1.f));
+        const auto pow2n = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fx), vdupq_n_s32(127)), 23));
+        return vmulq_f32(y, pow2n);
+    }
+    static Type Activate(RecurrentActivation activation, Type value) {
+        const auto one = vdupq_n_f32(1.f);
+        switch (activation) {
+            case RecurrentActivation::Sigmoid :
+                return Reciprocal(vaddq_f32(one, Exp(vnegq_f32(value))));
+            case RecurrentActivation::Tanh    :
+                return vsubq_f32(one, vmulq_f32(vdupq_n_f32(2.f), Reciprocal(vaddq_f32(Exp(vaddq_f32(value, value)), one))));
+            default                           :
+                return vmaxq_f32(value, vdupq_n_f32(0.f));
+        }
+    }
+};
+#endif
+
+/**
+ * Calls @kernel with NEON operations for groups of 4 values of a row and with scalar operations for the rest
+ */
+template<typename Kernel>
+void ForEachLane(std::size_t size, Kernel&& kernel) {
+    std::size_t i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; i + 4 <= size; i += 4) {
+        kernel(NeonOps{}, i);
+    }
+#endif
+    for (; i < size; ++i) {
+        kernel(ScalarOps{}, i);
+    }
+}
+
+template<typename T = float>
+T* TensorData(const arm_compute::ITensor* tensor) {
+    return reinterpret_cast<T*>(tensor->buffer() + tensor->info()->offset_first_element_in_bytes());
+}
+
+float* TensorRow(const arm_compute::ITensor& tensor, std::size_t row) {
+    return reinterpret_cast<float*>(tensor.buffer() + tensor.info()->offset_first_element_in_bytes() +
+                                    row * tensor.info()->strides_in_bytes()[1]);
+}
+
+/**
+ * @brief Dense float data of a tensor which may be padded.
+ * Data of a padded tensor is copied row by row to a dense buffer on Map and back on Unmap
+ */
+class DenseTensor {
+public:
+    DenseTensor() = default;
+    explicit DenseTensor(const arm_compute::ITensor* tensor) : _tensor{tensor} {}
+
+    float* Map(bool read) {
+        if (_tensor == nullptr) {
+            return nullptr;
+        }
+        if (IsDense()) {
+            return TensorData(_tensor);
+        }
+        _copy.resize(_tensor->info()->tensor_shape().total_size());
+        if (read) {
+            ForEachRow([&] (std::uint8_t* row, float* dense, std::size_t rowSize) {
+                std::copy_n(reinterpret_cast<const float*>(row), rowSize, dense);
+            });
+        }
+        return _copy.data();
+    }
+
+    void Unmap() {
+        if ((_tensor != nullptr) && !IsDense()) {
+            ForEachRow([&] (std::uint8_t* row, const float* dense, std::size_t rowSize) {
+                std::copy_n(dense, rowSize, reinterpret_cast<float*>(row));
+            });
+        }
+    }
+
+private:
+    bool IsDense() const {
+        const auto& shape = _tensor->info()->tensor_shape();
+        const auto& strides = _tensor->info()->strides_in_bytes();
+        std::size_t stride = sizeof(float);
+        for (std::size_t i = 0; i < shape.num_dimensions(); ++i) {
+            if ((shape[i] > 1) && (strides[i] != stride)) {
+                return false;
+            }
+            stride *= shape[i];
+        }
+        return true;
+    }
+
+    template<typename Copy>
+    void ForEachRow(Copy&& copy) {
+        const auto& shape = _tensor->info()->tensor_shape();
+        const auto& strides = _tensor->info()->strides_in_bytes();
+        const std::size_t rowSize = shape[0];
+        const std::size_t numRows = shape.total_size_upper(1);
+        for (std::size_t row = 0; row < numRows; ++row) {
+            std::size_t offset = _tensor->info()->offset_first_element_in_bytes();
+            for (std::size_t i = 1, index = row; i < shape.num_dimensions(); index /= shape[i], ++i) {
+                offset += (index % shape[i]) * strides[i];
+            }
+            copy(_tensor->buffer() + offset, _copy.data() + row * rowSize, rowSize);
+        }
+    }
+
+    const arm_compute::ITensor*     _tensor = nullptr;
+    std::vector<float>              _copy;
+};
+}  // namespace
+
+/**
+ * @brief Executes LSTM, GRU and RNN sequences of all directions.
+ * Projection of inputs of all timesteps with weights of all directions is computed by one NEGEMM.
+ * Each timestep multiplies hidden states of all batches by recurrence weights with NEGEMM,
+ * then gate activations and state updates are computed in one pass with NEON.
+ * Weights are transposed into GEMM layout once if they are constants.
+ * Padded tensors are copied to dense buffers before execution and outputs are copied back after it.
+ */
+struct NERecurrentSequence final: public arm_compute::IFunction {
+public:
+    NERecurrentSequence(const std::shared_ptr<arm_compute::IMemoryManager>& memory_manager):
+        _memory_manager(memory_manager) {}
+    NERecurrentSequence(const NERecurrentSequence &) = delete;
+    NERecurrentSequence &operator=(const NERecurrentSequence &) = delete;
+    NERecurrentSequence(NERecurrentSequence &&) = delete;
+    NERecurrentSequence &operator=(NERecurrentSequence &&) = delete;
+    ~NERecurrentSequence() = default;
+
+    void configure(const arm_compute::ITensor* x, const arm_compute::ITensor* h, const arm_compute::ITensor* c,
+                   const arm_compute::ITensor* seqLengths, const arm_compute::ITensor* w, const arm_compute::ITensor* r,
+                   const arm_compute::ITensor* b, arm_compute::ITensor* y, arm_compute::ITensor* ho, arm_compute::ITensor* co,
+                   const RecurrentSequenceInfo& info) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(x, h, seqLengths, w, r, b, y, ho);
+        ARM_COMPUTE_ERROR_THROW_ON(NERecurrentSequence::validate(x->info(), h->info(), (c != nullptr) ? c->info() : nullptr,
+                                                                 seqLengths->info(), w->info(), r->info(), b->info(), y->info(),
+                                                                 ho->info(), (co != nullptr) ? co->info() : nullptr, info));
+        _x = DenseTensor{x}; _h = DenseTensor{h}; _c = DenseTensor{c}; _seqLengths = seqLengths;
+        _w = DenseTensor{w}; _r = DenseTensor{r}; _b = DenseTensor{b};
+        _y = DenseTensor{y}; _ho = DenseTensor{ho}; _co = DenseTensor{co};
+        _info = info;
+        _inputSize      = x->info()->dimension(0);
+        _seqLength      = x->info()->dimension(1);
+        _batch          = x->info()->dimension(2);
+        _hiddenSize     = r->info()->dimension(0);
+        _numGates       = w->info()->dimension(1) / _hiddenSize;
+        _numDirections  = w->info()->dimension(2);
+        _biasSize       = b->info()->dimension(0);
+        _lengths.resize(_batch);
+
+        const auto f32 = arm_compute::DataType::F32;
+        const auto gatesSize = _numGates * _hiddenSize;
+        const arm_compute::GEMMInfo gemmInfo{false, false, _info.constantWeights};
+        _input.allocator()->init({arm_compute::TensorShape(_inputSize, _batch * _seqLength), 1, f32});
+        _weights.allocator()->init({arm_compute::TensorShape(_numDirections * gatesSize, _inputSize), 1, f32});
+        _projection.allocator()->init({arm_compute::TensorShape(_numDirections * gatesSize, _batch * _seqLength), 1, f32});
+        _projectionGemm = std::make_unique<arm_compute::NEGEMM>(_memory_manager);
+        _projectionGemm->configure(&_input, &_weights, nullptr, &_projection, 1.f, 0.f, gemmInfo);
+        _weights.allocator()->allocate();
+        _projection.allocator()->allocate();
+
+        // GRU without linear_before_reset multiplies recurrence weights of the hidden gate by reset hidden state,
+        // so they are applied by a separate GEMM after the reset gate is computed
+        const auto resetGemm = (_info.cell == RecurrentCell::GRU) && !_info.linearBeforeReset;
+        const auto recurrentSize = resetGemm ? 2 * _hiddenSize : gatesSize;
+        for (std::size_t d = 0; d < _numDirections; ++d) {
+            auto direction = std::make_unique<Direction>();
+            direction->_recurrent.allocator()->init({arm_compute::TensorShape(recurrentSize, _hiddenSize), 1, f32});
+            direction->_hidden.allocator()->init({arm_compute::TensorShape(_hiddenSize, _batch), 1, f32});
+            direction->_gates.allocator()->init({arm_compute::TensorShape(recurrentSize, _batch), 1, f32});
+            direction->_gemm = std::make_unique<arm_compute::NEGEMM>(_memory_manager);
+            direction->_gemm->configure(&direction->_hidden, &direction->_recurrent, nullptr, &direction->_gates, 1.f, 0.f, gemmInfo);
+            direction->_recurrent.allocator()->allocate();
+            direction->_hidden.allocator()->allocate();
+            direction->_gates.allocator()->allocate();
+            if (resetGemm) {
+                direction->_resetRecurrent.allocator()->init({arm_compute::TensorShape(_hiddenSize, _hiddenSize), 1, f32});
+                direction->_resetHidden.allocator()->init({arm_compute::TensorShape(_hiddenSize, _batch), 1, f32});
+                direction->_resetGates.allocator()->init({arm_compute::TensorShape(_hiddenSize, _batch), 1, f32});
+                direction->_resetGemm = std::make_unique<arm_compute::NEGEMM>(_memory_manager);
+                direction->_resetGemm->configure(&direction->_resetHidden, &direction->_resetRecurrent, nullptr,
+                                                 &direction->_resetGates, 1.f, 0.f, gemmInfo);
+                direction->_resetRecurrent.allocator()->allocate();
+                direction->_resetHidden.allocator()->allocate();
+                direction->_resetGates.allocator()->allocate();
+            }
+            if (_info.cell == RecurrentCell::LSTM) {
+                direction->_cell.resize(_batch * _hiddenSize);
+            }
+            _directions.push_back(std::move(direction));
+        }
+    }
+
+    static arm_compute::Status validate(const arm_compute::ITensorInfo* x, const arm_compute::ITensorInfo* h, const arm_compute::ITensorInfo* c,
+                                        const arm_compute::ITensorInfo* seqLengths, const arm_compute::ITensorInfo* w,
+                                        const arm_compute::ITensorInfo* r, const arm_compute::ITensorInfo* b,
+                                        const arm_compute::ITensorInfo* y, const arm_compute::ITensorInfo* ho, const arm_compute::ITensorInfo* co,
+                                        const RecurrentSequenceInfo& info) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(x, h, seqLengths, w, r, b, y, ho);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(x, 1, arm_compute::DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(x, h, w, r, b, y, ho);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(seqLengths, 1, arm_compute::DataType::S32, arm_compute::DataType::S64);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((info.cell == RecurrentCell::LSTM) && ((c == nullptr) || (co == nullptr)),
+                                        "LSTM sequence requires cell state input and output");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.activations.size() < ((info.cell == RecurrentCell::LSTM) ? 3u :
+                                                                   (info.cell == RecurrentCell::GRU) ? 2u : 1u),
+                                        "Not enough activations");
+        return arm_compute::Status{};
+    }
+
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_projectionGemm.get(), "Kernel didn't configured");
+        if (!_isPrepared || !_info.constantWeights) {
+            PackWeights();
+            _isPrepared = true;
+        }
+        if (_seqLengths->info()->data_type() == arm_compute::DataType::S64) {
+            std::transform(TensorData<std::int64_t>(_seqLengths), TensorData<std::int64_t>(_seqLengths) + _batch, _lengths.begin(),
+                           [&] (std::int64_t length) {return std::min(static_cast<std::size_t>(std::max<std::int64_t>(length, 0)), _seqLength);});
+        } else {
+            std::transform(TensorData<std::int32_t>(_seqLengths), TensorData<std::int32_t>(_seqLengths) + _batch, _lengths.begin(),
+                           [&] (std::int32_t length) {return std::min(static_cast<std::size_t>(std::max<std::int32_t>(length, 0)), _seqLength);});
+        }
+        _input.allocator()->import_memory(_x.Map(true));
+        _projectionGemm->run();
+        _bias = _b.Map(true);
+        _hiddenState = _h.Map(true);
+        _cellState = _c.Map(true);
+        _output = _y.Map(false);
+        _hiddenOutput = _ho.Map(false);
+        _cellOutput = _co.Map(false);
+        for (std::size_t d = 0; d < _numDirections; ++d) {
+            RunDirection(d);
+        }
+        _y.Unmap();
+        _ho.Unmap();
+        _co.Unmap();
+        _input.allocator()->free();
+    }
+
+private:
+    struct Direction {
+        arm_compute::Tensor                     _recurrent;
+        arm_compute::Tensor                     _hidden;
+        arm_compute::Tensor                     _gates;
+        std::unique_ptr<arm_compute::NEGEMM>    _gemm;
+        arm_compute::Tensor                     _resetRecurrent;
+        arm_compute::Tensor                     _resetHidden;
+        arm_compute::Tensor                     _resetGates;
+        std::unique_ptr<arm_compute::NEGEMM>    _resetGemm;
+        std::vector<float>                      _cell;
+    };
+
+    void PackWeights() {
+        const auto gatesSize = _numGates * _hiddenSize;
+        const float* w = _w.Map(true);
+        for (std::size_t i = 0; i < _inputSize; ++i) {
+            float* row = TensorRow(_weights, i);
+            for (std::size_t j = 0; j < _numDirections * gatesSize; ++j) {
+                row[j] = w[j * _inputSize + i];
+            }
+        }
+        const float* r = _r.Map(true);
+        for (std::size_t d = 0; d < _numDirections; ++d) {
+            auto& direction = *_directions[d];
+            const float* recurrent = r + d * gatesSize * _hiddenSize;
+            const auto recurrentSize = direction._recurrent.info()->dimension(0);
+            for (std::size_t k = 0; k < _hiddenSize; ++k) {
+                float* row = TensorRow(direction._recurrent, k);
+                for (std::size_t j = 0; j < recurrentSize; ++j) {
+                    row[j] = recurrent[j * _hiddenSize + k];
+                }
+                if (direction._resetGemm) {
+                    float* resetRow = TensorRow(direction._resetRecurrent, k);
+                    for (std::size_t j = 0; j < _hiddenSize; ++j) {
+                        resetRow[j] = recurrent[(recurrentSize + j) * _hiddenSize + k];
+                    }
+                }
+            }
+        }
+    }
+
+    void RunDirection(std::size_t d) {
+        auto& direction = *_directions[d];
+        const auto reverse = (_info.direction == ngraph::op::RecurrentSequenceDirection::REVERSE) ||
+                             ((_info.direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL) && (d == 1));
+        const auto hiddenSize = _hiddenSize;
+        const auto gatesSize = _numGates * hiddenSize;
+        const auto projectionOffset = d * gatesSize;
+        const float* bias = _bias + d * _biasSize;
+        const float* h = _hiddenState;
+        const float* c = _cellState;
+        float* y = _output;
+        auto output = [&] (std::size_t batch, std::size_t time) {
+            return y + ((batch * _numDirections + d) * _seqLength + time) * hiddenSize;
+        };
+
+        for (std::size_t batch = 0; batch < _batch; ++batch) {
+            const auto stateOffset = (batch * _numDirections + d) * hiddenSize;
+            std::copy_n(h + stateOffset, hiddenSize, TensorRow(direction._hidden, batch));
+            if (_info.cell == RecurrentCell::LSTM) {
+                std::copy_n(c + stateOffset, hiddenSize, direction._cell.data() + batch * hiddenSize);
+            }
+            // Outputs of timesteps after the end of a sequence are zeros
+            for (std::size_t time = _lengths[batch]; time < _seqLength; ++time) {
+                std::fill_n(output(batch, time), hiddenSize, 0.f);
+            }
+        }
+
+        const auto maxLength = *std::max_element(_lengths.begin(), _lengths.end());
+        const auto clip = _info.clip;
+        const auto& activations = _info.activations;
+        for (std::size_t step = 0; step < maxLength; ++step) {
+            auto time = [&] (std::size_t batch) {
+                return reverse ? _lengths[batch] - 1 - step : step;
+            };
+            auto projection = [&] (std::size_t batch) {
+                return TensorRow(_projection, batch * _seqLength + time(batch)) + projectionOffset;
+            };
+            direction._gemm->run();
+            if (direction._resetGemm) {
+                InferenceEngine::parallel_for(_batch, [&] (std::size_t batch) {
+                    if (step >= _lengths[batch]) {
+                        return;
+                    }
+                    const float* xw = projection(batch);
+                    const float* hr = TensorRow(direction._gates, batch);
+                    const float* hidden = TensorRow(direction._hidden, batch);
+                    float* resetHidden = TensorRow(direction._resetHidden, batch);
+                    ForEachLane(hiddenSize, [&] (auto ops, std::size_t i) {
+                        using Ops = decltype(ops);
+                        const auto j = hiddenSize + i;
+                        auto reset = Ops::Add(Ops::Add(Ops::Load(xw + j), Ops::Load(hr + j)), Ops::Load(bias + j));
+                        reset = Ops::Activate(activations[0], Ops::Clip(reset, clip));
+                        Ops::Store(resetHidden + i, Ops::Mul(reset, Ops::Load(hidden + i)));
+                    });
+                });
+                direction._resetGemm->run();
+            }
+            InferenceEngine::parallel_for(_batch, [&] (std::size_t batch) {
+                if (step >= _lengths[batch]) {
+                    return;
+                }
+                const float* xw = projection(batch);
+                const float* hr = TensorRow(direction._gates, batch);
+                float* hidden = TensorRow(direction._hidden, batch);
+                float* out = output(batch, time(batch));
+                auto gate = [&] (auto ops, std::size_t index) {
+                    using Ops = decltype(ops);
+                    return Ops::Add(Ops::Add(Ops::Load(xw + index), Ops::Load(hr + index)), Ops::Load(bias + index));
+                };
+                switch (_info.cell) {
+                case RecurrentCell::LSTM : {
+                    // Gates order is f, i, c, o
+                    float* cell = direction._cell.data() + batch * hiddenSize;
+                    ForEachLane(hiddenSize, [&] (auto ops, std::size_t i) {
+                        using Ops = decltype(ops);
+                        const auto f = Ops::Activate(activations[0], Ops::Clip(gate(ops, i), clip));
+                        const auto in = Ops::Activate(activations[0], Ops::Clip(gate(ops, hiddenSize + i), clip));
+                        const auto candidate = Ops::Activate(activations[1], Ops::Clip(gate(ops, 2 * hiddenSize + i), clip));
+                        const auto o = Ops::Activate(activations[0], Ops::Clip(gate(ops, 3 * hiddenSize + i), clip));
+                        const auto state = Ops::Add(Ops::Mul(f, Ops::Load(cell + i)), Ops::Mul(in, candidate));
+                        const auto result = Ops::Mul(o, Ops::Activate(activations[2], state));
+                        Ops::Store(cell + i, state);
+                        Ops::Store(hidden + i, result);
+                        Ops::Store(out + i, result);
+                    });
+                    break;
+                }
+                case RecurrentCell::GRU : {
+                    // Gates order is z, r, h
+                    const float* resetGates = direction._resetGemm ? TensorRow(direction._resetGates, batch) : nullptr;
+                    ForEachLane(hiddenSize, [&] (auto ops, std::size_t i) {
+                        using Ops = decltype(ops);
+                        const auto z = Ops::Activate(activations[0], Ops::Clip(gate(ops, i), clip));
+                        const auto j = 2 * hiddenSize + i;
+                        typename Ops::Type candidate;
+                        if (resetGates != nullptr) {
+                            candidate = Ops::Add(Ops::Add(Ops::Load(xw + j), Ops::Load(resetGates + i)), Ops::Load(bias + j));
+                        } else {
+                            const auto r = Ops::Activate(activations[0], Ops::Clip(gate(ops, hiddenSize + i), clip));
+                            const auto recurrent = Ops::Add(Ops::Load(hr + j), Ops::Load(bias + hiddenSize + j));
+                            candidate = Ops::Add(Ops::Add(Ops::Load(xw + j), Ops::Load(bias + j)), Ops::Mul(r, recurrent));
+                        }
+                        candidate = Ops::Activate(activations[1], Ops::Clip(candidate, clip));
+                        const auto previous = Ops::Load(hidden + i);
+                        const auto result = Ops::Add(Ops::Mul(Ops::Sub(Ops::Dup(1.f), z), candidate), Ops::Mul(z, previous));
+                        Ops::Store(hidden + i, result);
+                        Ops::Store(out + i, result);
+                    });
+                    break;
+                }
+                default : {
+                    ForEachLane(hiddenSize, [&] (auto ops, std::size_t i) {
+                        using Ops = decltype(ops);
+                        const auto result = Ops::Activate(activations[0], Ops::Clip(gate(ops, i), clip));
+                        Ops::Store(hidden + i, result);
+                        Ops::Store(out + i, result);
+                    });
+                    break;
+                }
+                }
+            });
+        }
+
+        float* ho = _hiddenOutput;
+        float* co = _cellOutput;
+        for (std::size_t batch = 0; batch < _batch; ++batch) {
+            const auto stateOffset = (batch * _numDirections + d) * hiddenSize;
+            std::copy_n(TensorRow(direction._hidden, batch), hiddenSize, ho + stateOffset);
+            if (_info.cell == RecurrentCell::LSTM) {
+                std::copy_n(direction._cell.data() + batch * hiddenSize, hiddenSize, co + stateOffset);
+            }
+        }
+    }
+
+    std::shared_ptr<arm_compute::IMemoryManager>    _memory_manager;
+    DenseTensor                                     _x;
+    DenseTensor                                     _h;
+    DenseTensor                                     _c;
+    const arm_compute::ITensor*                     _seqLengths = nullptr;
+    DenseTensor                                     _w;
+    DenseTensor                                     _r;
+    DenseTensor                                     _b;
+    DenseTensor                                     _y;
+    DenseTensor                                     _ho;
+    DenseTensor                                     _co;
+    const float*                                    _bias = nullptr;
+    const float*                                    _hiddenState = nullptr;
+    const float*                                    _cellState = nullptr;
+    float*                                          _output = nullptr;
+    float*                                          _hiddenOutput = nullptr;
+    float*                                          _cellOutput = nullptr;
+    RecurrentSequenceInfo                           _info;
+    std::size_t                                     _inputSize = 0;
+    std::size_t                                     _seqLength = 0;
+    std::size_t                                     _batch = 0;
+    std::size_t                                     _hiddenSize = 0;
+    std::size_t                                     _numGates = 0;
+    std::size_t                                     _numDirections = 0;
+    std::size_t                                     _biasSize = 0;
+    std::vector<std::size_t>                        _lengths;
+    arm_compute::Tensor                             _input;
+    arm_compute::Tensor                             _weights;
+    arm_compute::Tensor                             _projection;
+    std::unique_ptr<arm_compute::NEGEMM>            _projectionGemm;
+    std::vector<std::unique_ptr<Direction>>         _directions;
+    bool                                            _isPrepared = false;
+};
+
+/**
+ * Returns information for NERecurrentSequence or false if the sequence should be executed by the reference implementation
+ */
+template<typename Sequence>
+static bool MakeRecurrentSequenceInfo(const Sequence& node, RecurrentCell cell, std::size_t weightsIndex,
+                                      bool linearBeforeReset, RecurrentSequenceInfo& info) {
+    if (node.get_input_element_type(0) != ngraph::element::f32) {
+        return false;
+    }
+    info.cell = cell;
+    for (auto&& activation : node.get_activations()) {
+        if (activation == "sigmoid") {
+            info.activations.push_back(RecurrentActivation::Sigmoid);
+        } else if (activation == "tanh") {
+            info.activations.push_back(RecurrentActivation::Tanh);
+        } else if (activation == "relu") {
+            info.activations.push_back(RecurrentActivation::Relu);
+        } else {
+            return false;
+        }
+    }
+    info.clip = node.get_clip();
+    info.direction = node.get_direction();
+    info.linearBeforeReset = linearBeforeReset;
+    info.constantWeights = ngraph::op::is_constant(node.input_value(weightsIndex).get_node()) &&
+                           ngraph::op::is_constant(node.input_value(weightsIndex + 1).get_node());
+    return true;
+}
+
 template <typename T, typename U>
 void wrap_lstm_sequence(const T* X,
                         const ngraph::Shape& X_shape,
@@ -73,6 +633,12 @@ void wrap_lstm_sequence(const T* X,
 
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::LSTMSequence& node) {
+    RecurrentSequenceInfo info;
+    if (MakeRecurrentSequenceInfo(node, RecurrentCell::LSTM, 4, false, info)) {
+        return MakeConversion<NERecurrentSequence>(node.input(0), node.input(1), node.input(2), node.input(3),
+                                                   node.input(4), node.input(5), node.input(6),
+                                                   node.output(0), node.output(1), node.output(2), info);
+    }
     auto make = [&] (auto refFunction) {
     return this->MakeConversion(refFunction,
                                 node.input(0),
@@ -148,6 +714,12 @@ void wrap_gru_sequence(const T* X,
 
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GRUSequence& node) {
+    RecurrentSequenceInfo info;
+    if (MakeRecurrentSequenceInfo(node, RecurrentCell::GRU, 3, node.get_linear_before_reset(), info)) {
+        return MakeConversion<NERecurrentSequence>(node.input(0), node.input(1), nullptr, node.input(2),
+                                                   node.input(3), node.input(4), node.input(5),
+                                                   node.output(0), node.output(1), nullptr, info);
+    }
     auto make = [&] (auto refFunction) {
     return this->MakeConversion(refFunction,
                                 node.input(0),
@@ -216,6 +788,12 @@ void wrap_rnn_sequence(const T* X,
 
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::RNNSequence& node) {
+    RecurrentSequenceInfo info;
+    if (MakeRecurrentSequenceInfo(node, RecurrentCell::RNN, 3, false, info)) {
+        return MakeConversion<NERecurrentSequence>(node.input(0), node.input(1), nullptr, node.input(2),
+                                                   node.input(3), node.input(4), node.input(5),
+                                                   node.output(0), node.output(1), nullptr, info);
+    }
     auto make = [&] (auto refFunction) {
     return this->MakeConversion(refFunction,
                                 node.input(0),
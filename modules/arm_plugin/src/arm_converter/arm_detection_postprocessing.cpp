@@ -0,0 +1,510 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_converter/arm_detection_postprocessing.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+#include <ngraph/runtime/reference/detection_output.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace {
+struct Box {
+    float ymin;
+    float xmin;
+    float ymax;
+    float xmax;
+    float area;
+};
+
+struct BoxesView {
+    const float* ymin;
+    const float* xmin;
+    const float* ymax;
+    const float* xmax;
+    const float* area;
+
+    Box operator[](std::size_t i) const {
+        return {ymin[i], xmin[i], ymax[i], xmax[i], area[i]};
+    }
+};
+
+inline float IntersectionOverUnion(const Box& box, const BoxesView& boxes, std::size_t j) {
+    if (box.area <= 0.f || boxes.area[j] <= 0.f) {
+        return 0.f;
+    }
+    const float height = std::max(std::min(box.ymax, boxes.ymax[j]) - std::max(box.ymin, boxes.ymin[j]), 0.f);
+    const float width = std::max(std::min(box.xmax, boxes.xmax[j]) - std::max(box.xmin, boxes.xmin[j]), 0.f);
+    const float intersection = height * width;
+    return intersection / (box.area + boxes.area[j] - intersection);
+}
+
+#if defined(__aarch64__)
+// vdivq_f32 is available on AArch64 only, so ARMv7 builds use the scalar version
+struct BoxLanes {
+    explicit BoxLanes(const Box& box) :
+        ymin{vdupq_n_f32(box.ymin)},
+        xmin{vdupq_n_f32(box.xmin)},
+        ymax{vdupq_n_f32(box.ymax)},
+        xmax{vdupq_n_f32(box.xmax)},
+        area{vdupq_n_f32(box.area)} {
+    }
+    float32x4_t ymin;
+    float32x4_t xmin;
+    float32x4_t ymax;
+    float32x4_t xmax;
+    float32x4_t area;
+};
+
+inline float32x4_t IntersectionOverUnion(const BoxLanes& box, const BoxesView& boxes, std::size_t j) {
+    const auto zero = vdupq_n_f32(0.f);
+    const auto area = vld1q_f32(boxes.area + j);
+    const auto height = vmaxq_f32(vsubq_f32(vminq_f32(box.ymax, vld1q_f32(boxes.ymax + j)),
+                                            vmaxq_f32(box.ymin, vld1q_f32(boxes.ymin + j))), zero);
+    const auto width = vmaxq_f32(vsubq_f32(vminq_f32(box.xmax, vld1q_f32(boxes.xmax + j)),
+                                           vmaxq_f32(box.xmin, vld1q_f32(boxes.xmin + j))), zero);
+    const auto intersection = vmulq_f32(height, width);
+    const auto iou = vdivq_f32(intersection, vsubq_f32(vaddq_f32(box.area, area), intersection));
+    // Lanes with empty boxes may contain NaN, they are replaced with zeros
+    const auto valid = vandq_u32(vcgtq_f32(box.area, zero), vcgtq_f32(area, zero));
+    return vbslq_f32(valid, iou, zero);
+}
+#endif
+
+/**
+ * Computes IoU of @box with @boxes in range [@begin, @end) into @ious
+ */
+void IntersectionOverUnion(const Box& box, const BoxesView& boxes, std::size_t begin, std::size_t end, float* ious) {
+    auto j = begin;
+#if defined(__aarch64__)
+    const BoxLanes lanes{box};
+    for (; j + 4 <= end; j += 4) {
+        vst1q_f32(ious + j, IntersectionOverUnion(lanes, boxes, j));
+    }
+#endif
+    for (; j < end; ++j) {
+        ious[j] = IntersectionOverUnion(box, boxes, j);
+    }
+}
+
+/**
+ * Checks whether IoU of @box with any of first @end @boxes is not less than @threshold
+ */
+bool Overlaps(const Box& box, const BoxesView& boxes, std::size_t end, float threshold) {
+    std::size_t j = 0;
+#if defined(__aarch64__)
+    const BoxLanes lanes{box};
+    const auto thresholds = vdupq_n_f32(threshold);
+    for (; j + 4 <= end; j += 4) {
+        if (vmaxvq_u32(vcgeq_f32(IntersectionOverUnion(lanes, boxes, j), thresholds)) != 0) {
+            return true;
+        }
+    }
+#endif
+    for (; j < end; ++j) {
+        if (IntersectionOverUnion(box, boxes, j) >= threshold) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename I, typename Results>
+void WriteIndices(const Results& results, std::size_t numValid, std::size_t numRows, I* indices, I* validOutputs) {
+    for (std::size_t i = 0; i < numValid; ++i) {
+        indices[3 * i + 0] = static_cast<I>(results[i].batch);
+        indices[3 * i + 1] = static_cast<I>(results[i].klass);
+        indices[3 * i + 2] = static_cast<I>(results[i].index);
+    }
+    std::fill(indices + 3 * numValid, indices + 3 * numRows, static_cast<I>(-1));
+    *validOutputs = static_cast<I>(numValid);
+}
+
+template<typename S, typename Results>
+void WriteScores(const Results& results, std::size_t numValid, std::size_t numRows, S* scores) {
+    for (std::size_t i = 0; i < numValid; ++i) {
+        scores[3 * i + 0] = static_cast<S>(static_cast<float>(results[i].batch));
+        scores[3 * i + 1] = static_cast<S>(static_cast<float>(results[i].klass));
+        scores[3 * i + 2] = static_cast<S>(results[i].score);
+    }
+    std::fill(scores + 3 * numValid, scores + 3 * numRows, static_cast<S>(-1.f));
+}
+}  // namespace
+
+NonMaxSuppression::Scratch::Scratch(std::size_t numBoxes, std::size_t maxPerClass) :
+    _ymin(maxPerClass),
+    _xmin(maxPerClass),
+    _ymax(maxPerClass),
+    _xmax(maxPerClass),
+    _area(maxPerClass),
+    _ious(maxPerClass) {
+    _candidates.reserve(numBoxes);
+}
+
+NonMaxSuppression::NonMaxSuppression(const Attributes& attrs,
+                                     const ngraph::Shape& boxesShape,
+                                     const ngraph::Shape& scoresShape,
+                                     std::size_t maxSelected) :
+    _attrs(attrs),
+    _numBatches{scoresShape.at(0)},
+    _numClasses{scoresShape.at(1)},
+    _numBoxes{boxesShape.at(1)},
+    _maxPerClass{std::min(attrs.maxOutputBoxesPerClass, boxesShape.at(1))},
+    _maxSelected{maxSelected},
+    _ymin(_numBatches * _numBoxes),
+    _xmin(_numBatches * _numBoxes),
+    _ymax(_numBatches * _numBoxes),
+    _xmax(_numBatches * _numBoxes),
+    _area(_numBatches * _numBoxes),
+    _scratch(parallel_get_max_threads(), Scratch{_numBoxes, _maxPerClass}),
+    _selected(_numBatches * _numClasses * _maxPerClass),
+    _numSelected(_numBatches * _numClasses) {
+    _results.reserve(_selected.size());
+}
+
+void NonMaxSuppression::NormalizeBoxes(const float* boxes) {
+    const auto size = _numBatches * _numBoxes;
+    std::size_t i = 0;
+    if (_attrs.boxEncoding == opset::NonMaxSuppression::BoxEncodingType::CORNER) {
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        for (; i + 4 <= size; i += 4) {
+            const auto box = vld4q_f32(boxes + 4 * i);
+            const auto ymin = vminq_f32(box.val[0], box.val[2]);
+            const auto xmin = vminq_f32(box.val[1], box.val[3]);
+            const auto ymax = vmaxq_f32(box.val[0], box.val[2]);
+            const auto xmax = vmaxq_f32(box.val[1], box.val[3]);
+            vst1q_f32(_ymin.data() + i, ymin);
+            vst1q_f32(_xmin.data() + i, xmin);
+            vst1q_f32(_ymax.data() + i, ymax);
+            vst1q_f32(_xmax.data() + i, xmax);
+            vst1q_f32(_area.data() + i, vmulq_f32(vsubq_f32(ymax, ymin), vsubq_f32(xmax, xmin)));
+        }
+#endif
+        for (; i < size; ++i) {
+            const float* box = boxes + 4 * i;
+            _ymin[i] = std::min(box[0], box[2]);
+            _xmin[i] = std::min(box[1], box[3]);
+            _ymax[i] = std::max(box[0], box[2]);
+            _xmax[i] = std::max(box[1], box[3]);
+            _area[i] = (_ymax[i] - _ymin[i]) * (_xmax[i] - _xmin[i]);
+        }
+    } else {
+        for (; i < size; ++i) {
+            const float* box = boxes + 4 * i;
+            // Computed in double precision as the reference does
+            _ymin[i] = box[1] - box[3] / 2.0;
+            _xmin[i] = box[0] - box[2] / 2.0;
+            _ymax[i] = box[1] + box[3] / 2.0;
+            _xmax[i] = box[0] + box[2] / 2.0;
+            _area[i] = (_ymax[i] - _ymin[i]) * (_xmax[i] - _xmin[i]);
+        }
+    }
+}
+
+void NonMaxSuppression::SuppressClass(const float* scores, std::size_t batch, std::size_t klass, Scratch& scratch) {
+    const auto task = batch * _numClasses + klass;
+    const float* classScores = scores + task * _numBoxes;
+    const auto boxesOffset = batch * _numBoxes;
+    const BoxesView boxes{_ymin.data() + boxesOffset, _xmin.data() + boxesOffset, _ymax.data() + boxesOffset,
+                          _xmax.data() + boxesOffset, _area.data() + boxesOffset};
+    const BoxesView selectedBoxes{scratch._ymin.data(), scratch._xmin.data(), scratch._ymax.data(),
+                                  scratch._xmax.data(), scratch._area.data()};
+    auto* selected = _selected.data() + task * _maxPerClass;
+    std::size_t numSelected = 0;
+
+    auto& candidates = scratch._candidates;
+    candidates.clear();
+    for (std::size_t i = 0; i < _numBoxes; ++i) {
+        if (classScores[i] > _attrs.scoreThreshold) {
+            candidates.push_back({classScores[i], static_cast<std::int64_t>(i), 0});
+        }
+    }
+    // Candidates are taken in the same order as from std::priority_queue used by the reference
+    std::make_heap(candidates.begin(), candidates.end());
+
+    const bool softNms = _attrs.softNmsSigma > 0.f;
+    const float scale = softNms ? -0.5f / _attrs.softNmsSigma : 0.f;
+    while (numSelected < _maxPerClass && !candidates.empty()) {
+        std::pop_heap(candidates.begin(), candidates.end());
+        auto candidate = candidates.back();
+        candidates.pop_back();
+        const float originalScore = candidate.score;
+        const auto box = boxes[static_cast<std::size_t>(candidate.index)];
+
+        bool hardSuppressed = false;
+        if (!softNms) {
+            hardSuppressed = Overlaps(box, selectedBoxes, numSelected, _attrs.iouThreshold);
+        } else {
+            IntersectionOverUnion(box, selectedBoxes, candidate.suppressBegin, numSelected, scratch._ious.data());
+            for (auto j = numSelected; j-- > candidate.suppressBegin;) {
+                const float iou = scratch._ious[j];
+                candidate.score *= (iou <= _attrs.iouThreshold) ? std::exp(scale * iou * iou) : 0.f;
+                if (iou >= _attrs.iouThreshold) {
+                    hardSuppressed = true;
+                    break;
+                }
+                if (candidate.score <= _attrs.scoreThreshold) {
+                    break;
+                }
+            }
+        }
+        candidate.suppressBegin = numSelected;
+
+        if (!hardSuppressed) {
+            if (candidate.score == originalScore) {
+                selected[numSelected] = {candidate.score, static_cast<std::int64_t>(batch),
+                                         static_cast<std::int64_t>(klass), candidate.index};
+                scratch._ymin[numSelected] = box.ymin;
+                scratch._xmin[numSelected] = box.xmin;
+                scratch._ymax[numSelected] = box.ymax;
+                scratch._xmax[numSelected] = box.xmax;
+                scratch._area[numSelected] = box.area;
+                ++numSelected;
+            } else if (candidate.score > _attrs.scoreThreshold) {
+                candidates.push_back(candidate);
+                std::push_heap(candidates.begin(), candidates.end());
+            }
+        }
+    }
+    _numSelected[task] = numSelected;
+}
+
+void NonMaxSuppression::operator()(const float* boxes, const float* scores, const ngraph::HostTensorVector& outputs) {
+    NormalizeBoxes(boxes);
+
+    const auto nthr = parallel_get_max_threads();
+    if (_scratch.size() < static_cast<std::size_t>(nthr)) {
+        _scratch.resize(nthr, Scratch{_numBoxes, _maxPerClass});
+    }
+    InferenceEngine::parallel_nt(nthr, [&] (const int ithr, const int numThreads) {
+        InferenceEngine::for_2d(ithr, numThreads, _numBatches, _numClasses, [&] (std::size_t batch, std::size_t klass) {
+            SuppressClass(scores, batch, klass, _scratch[ithr]);
+        });
+    });
+
+    _results.clear();
+    for (std::size_t task = 0; task < _numSelected.size(); ++task) {
+        auto begin = _selected.begin() + task * _maxPerClass;
+        _results.insert(_results.end(), begin, begin + _numSelected[task]);
+    }
+    if (_attrs.sortResultDescending) {
+        std::sort(_results.begin(), _results.end(), [] (const Selected& l, const Selected& r) {
+            return (l.score > r.score) ||
+                   ((l.score == r.score) && (l.batch < r.batch)) ||
+                   ((l.score == r.score) && (l.batch == r.batch) && (l.klass < r.klass)) ||
+                   ((l.score == r.score) && (l.batch == r.batch) && (l.klass == r.klass) && (l.index < r.index));
+        });
+    }
+
+    const auto numValid = std::min(_results.size(), _maxSelected);
+    if (outputs[0]->get_element_type() == ngraph::element::i64) {
+        WriteIndices(_results, numValid, _maxSelected,
+                     outputs[0]->get_data_ptr<std::int64_t>(), outputs[2]->get_data_ptr<std::int64_t>());
+    } else {
+        WriteIndices(_results, numValid, _maxSelected,
+                     outputs[0]->get_data_ptr<std::int32_t>(), outputs[2]->get_data_ptr<std::int32_t>());
+    }
+    if (outputs[1]->get_element_type() == ngraph::element::f16) {
+        WriteScores(_results, numValid, _maxSelected, outputs[1]->get_data_ptr<ngraph::float16>());
+    } else if (outputs[1]->get_element_type() == ngraph::element::f32) {
+        WriteScores(_results, numValid, _maxSelected, outputs[1]->get_data_ptr<float>());
+    } else {
+        IE_THROW() << "Arm Plugin: Unsupported NonMaxSuppression selected scores type: " << outputs[1]->get_element_type();
+    }
+}
+
+namespace {
+template<typename T>
+void RunDetectionOutput(const ngraph::op::DetectionOutputAttrs& attrs,
+                        const std::vector<ngraph::Shape>& shapes,
+                        const ngraph::Shape& outShape,
+                        const T* location,
+                        const T* confidence,
+                        const T* priors,
+                        const T* armConfidence,
+                        const T* armLocation,
+                        T* result) {
+    ngraph::runtime::reference::referenceDetectionOutput<T> refDet(attrs, shapes[0], shapes[2], outShape);
+    refDet.run(location, confidence, priors, armConfidence, armLocation, result);
+}
+
+template<typename T>
+void RunDetectionOutput(const ngraph::op::util::DetectionOutputBase::AttributesBase& attrs,
+                        const std::vector<ngraph::Shape>& shapes,
+                        const ngraph::Shape& outShape,
+                        const T* location,
+                        const T* confidence,
+                        const T* priors,
+                        const T* armConfidence,
+                        const T* armLocation,
+                        T* result) {
+    ngraph::runtime::reference::referenceDetectionOutput<T> refDet(attrs, shapes[0], shapes[1], shapes[2], outShape);
+    refDet.run(location, confidence, priors, armConfidence, armLocation, result);
+}
+
+constexpr std::size_t detectionSize = 7;
+}  // namespace
+
+template<typename T, typename Attributes>
+DetectionOutput<T, Attributes>::DetectionOutput(const Attributes& attrs,
+                                                const std::vector<ngraph::Shape>& inputShapes,
+                                                const ngraph::Shape& outShape) :
+    _attrs(attrs),
+    _numImages{inputShapes.at(0).at(0)},
+    _imageShapes(inputShapes),
+    _imageOutShape(outShape),
+    _outTotalSize{ngraph::shape_size(outShape)},
+    _detections(_outTotalSize) {
+    for (auto&& shape : _imageShapes) {
+        // Priors may be shared by all images
+        _imageSizes.push_back(shape.at(0) == 1 ? 0 : ngraph::shape_size(shape) / shape.at(0));
+        shape[0] = 1;
+    }
+    _imageOutShape.at(2) /= _numImages;
+}
+
+template<typename T, typename Attributes>
+void DetectionOutput<T, Attributes>::operator()(const T* location,
+                                                const T* confidence,
+                                                const T* priors,
+                                                const T* armConfidence,
+                                                const T* armLocation,
+                                                T* result) {
+    const auto imageOutSize = ngraph::shape_size(_imageOutShape);
+    InferenceEngine::parallel_for(_numImages, [&] (std::size_t image) {
+        auto imageInput = [&] (const T* input, std::size_t i) {
+            return input == nullptr ? nullptr : input + image * _imageSizes[i];
+        };
+        RunDetectionOutput<T>(_attrs, _imageShapes, _imageOutShape,
+                              imageInput(location, 0),
+                              imageInput(confidence, 1),
+                              imageInput(priors, 2),
+                              _imageSizes.size() > 3 ? imageInput(armConfidence, 3) : nullptr,
+                              _imageSizes.size() > 4 ? imageInput(armLocation, 4) : nullptr,
+                              _detections.data() + image * imageOutSize);
+    });
+
+    // Detections of each image are terminated with image id -1 if there are less of them than rows of the output
+    const auto imageRows = _imageOutShape[2];
+    std::size_t count = 0;
+    for (std::size_t image = 0; image < _numImages; ++image) {
+        const T* detections = _detections.data() + image * imageOutSize;
+        for (std::size_t row = 0; row < imageRows; ++row) {
+            const T* detection = detections + row * detectionSize;
+            if (static_cast<float>(detection[0]) == -1.f) {
+                break;
+            }
+            T* output = result + count * detectionSize;
+            std::copy(detection, detection + detectionSize, output);
+            output[0] = static_cast<T>(static_cast<float>(image));
+            ++count;
+        }
+    }
+    if (count * detectionSize < _outTotalSize) {
+        result[count * detectionSize] = static_cast<T>(-1.f);
+    }
+}
+
+template class DetectionOutput<float, ngraph::op::DetectionOutputAttrs>;
+template class DetectionOutput<ngraph::float16, ngraph::op::DetectionOutputAttrs>;
+template class DetectionOutput<float, ngraph::op::util::DetectionOutputBase::AttributesBase>;
+template class DetectionOutput<ngraph::float16, ngraph::op::util::DetectionOutputBase::AttributesBase>;
+
+namespace {
+template<typename T>
+void Sigmoid(const T* input, T* output, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        output[i] = static_cast<T>(1.f / (1.f + std::exp(-static_cast<float>(input[i]))));
+    }
+}
+}  // namespace
+
+template<typename T>
+RegionYolo<T>::RegionYolo(const ngraph::Shape& inputShape,
+                          std::size_t coords,
+                          std::size_t classes,
+                          std::size_t regions,
+                          bool doSoftmax,
+                          const std::vector<std::int64_t>& mask) :
+    _numBatches{inputShape.at(0)},
+    _numRegions{doSoftmax ? regions : mask.size()},
+    _coords{coords},
+    _classes{classes},
+    _spatialSize{inputShape.at(2) * inputShape.at(3)},
+    _numSigmoidChannels{doSoftmax ? 1 : classes + 1},
+    _doSoftmax{doSoftmax},
+    _scratch(parallel_get_max_threads(), Scratch{std::vector<float>(doSoftmax ? _spatialSize : 0),
+                                                 std::vector<float>(doSoftmax ? _spatialSize : 0)}) {
+    if (inputShape.at(1) != _numRegions * (coords + classes + 1)) {
+        IE_THROW() << "Arm Plugin: RegionYolo input has " << inputShape.at(1) << " channels, but "
+                   << _numRegions << " regions with " << coords + classes + 1 << " channels are expected";
+    }
+}
+
+template<typename T>
+void RegionYolo<T>::ProcessRegion(const T* input, T* output, Scratch& scratch) const {
+    const auto size = _spatialSize;
+    const auto numSigmoid = std::min<std::size_t>(_coords, 2);
+    Sigmoid(input, output, numSigmoid * size);
+    std::copy(input + numSigmoid * size, input + _coords * size, output + numSigmoid * size);
+    Sigmoid(input + _coords * size, output + _coords * size, _numSigmoidChannels * size);
+    if (!_doSoftmax) {
+        return;
+    }
+    // Softmax over classes is computed for all locations at once, so rows of classes are accessed consecutively
+    const T* classesInput = input + (_coords + 1) * size;
+    T* classesOutput = output + (_coords + 1) * size;
+    auto& max = scratch._max;
+    auto& sum = scratch._sum;
+    std::copy(classesInput, classesInput + size, max.begin());
+    for (std::size_t c = 1; c < _classes; ++c) {
+        const T* row = classesInput + c * size;
+        for (std::size_t i = 0; i < size; ++i) {
+            max[i] = std::max(max[i], static_cast<float>(row[i]));
+        }
+    }
+    std::fill(sum.begin(), sum.end(), 0.f);
+    for (std::size_t c = 0; c < _classes; ++c) {
+        const T* row = classesInput + c * size;
+        T* outputRow = classesOutput + c * size;
+        for (std::size_t i = 0; i < size; ++i) {
+            const float value = std::exp(static_cast<float>(row[i]) - max[i]);
+            outputRow[i] = static_cast<T>(value);
+            sum[i] += value;
+        }
+    }
+    for (std::size_t c = 0; c < _classes; ++c) {
+        T* outputRow = classesOutput + c * size;
+        for (std::size_t i = 0; i < size; ++i) {
+            outputRow[i] = static_cast<T>(static_cast<float>(outputRow[i]) / sum[i]);
+        }
+    }
+}
+
+template<typename T>
+void RegionYolo<T>::operator()(const T* input, T* output) {
+    const auto regionSize = _spatialSize * (_coords + _classes + 1);
+    const auto nthr = parallel_get_max_threads();
+    if (_scratch.size() < static_cast<std::size_t>(nthr)) {
+        const auto prototype = _scratch.front();
+        _scratch.resize(nthr, prototype);
+    }
+    InferenceEngine::parallel_nt(nthr, [&] (const int ithr, const int numThreads) {
+        InferenceEngine::for_2d(ithr, numThreads, _numBatches, _numRegions, [&] (std::size_t batch, std::size_t region) {
+            const auto offset = (batch * _numRegions + region) * regionSize;
+            ProcessRegion(input + offset, output + offset, _scratch[ithr]);
+        });
+    });
+}
+
+template class RegionYolo<float>;
+template class RegionYolo<ngraph::float16>;
+}  // namespace ArmPlugin
@@ -0,0 +1,166 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ngraph/runtime/host_tensor.hpp>
+#include <ngraph/op/util/detection_output_base.hpp>
+
+#include "opset/opset.hpp"
+
+namespace ArmPlugin {
+/**
+ * @brief NonMaxSuppression-5 used instead of the reference one. Results are the same as the reference ones.
+ * Boxes are normalized once per run into separate coordinate arrays, so IoU of a candidate box with
+ * boxes selected before is computed for several boxes at once with NEON.
+ * Classes of all batches are suppressed in parallel, scratch buffers are allocated on construction,
+ * so a run doesn't allocate memory.
+ */
+class NonMaxSuppression {
+public:
+    struct Attributes {
+        std::size_t                                 maxOutputBoxesPerClass;
+        float                                       iouThreshold;
+        float                                       scoreThreshold;
+        float                                       softNmsSigma;
+        opset::NonMaxSuppression::BoxEncodingType   boxEncoding;
+        bool                                        sortResultDescending;
+    };
+
+    /**
+     * @param maxSelected number of rows in selected indices and scores outputs
+     */
+    NonMaxSuppression(const Attributes& attrs,
+                      const ngraph::Shape& boxesShape,
+                      const ngraph::Shape& scoresShape,
+                      std::size_t maxSelected);
+
+    /**
+     * Writes selected indices, selected scores and the number of valid outputs into @outputs
+     */
+    void operator()(const float* boxes, const float* scores, const ngraph::HostTensorVector& outputs);
+
+private:
+    struct Candidate {
+        float           score;
+        std::int64_t    index;
+        std::size_t     suppressBegin;
+        bool operator<(const Candidate& other) const {
+            return (score < other.score) || ((score == other.score) && (index > other.index));
+        }
+    };
+
+    struct Selected {
+        float           score;
+        std::int64_t    batch;
+        std::int64_t    klass;
+        std::int64_t    index;
+    };
+
+    /**
+     * Per thread buffers, coordinates of boxes selected in a class are kept in separate arrays
+     */
+    struct Scratch {
+        Scratch(std::size_t numBoxes, std::size_t maxPerClass);
+
+        std::vector<Candidate>  _candidates;
+        std::vector<float>      _ymin;
+        std::vector<float>      _xmin;
+        std::vector<float>      _ymax;
+        std::vector<float>      _xmax;
+        std::vector<float>      _area;
+        std::vector<float>      _ious;
+    };
+
+    void NormalizeBoxes(const float* boxes);
+    void SuppressClass(const float* scores, std::size_t batch, std::size_t klass, Scratch& scratch);
+
+    Attributes              _attrs;
+    std::size_t             _numBatches;
+    std::size_t             _numClasses;
+    std::size_t             _numBoxes;
+    std::size_t             _maxPerClass;
+    std::size_t             _maxSelected;
+    std::vector<float>      _ymin;
+    std::vector<float>      _xmin;
+    std::vector<float>      _ymax;
+    std::vector<float>      _xmax;
+    std::vector<float>      _area;
+    std::vector<Scratch>    _scratch;
+    std::vector<Selected>   _selected;
+    std::vector<std::size_t> _numSelected;
+    std::vector<Selected>   _results;
+};
+
+/**
+ * @brief DetectionOutput-0 and DetectionOutput-8 which process images of a batch in parallel.
+ * Detections of each image are found by the reference implementation into a preallocated buffer,
+ * then they are gathered into the output in the order of images.
+ */
+template<typename T, typename Attributes>
+class DetectionOutput {
+public:
+    /**
+     * @param inputShapes shapes of location, confidence, priors and optional ARM confidence and ARM location inputs
+     */
+    DetectionOutput(const Attributes& attrs,
+                    const std::vector<ngraph::Shape>& inputShapes,
+                    const ngraph::Shape& outShape);
+
+    void operator()(const T* location,
+                    const T* confidence,
+                    const T* priors,
+                    const T* armConfidence,
+                    const T* armLocation,
+                    T* result);
+
+private:
+    Attributes                  _attrs;
+    std::size_t                 _numImages;
+    std::vector<ngraph::Shape>  _imageShapes;
+    std::vector<std::size_t>    _imageSizes;
+    ngraph::Shape               _imageOutShape;
+    std::size_t                 _outTotalSize;
+    std::vector<T>              _detections;
+};
+
+/**
+ * @brief RegionYolo-0 which processes regions of all images in parallel.
+ * Softmax over classes is computed for all locations of a region at once over rows of consecutive
+ * values, instead of strided accesses for each location.
+ */
+template<typename T>
+class RegionYolo {
+public:
+    RegionYolo(const ngraph::Shape& inputShape,
+               std::size_t coords,
+               std::size_t classes,
+               std::size_t regions,
+               bool doSoftmax,
+               const std::vector<std::int64_t>& mask);
+
+    void operator()(const T* input, T* output);
+
+private:
+    struct Scratch {
+        std::vector<float>  _max;
+        std::vector<float>  _sum;
+    };
+
+    void ProcessRegion(const T* input, T* output, Scratch& scratch) const;
+
+    std::size_t             _numBatches;
+    std::size_t             _numRegions;
+    std::size_t             _coords;
+    std::size_t             _classes;
+    std::size_t             _spatialSize;
+    std::size_t             _numSigmoidChannels;
+    bool                    _doSoftmax;
+    std::vector<Scratch>    _scratch;
+};
+}  // namespace ArmPlugin
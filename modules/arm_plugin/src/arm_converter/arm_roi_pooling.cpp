@@ -0,0 +1,549 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_converter/arm_roi_pooling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace {
+constexpr std::size_t channelBlockSize = 16;
+
+/**
+ * Value of one channel, f16 values are computed in f32
+ */
+template<typename T>
+struct ScalarLanes {
+    using Type = float;
+    static Type Dup(float value) {
+        return value;
+    }
+    static Type Gather(const T* data, std::size_t, std::size_t offset) {
+        return static_cast<float>(data[offset]);
+    }
+    static void Scatter(T* data, std::size_t, Type value) {
+        *data = static_cast<T>(value);
+    }
+    static Type Add(Type l, Type r) {return l + r;}
+    static Type Sub(Type l, Type r) {return l - r;}
+    static Type Mul(Type l, Type r) {return l * r;}
+    static Type Div(Type l, Type r) {return l / r;}
+    static Type Max(Type l, Type r) {return l > r ? l : r;}
+};
+
+#if defined(__aarch64__)
+// vdivq_f32 is available on AArch64 only, so ARMv7 builds use the scalar version
+/**
+ * Values of four channels, planes of channels are @stride values apart
+ */
+struct NeonLanes {
+    using Type = float32x4_t;
+    static Type Dup(float value) {
+        return vdupq_n_f32(value);
+    }
+    static Type Gather(const float* data, std::size_t stride, std::size_t offset) {
+        data += offset;
+        auto value = vld1q_dup_f32(data);
+        value = vld1q_lane_f32(data + stride, value, 1);
+        value = vld1q_lane_f32(data + 2 * stride, value, 2);
+        return vld1q_lane_f32(data + 3 * stride, value, 3);
+    }
+    static void Scatter(float* data, std::size_t stride, Type value) {
+        vst1q_lane_f32(data, value, 0);
+        vst1q_lane_f32(data + stride, value, 1);
+        vst1q_lane_f32(data + 2 * stride, value, 2);
+        vst1q_lane_f32(data + 3 * stride, value, 3);
+    }
+    static Type Add(Type l, Type r) {return vaddq_f32(l, r);}
+    static Type Sub(Type l, Type r) {return vsubq_f32(l, r);}
+    static Type Mul(Type l, Type r) {return vmulq_f32(l, r);}
+    static Type Div(Type l, Type r) {return vdivq_f32(l, r);}
+    static Type Max(Type l, Type r) {return vmaxq_f32(l, r);}
+};
+#endif
+
+template<typename T>
+struct ChannelLoop {
+    template<typename Kernel>
+    static void Run(std::size_t begin, std::size_t end, Kernel&& kernel) {
+        for (auto c = begin; c < end; ++c) {
+            kernel(ScalarLanes<T>{}, c);
+        }
+    }
+};
+
+#if defined(__aarch64__)
+template<>
+struct ChannelLoop<float> {
+    template<typename Kernel>
+    static void Run(std::size_t begin, std::size_t end, Kernel&& kernel) {
+        auto c = begin;
+        for (; c + 4 <= end; c += 4) {
+            kernel(NeonLanes{}, c);
+        }
+        for (; c < end; ++c) {
+            kernel(ScalarLanes<float>{}, c);
+        }
+    }
+};
+#endif
+
+/**
+ * Calls @kernel(lanes, roi, channel) in parallel over ROIs and blocks of channels.
+ * Lanes of f32 channels contain consecutive channels starting from the channel.
+ */
+template<typename T, typename Kernel>
+void ForEachChannelBlock(std::size_t numRois, std::size_t channels, Kernel&& kernel) {
+    const auto numBlocks = (channels + channelBlockSize - 1) / channelBlockSize;
+    InferenceEngine::parallel_for2d(numRois, numBlocks, [&] (std::size_t roi, std::size_t block) {
+        const auto begin = block * channelBlockSize;
+        const auto end = std::min(channels, begin + channelBlockSize);
+        ChannelLoop<T>::Run(begin, end, [&] (auto lanes, std::size_t c) {
+            kernel(lanes, roi, c);
+        });
+    });
+}
+}  // namespace
+
+template<typename T, typename U>
+ROIAlign<T, U>::ROIAlign(const ngraph::Shape& featureMapsShape,
+                         const ngraph::Shape& roisShape,
+                         std::size_t pooledHeight,
+                         std::size_t pooledWidth,
+                         int samplingRatio,
+                         float spatialScale,
+                         opset::ROIAlign::PoolingMode mode) :
+    _channels{featureMapsShape.at(1)},
+    _height{featureMapsShape.at(2)},
+    _width{featureMapsShape.at(3)},
+    _numRois{roisShape.at(0)},
+    _pooledHeight{pooledHeight},
+    _pooledWidth{pooledWidth},
+    _samplingRatio{samplingRatio},
+    _spatialScale{spatialScale},
+    _mode{mode},
+    _tables(_numRois),
+    _numSamples(_numRois, 0) {
+    if (_samplingRatio > 0) {
+        for (auto&& table : _tables) {
+            table.reserve(_pooledHeight * _pooledWidth * _samplingRatio * _samplingRatio);
+        }
+    }
+}
+
+template<typename T, typename U>
+void ROIAlign<T, U>::PrepareTable(const T* roi, std::size_t index) {
+    const auto x1 = static_cast<float>(roi[0]) * _spatialScale;
+    const auto y1 = static_cast<float>(roi[1]) * _spatialScale;
+    const auto x2 = static_cast<float>(roi[2]) * _spatialScale;
+    const auto y2 = static_cast<float>(roi[3]) * _spatialScale;
+
+    const auto roiWidth = std::max(x2 - x1, 1.f);
+    const auto roiHeight = std::max(y2 - y1, 1.f);
+    const auto binWidth = roiWidth / _pooledWidth;
+    const auto binHeight = roiHeight / _pooledHeight;
+
+    const auto samplingRatioX = _samplingRatio == 0 ? static_cast<int>(std::ceil(binWidth)) : _samplingRatio;
+    const auto samplingRatioY = _samplingRatio == 0 ? static_cast<int>(std::ceil(binHeight)) : _samplingRatio;
+    const auto sampleDistanceX = binWidth / samplingRatioX;
+    const auto sampleDistanceY = binHeight / samplingRatioY;
+    _numSamples[index] = samplingRatioX * samplingRatioY;
+
+    auto& table = _tables[index];
+    table.clear();
+    for (std::size_t yBin = 0; yBin < _pooledHeight; ++yBin) {
+        for (std::size_t xBin = 0; xBin < _pooledWidth; ++xBin) {
+            for (int ySample = 0; ySample < samplingRatioY; ++ySample) {
+                const auto binSampleY = y1 + yBin * binHeight + sampleDistanceY * (ySample + 0.5f);
+                for (int xSample = 0; xSample < samplingRatioX; ++xSample) {
+                    auto sampleY = binSampleY;
+                    auto sampleX = x1 + xBin * binWidth + sampleDistanceX * (xSample + 0.5f);
+                    if (sampleX < -1.f || sampleX > _width || sampleY < -1.f || sampleY > _height) {
+                        table.push_back(Sample{{0, 0, 0, 0}, {0.f, 0.f, 0.f, 0.f}});
+                        continue;
+                    }
+                    sampleX = std::max(sampleX, 0.f);
+                    sampleY = std::max(sampleY, 0.f);
+
+                    auto yLow = static_cast<std::size_t>(sampleY);
+                    auto xLow = static_cast<std::size_t>(sampleX);
+                    std::size_t yHigh = 0;
+                    std::size_t xHigh = 0;
+                    if (yLow >= _height - 1) {
+                        yHigh = yLow = _height - 1;
+                        sampleY = static_cast<float>(yLow);
+                    } else {
+                        yHigh = yLow + 1;
+                    }
+                    if (xLow >= _width - 1) {
+                        xHigh = xLow = _width - 1;
+                        sampleX = static_cast<float>(xLow);
+                    } else {
+                        xHigh = xLow + 1;
+                    }
+
+                    const auto ly = sampleY - yLow;
+                    const auto lx = sampleX - xLow;
+                    const auto hy = 1.f - ly;
+                    const auto hx = 1.f - lx;
+                    table.push_back(Sample{{yLow * _width + xLow, yLow * _width + xHigh, yHigh * _width + xLow, yHigh * _width + xHigh},
+                                           {hy * hx, hy * lx, ly * hx, ly * lx}});
+                }
+            }
+        }
+    }
+}
+
+template<typename T, typename U>
+void ROIAlign<T, U>::operator()(const T* featureMaps, const T* rois, const U* batchIndices, T* output) {
+    InferenceEngine::parallel_for(_numRois, [&] (std::size_t roi) {
+        PrepareTable(rois + 4 * roi, roi);
+    });
+
+    const auto spatialSize = _height * _width;
+    const auto pooledSize = _pooledHeight * _pooledWidth;
+    const auto isMax = _mode == opset::ROIAlign::PoolingMode::MAX;
+    ForEachChannelBlock<T>(_numRois, _channels, [&] (auto lanes, std::size_t roi, std::size_t c) {
+        using Lanes = decltype(lanes);
+        const auto* data = featureMaps + (static_cast<std::size_t>(batchIndices[roi]) * _channels + c) * spatialSize;
+        auto* out = output + (roi * _channels + c) * pooledSize;
+        const auto numSamples = _numSamples[roi];
+        const auto divisor = Lanes::Dup(static_cast<float>(numSamples));
+        const auto* sample = _tables[roi].data();
+        for (std::size_t bin = 0; bin < pooledSize; ++bin) {
+            auto value = Lanes::Dup(0.f);
+            for (std::size_t i = 0; i < numSamples; ++i, ++sample) {
+                const auto v0 = Lanes::Mul(Lanes::Dup(sample->weights[0]), Lanes::Gather(data, spatialSize, sample->offsets[0]));
+                const auto v1 = Lanes::Mul(Lanes::Dup(sample->weights[1]), Lanes::Gather(data, spatialSize, sample->offsets[1]));
+                const auto v2 = Lanes::Mul(Lanes::Dup(sample->weights[2]), Lanes::Gather(data, spatialSize, sample->offsets[2]));
+                const auto v3 = Lanes::Mul(Lanes::Dup(sample->weights[3]), Lanes::Gather(data, spatialSize, sample->offsets[3]));
+                if (isMax) {
+                    value = Lanes::Max(Lanes::Max(Lanes::Max(Lanes::Max(v0, v1), v2), v3), value);
+                } else {
+                    value = Lanes::Add(value, Lanes::Div(Lanes::Add(Lanes::Add(Lanes::Add(v0, v1), v2), v3), divisor));
+                }
+            }
+            Lanes::Scatter(out + bin, pooledSize, value);
+        }
+    });
+}
+
+#define INSTANTIATE_ROI_ALIGN(T)                    \
+    template class ROIAlign<T, std::int8_t>;        \
+    template class ROIAlign<T, std::uint8_t>;       \
+    template class ROIAlign<T, std::int16_t>;       \
+    template class ROIAlign<T, std::uint16_t>;      \
+    template class ROIAlign<T, std::int32_t>;       \
+    template class ROIAlign<T, std::uint32_t>;      \
+    template class ROIAlign<T, std::int64_t>;
+
+INSTANTIATE_ROI_ALIGN(float)
+INSTANTIATE_ROI_ALIGN(ngraph::float16)
+#undef INSTANTIATE_ROI_ALIGN
+
+template<typename T>
+ROIPooling<T>::ROIPooling(const ngraph::Shape& featureMapsShape,
+                          const ngraph::Shape& roisShape,
+                          const ngraph::Shape& outputShape,
+                          float spatialScale,
+                          const std::string& method) :
+    _batches{featureMapsShape.at(0)},
+    _channels{featureMapsShape.at(1)},
+    _height{featureMapsShape.at(2)},
+    _width{featureMapsShape.at(3)},
+    _numRois{roisShape.at(0)},
+    _roiSize{roisShape.at(1)},
+    _pooledHeight{outputShape.at(2)},
+    _pooledWidth{outputShape.at(3)},
+    _spatialScale{spatialScale},
+    _bilinear{method == "bilinear"},
+    _batchIds(_numRois, 0) {
+    if (!_bilinear && method != "max") {
+        IE_THROW() << "Arm Plugin: unsupported ROIPooling method: " << method;
+    }
+    if (_bilinear) {
+        _points.resize(_numRois, std::vector<Point>(_pooledHeight * _pooledWidth));
+    } else {
+        _rows.resize(_numRois, std::vector<Range>(_pooledHeight));
+        _columns.resize(_numRois, std::vector<Range>(_pooledWidth));
+    }
+}
+
+template<typename T>
+void ROIPooling<T>::PrepareTable(const T* roi, std::size_t index) {
+    const auto batchId = static_cast<int>(roi[0]);
+    if (batchId < 0 || batchId >= static_cast<int>(_batches)) {
+        IE_THROW() << "Arm Plugin: ROI batch id must be in the range of [0, N-1]";
+    }
+    _batchIds[index] = batchId;
+
+    const auto height = static_cast<int>(_height);
+    const auto width = static_cast<int>(_width);
+    const auto pooledHeight = static_cast<int>(_pooledHeight);
+    const auto pooledWidth = static_cast<int>(_pooledWidth);
+    if (!_bilinear) {
+        const auto roiWStart = static_cast<int>(std::round(static_cast<float>(roi[1]) * _spatialScale));
+        const auto roiHStart = static_cast<int>(std::round(static_cast<float>(roi[2]) * _spatialScale));
+        const auto roiWEnd = static_cast<int>(std::round(static_cast<float>(roi[3]) * _spatialScale));
+        const auto roiHEnd = static_cast<int>(std::round(static_cast<float>(roi[4]) * _spatialScale));
+
+        // Malformed ROIs are forced to be 1x1
+        const auto roiHeight = std::max(roiHEnd - roiHStart + 1, 1);
+        const auto roiWidth = std::max(roiWEnd - roiWStart + 1, 1);
+        const auto binSizeH = static_cast<float>(roiHeight) / pooledHeight;
+        const auto binSizeW = static_cast<float>(roiWidth) / pooledWidth;
+
+        // Bins are separable, so only ranges of rows and columns are kept
+        auto range = [] (int bin, float binSize, int roiStart, int size) {
+            const auto start = static_cast<int>(std::floor(bin * binSize));
+            const auto end = static_cast<int>(std::ceil((bin + 1) * binSize));
+            return Range{std::min(std::max(start + roiStart, 0), size), std::min(std::max(end + roiStart, 0), size)};
+        };
+        for (int ph = 0; ph < pooledHeight; ++ph) {
+            _rows[index][ph] = range(ph, binSizeH, roiHStart, height);
+        }
+        for (int pw = 0; pw < pooledWidth; ++pw) {
+            _columns[index][pw] = range(pw, binSizeW, roiWStart, width);
+        }
+    } else {
+        const auto roiWStart = static_cast<float>(roi[1]);
+        const auto roiHStart = static_cast<float>(roi[2]);
+        const auto roiWEnd = static_cast<float>(roi[3]);
+        const auto roiHEnd = static_cast<float>(roi[4]);
+
+        const auto roiHeight = (roiHEnd - roiHStart) * (height - 1);
+        const auto roiWidth = (roiWEnd - roiWStart) * (width - 1);
+        const auto roiHeightScale = (pooledHeight > 1) ? roiHeight / (pooledHeight - 1) : 0.f;
+        const auto roiWidthScale = (pooledWidth > 1) ? roiWidth / (pooledWidth - 1) : 0.f;
+
+        auto* point = _points[index].data();
+        for (int ph = 0; ph < pooledHeight; ++ph) {
+            for (int pw = 0; pw < pooledWidth; ++pw, ++point) {
+                const auto inY = (pooledHeight > 1) ? (ph * roiHeightScale + roiHStart * (height - 1))
+                                                    : static_cast<float>(0.5 * (roiHStart + roiHEnd) * (height - 1));
+                const auto inX = (pooledWidth > 1) ? (pw * roiWidthScale + roiWStart * (width - 1))
+                                                   : static_cast<float>(0.5 * (roiWStart + roiWEnd) * (width - 1));
+                // Pooling regions out of the feature map are zeros
+                if (inY < 0 || inY > height - 1 || inX < 0 || inX > width - 1) {
+                    point->valid = false;
+                    continue;
+                }
+                const auto top = static_cast<int>(std::floor(inY));
+                const auto bottom = std::min(static_cast<int>(std::ceil(inY)), height - 1);
+                const auto left = static_cast<int>(std::floor(inX));
+                const auto right = std::min(static_cast<int>(std::ceil(inX)), width - 1);
+                *point = Point{true,
+                               {static_cast<std::size_t>(top * width + left), static_cast<std::size_t>(top * width + right),
+                                static_cast<std::size_t>(bottom * width + left), static_cast<std::size_t>(bottom * width + right)},
+                               inX - left, inY - top};
+            }
+        }
+    }
+}
+
+template<typename T>
+void ROIPooling<T>::operator()(const T* featureMaps, const T* rois, T* output) {
+    InferenceEngine::parallel_for(_numRois, [&] (std::size_t roi) {
+        PrepareTable(rois + _roiSize * roi, roi);
+    });
+
+    const auto spatialSize = _height * _width;
+    const auto pooledSize = _pooledHeight * _pooledWidth;
+    ForEachChannelBlock<T>(_numRois, _channels, [&] (auto lanes, std::size_t roi, std::size_t c) {
+        using Lanes = decltype(lanes);
+        const auto* data = featureMaps + (_batchIds[roi] * _channels + c) * spatialSize;
+        auto* out = output + (roi * _channels + c) * pooledSize;
+        if (!_bilinear) {
+            for (std::size_t ph = 0; ph < _pooledHeight; ++ph) {
+                const auto& rows = _rows[roi][ph];
+                for (std::size_t pw = 0; pw < _pooledWidth; ++pw) {
+                    const auto& columns = _columns[roi][pw];
+                    // Empty pooling regions are zeros
+                    const auto isEmpty = (rows.end <= rows.begin) || (columns.end <= columns.begin);
+                    auto value = Lanes::Dup(isEmpty ? 0.f : std::numeric_limits<float>::lowest());
+                    for (auto h = rows.begin; h < rows.end; ++h) {
+                        for (auto w = columns.begin; w < columns.end; ++w) {
+                            value = Lanes::Max(Lanes::Gather(data, spatialSize, h * _width + w), value);
+                        }
+                    }
+                    Lanes::Scatter(out + ph * _pooledWidth + pw, pooledSize, value);
+                }
+            }
+        } else {
+            const auto* point = _points[roi].data();
+            for (std::size_t bin = 0; bin < pooledSize; ++bin, ++point) {
+                auto value = Lanes::Dup(0.f);
+                if (point->valid) {
+                    const auto topLeft = Lanes::Gather(data, spatialSize, point->offsets[0]);
+                    const auto topRight = Lanes::Gather(data, spatialSize, point->offsets[1]);
+                    const auto bottomLeft = Lanes::Gather(data, spatialSize, point->offsets[2]);
+                    const auto bottomRight = Lanes::Gather(data, spatialSize, point->offsets[3]);
+                    const auto dx = Lanes::Dup(point->dx);
+                    const auto top = Lanes::Add(topLeft, Lanes::Mul(Lanes::Sub(topRight, topLeft), dx));
+                    const auto bottom = Lanes::Add(bottomLeft, Lanes::Mul(Lanes::Sub(bottomRight, bottomLeft), dx));
+                    value = Lanes::Add(top, Lanes::Mul(Lanes::Sub(bottom, top), Lanes::Dup(point->dy)));
+                }
+                Lanes::Scatter(out + bin, pooledSize, value);
+            }
+        }
+    });
+}
+
+template class ROIPooling<float>;
+template class ROIPooling<ngraph::float16>;
+
+template<typename T>
+PSROIPooling<T>::PSROIPooling(const ngraph::Shape& inputShape,
+                              const ngraph::Shape& outputShape,
+                              const std::string& mode,
+                              float spatialScale,
+                              int spatialBinsX,
+                              int spatialBinsY) :
+    _channelsIn{inputShape.at(1)},
+    _height{inputShape.at(2)},
+    _width{inputShape.at(3)},
+    _numRois{outputShape.at(0)},
+    _channelsOut{outputShape.at(1)},
+    _pooledHeight{outputShape.at(2)},
+    _pooledWidth{outputShape.at(3)},
+    _spatialScale{spatialScale},
+    _spatialBinsX{spatialBinsX},
+    _spatialBinsY{spatialBinsY},
+    _bilinear{mode == "bilinear"},
+    _batchIds(_numRois, 0) {
+    if (!_bilinear && mode != "average") {
+        IE_THROW() << "Arm Plugin: unsupported PSROIPooling mode: " << mode;
+    }
+    const auto pooledSize = _pooledHeight * _pooledWidth;
+    if (_bilinear) {
+        _points.resize(_numRois, std::vector<Point>(pooledSize * _spatialBinsX * _spatialBinsY));
+    } else {
+        _bins.resize(_numRois, std::vector<Bin>(pooledSize));
+    }
+}
+
+template<typename T>
+void PSROIPooling<T>::PrepareTable(const T* roi, std::size_t index) {
+    _batchIds[index] = static_cast<std::size_t>(static_cast<int>(roi[0]));
+    if (!_bilinear) {
+        const auto startW = std::roundf(static_cast<float>(roi[1])) * _spatialScale;
+        const auto startH = std::roundf(static_cast<float>(roi[2])) * _spatialScale;
+        const auto endW = (std::roundf(static_cast<float>(roi[3])) + 1.0f) * _spatialScale;
+        const auto endH = (std::roundf(static_cast<float>(roi[4])) + 1.0f) * _spatialScale;
+        const auto binWidth = (endW - startW) / _pooledWidth;
+        const auto binHeight = (endH - startH) / _pooledHeight;
+
+        auto* bin = _bins[index].data();
+        for (std::size_t ph = 0; ph < _pooledHeight; ++ph) {
+            for (std::size_t pw = 0; pw < _pooledWidth; ++pw, ++bin) {
+                const auto binStartW = std::min(static_cast<std::size_t>(startW + std::floor(pw * binWidth)), _width - 1);
+                const auto binStartH = std::min(static_cast<std::size_t>(startH + std::floor(ph * binHeight)), _height - 1);
+                const auto binEndW = std::min(static_cast<std::size_t>(startW + std::ceil((pw + 1) * binWidth)), _width);
+                const auto binEndH = std::min(static_cast<std::size_t>(startH + std::ceil((ph + 1) * binHeight)), _height);
+                *bin = Bin{binStartH * _width + binStartW, binEndW - binStartW, binEndH - binStartH};
+            }
+        }
+    } else {
+        const auto startW = static_cast<float>(roi[1]) * _spatialScale;
+        const auto startH = static_cast<float>(roi[2]) * _spatialScale;
+        const auto endW = static_cast<float>(roi[3]) * _spatialScale;
+        const auto endH = static_cast<float>(roi[4]) * _spatialScale;
+        const auto binWidth = (endW - startW) / _spatialBinsX;
+        const auto binHeight = (endH - startH) / _spatialBinsY;
+        const auto widthScale = _pooledWidth > 1 ? binWidth * (_width - 1) / (_pooledWidth - 1) : 0.f;
+        const auto heightScale = _pooledHeight > 1 ? binHeight * (_height - 1) / (_pooledHeight - 1) : 0.f;
+
+        auto* point = _points[index].data();
+        for (std::size_t ph = 0; ph < _pooledHeight; ++ph) {
+            for (std::size_t pw = 0; pw < _pooledWidth; ++pw) {
+                for (int sby = 0; sby < _spatialBinsY; ++sby) {
+                    for (int sbx = 0; sbx < _spatialBinsX; ++sbx, ++point) {
+                        const auto binStartW = startW + sbx * binWidth;
+                        const auto binStartH = startH + sby * binHeight;
+                        const auto pointX = _pooledWidth > 1 ? (pw * widthScale + binStartW * (_width - 1))
+                                                             : (binStartW + binStartW + binWidth) * (_width - 1) / 2;
+                        const auto pointY = _pooledHeight > 1 ? (ph * heightScale + binStartH * (_height - 1))
+                                                              : (binStartH + binStartH + binHeight) * (_height - 1) / 2;
+                        if (!(pointX < _width && pointY < _height)) {
+                            point->valid = false;
+                            continue;
+                        }
+                        const auto left = static_cast<std::size_t>(std::floor(pointX));
+                        const auto right = std::min(static_cast<std::size_t>(std::ceil(pointX)), _width - 1);
+                        const auto top = static_cast<std::size_t>(std::floor(pointY));
+                        const auto bottom = std::min(static_cast<std::size_t>(std::ceil(pointY)), _height - 1);
+                        *point = Point{true,
+                                       {top * _width + left, top * _width + right, bottom * _width + left, bottom * _width + right},
+                                       pointX - left, pointY - top};
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void PSROIPooling<T>::operator()(const T* input, const T* rois, T* output) {
+    InferenceEngine::parallel_for(_numRois, [&] (std::size_t roi) {
+        PrepareTable(rois + 5 * roi, roi);
+    });
+
+    const auto spatialSize = _height * _width;
+    const auto pooledSize = _pooledHeight * _pooledWidth;
+    const auto numSpatialBins = static_cast<std::size_t>(_spatialBinsX * _spatialBinsY);
+    ForEachChannelBlock<T>(_numRois, _channelsOut, [&] (auto lanes, std::size_t roi, std::size_t c) {
+        using Lanes = decltype(lanes);
+        const auto* data = input + _batchIds[roi] * _channelsIn * spatialSize;
+        auto* out = output + (roi * _channelsOut + c) * pooledSize;
+        if (!_bilinear) {
+            // Each bin of an output channel is pooled from its own input channel, output channels are pooledSize input channels apart
+            const auto stride = pooledSize * spatialSize;
+            const auto* bin = _bins[roi].data();
+            for (std::size_t b = 0; b < pooledSize; ++b, ++bin) {
+                const auto* binData = data + (c * pooledSize + b) * spatialSize + bin->offset;
+                auto sum = Lanes::Dup(0.f);
+                for (std::size_t h = 0; h < bin->height; ++h) {
+                    for (std::size_t w = 0; w < bin->width; ++w) {
+                        sum = Lanes::Add(sum, Lanes::Gather(binData, stride, h * _width + w));
+                    }
+                }
+                Lanes::Scatter(out + b, pooledSize, Lanes::Div(sum, Lanes::Dup(static_cast<float>(bin->width * bin->height))));
+            }
+        } else {
+            // Spatial bin k of an output channel c is interpolated from the input channel k * channelsOut + c
+            const auto* point = _points[roi].data();
+            for (std::size_t b = 0; b < pooledSize; ++b) {
+                auto value = Lanes::Dup(0.f);
+                for (std::size_t k = 0; k < numSpatialBins; ++k, ++point) {
+                    if (!point->valid) {
+                        continue;
+                    }
+                    const auto* binData = data + (k * _channelsOut + c) * spatialSize;
+                    const auto topLeft = Lanes::Gather(binData, spatialSize, point->offsets[0]);
+                    const auto topRight = Lanes::Gather(binData, spatialSize, point->offsets[1]);
+                    const auto bottomLeft = Lanes::Gather(binData, spatialSize, point->offsets[2]);
+                    const auto bottomRight = Lanes::Gather(binData, spatialSize, point->offsets[3]);
+                    const auto dx = Lanes::Dup(point->dx);
+                    const auto top = Lanes::Add(topLeft, Lanes::Mul(Lanes::Sub(topRight, topLeft), dx));
+                    const auto bottom = Lanes::Add(bottomLeft, Lanes::Mul(Lanes::Sub(bottomRight, bottomLeft), dx));
+                    value = Lanes::Add(value, Lanes::Add(top, Lanes::Mul(Lanes::Sub(bottom, top), Lanes::Dup(point->dy))));
+                }
+                Lanes::Scatter(out + b, pooledSize, Lanes::Div(value, Lanes::Dup(static_cast<float>(numSpatialBins))));
+            }
+        }
+    });
+}
+
+template class PSROIPooling<float>;
+template class PSROIPooling<ngraph::float16>;
+}  // namespace ArmPlugin
@@ -0,0 +1,145 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "opset/opset.hpp"
+
+namespace ArmPlugin {
+/**
+ * @brief ROI operations used instead of the reference ones. Results are the same as the reference ones.
+ * Sampling points and interpolation weights of a ROI are computed once into a table, which is shared by all channels.
+ * ROIs and blocks of channels are processed in parallel, f32 channels are processed by four at once with NEON.
+ * Tables are kept between runs, so their memory is allocated only while they grow.
+ */
+template<typename T, typename U>
+class ROIAlign {
+public:
+    ROIAlign(const ngraph::Shape& featureMapsShape,
+             const ngraph::Shape& roisShape,
+             std::size_t pooledHeight,
+             std::size_t pooledWidth,
+             int samplingRatio,
+             float spatialScale,
+             opset::ROIAlign::PoolingMode mode);
+
+    void operator()(const T* featureMaps, const T* rois, const U* batchIndices, T* output);
+
+private:
+    struct Sample {
+        std::size_t offsets[4];
+        float       weights[4];
+    };
+
+    void PrepareTable(const T* roi, std::size_t index);
+
+    std::size_t                         _channels;
+    std::size_t                         _height;
+    std::size_t                         _width;
+    std::size_t                         _numRois;
+    std::size_t                         _pooledHeight;
+    std::size_t                         _pooledWidth;
+    int                                 _samplingRatio;
+    float                               _spatialScale;
+    opset::ROIAlign::PoolingMode        _mode;
+    std::vector<std::vector<Sample>>    _tables;
+    std::vector<std::size_t>            _numSamples;
+};
+
+/**
+ * @brief ROIPooling-0 with max and bilinear methods, see ROIAlign
+ */
+template<typename T>
+class ROIPooling {
+public:
+    ROIPooling(const ngraph::Shape& featureMapsShape,
+               const ngraph::Shape& roisShape,
+               const ngraph::Shape& outputShape,
+               float spatialScale,
+               const std::string& method);
+
+    void operator()(const T* featureMaps, const T* rois, T* output);
+
+private:
+    struct Range {
+        int begin;
+        int end;
+    };
+    struct Point {
+        bool        valid;
+        std::size_t offsets[4];
+        float       dx;
+        float       dy;
+    };
+
+    void PrepareTable(const T* roi, std::size_t index);
+
+    std::size_t                         _batches;
+    std::size_t                         _channels;
+    std::size_t                         _height;
+    std::size_t                         _width;
+    std::size_t                         _numRois;
+    std::size_t                         _roiSize;
+    std::size_t                         _pooledHeight;
+    std::size_t                         _pooledWidth;
+    float                               _spatialScale;
+    bool                                _bilinear;
+    std::vector<std::size_t>            _batchIds;
+    std::vector<std::vector<Range>>     _rows;
+    std::vector<std::vector<Range>>     _columns;
+    std::vector<std::vector<Point>>     _points;
+};
+
+/**
+ * @brief PSROIPooling-0 with average and bilinear modes, see ROIAlign.
+ * Output channels are processed by four at once.
+ */
+template<typename T>
+class PSROIPooling {
+public:
+    PSROIPooling(const ngraph::Shape& inputShape,
+                 const ngraph::Shape& outputShape,
+                 const std::string& mode,
+                 float spatialScale,
+                 int spatialBinsX,
+                 int spatialBinsY);
+
+    void operator()(const T* input, const T* rois, T* output);
+
+private:
+    struct Bin {
+        std::size_t offset;
+        std::size_t width;
+        std::size_t height;
+    };
+    struct Point {
+        bool        valid;
+        std::size_t offsets[4];
+        float       dx;
+        float       dy;
+    };
+
+    void PrepareTable(const T* roi, std::size_t index);
+
+    std::size_t                         _channelsIn;
+    std::size_t                         _height;
+    std::size_t                         _width;
+    std::size_t                         _numRois;
+    std::size_t                         _channelsOut;
+    std::size_t                         _pooledHeight;
+    std::size_t                         _pooledWidth;
+    float                               _spatialScale;
+    int                                 _spatialBinsX;
+    int                                 _spatialBinsY;
+    bool                                _bilinear;
+    std::vector<std::size_t>            _batchIds;
+    std::vector<std::vector<Bin>>       _bins;
+    std::vector<std::vector<Point>>     _points;
+};
+}  // namespace ArmPlugin
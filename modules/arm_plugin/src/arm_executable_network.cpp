@@ -21,6 +21,7 @@
 #include "arm_plugin.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_serializer.hpp"
 
 using namespace InferenceEngine;
 using namespace ArmPlugin;
@@ -32,7 +33,8 @@ ArmPlugin::ExecutableNetwork::ExecutableNetwork(const std::shared_ptr<const ov::
     ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     _model{model},
     _cfg{cfg},
-    _plugin{plugin} {
+    _plugin{plugin},
+    _sharedWeights{std::make_shared<SharedWeights>()} {
     InitExecutor();
 }
 
@@ -113,3 +115,13 @@ std::shared_ptr<ov::Model> ArmPlugin::ExecutableNetwork::GetExecGraphInfo() {
     }
     return std::const_pointer_cast<ov::Model>(_model);
 }
+
+void ArmPlugin::ExecutableNetwork::Export(std::ostream& modelStream) {
+    BlobWriter writer{modelStream};
+    writer.Write(_cfg);
+    writer.Write(_networkInputs);
+    writer.Write(_networkOutputs);
+    writer.WriteParameters(getInputs());
+    writer.WriteResults(getOutputs());
+    writer.Write(*_model);
+}
@@ -34,6 +34,7 @@ struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDe
     InferenceEngine::Parameter GetMetric(const std::string& name) const override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
     std::shared_ptr<ov::Model> GetExecGraphInfo() override;
+    void Export(std::ostream& modelStream) override;
 
     void InitExecutor();
 
@@ -42,5 +43,6 @@ struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDe
     std::shared_ptr<Plugin>                                 _plugin;
     std::atomic_int                                         _requestId = {0};
     InferenceEngine::ITaskExecutor*                         _executor = nullptr;
+    SharedWeights::Ptr                                      _sharedWeights;
 };
 }  // namespace ArmPlugin
@@ -60,9 +60,14 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
     auto requestID = std::to_string(_executableNetwork->_requestId.fetch_add(1));
     Layer::Map layers;
     IE_ASSERT(_executableNetwork->_executor != nullptr);
+    auto& sharedWeights = *(_executableNetwork->_sharedWeights);
     _executableNetwork->_executor->runAndWait({
         [&] {
-            layers = Converter{_executableNetwork->_model, _executableNetwork->_cfg}.Configure(_memoryManager, *_memoryGroup);
+            std::lock_guard<std::mutex> lock{sharedWeights._mutex};
+            if (!sharedWeights._prepared) {
+                sharedWeights.Prepare(_executableNetwork->_model, _executableNetwork->_cfg);
+            }
+            layers = Converter{_executableNetwork->_model, _executableNetwork->_cfg, &sharedWeights}.Configure(_memoryManager, *_memoryGroup);
         }
     });
     auto allocateMemory = [] (const auto& blobName, const auto& blobDataMap, auto& blobs, auto tensor, auto output) {
@@ -150,6 +155,18 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
     IE_ASSERT(!_outputInfo.empty());
     _memoryManager->populate(_allocator, 1);
     _memoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memoryGroup);
+    // Functions are prepared here rather than on the first inference, because the weights manager
+    // which provides them with weights transformed by the prototype layers is not thread safe
+    _executableNetwork->_executor->runAndWait({
+        [&] {
+            std::lock_guard<std::mutex> lock{sharedWeights._mutex};
+            for (auto&& layer : layers) {
+                if (layer.second._function != nullptr) {
+                    layer.second._function->prepare();
+                }
+            }
+        }
+    });
     for (auto&& node : _executableNetwork->_model->get_ordered_ops()) {
         auto& layer = layers.at(node->get_instance_id());
         auto execType = layer._execType;
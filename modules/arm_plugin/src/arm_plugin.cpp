@@ -30,6 +30,7 @@
 #include "arm_plugin.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_serializer.hpp"
 #include "transformations/arm_optimizations.hpp"
 
 using namespace InferenceEngine;
@@ -82,6 +83,28 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(cons
     return std::make_shared<ExecutableNetwork>(transformedModel, cfg, std::static_pointer_cast<Plugin>(shared_from_this()));
 }
 
+InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                                       const ConfigMap& config) {
+    BlobReader reader{networkModel};
+    auto exportedCfg = reader.ReadConfiguration(_cfg);
+    auto cfg = Configuration{config, exportedCfg};
+    // The model was transformed and its tensor types were chosen with these options, so they can not be changed
+    cfg._lpt = exportedCfg._lpt;
+    cfg._ref = exportedCfg._ref;
+    auto networkInputs = reader.ReadInputs();
+    auto networkOutputs = reader.ReadOutputs();
+    auto parameters = reader.ReadParameters();
+    auto results = reader.ReadResults();
+    auto model = reader.ReadModel(cfg);
+    auto executableNetwork = std::make_shared<ExecutableNetwork>(model, cfg, std::static_pointer_cast<Plugin>(shared_from_this()));
+    executableNetwork->setNetworkInputs(networkInputs);
+    executableNetwork->setNetworkOutputs(networkOutputs);
+    executableNetwork->setInputs(parameters);
+    executableNetwork->setOutputs(results);
+    executableNetwork->SetPointerToPlugin(shared_from_this());
+    return executableNetwork;
+}
+
 QueryNetworkResult Plugin::QueryNetwork(const CNNNetwork& network, const ConfigMap& config) const {
     QueryNetworkResult res;
     Configuration cfg{config, _cfg, false};
@@ -176,6 +199,7 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, std::vector<std::string>{
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(IMPORT_EXPORT_SUPPORT),
             ov::range_for_async_infer_requests.name(),
             ov::range_for_streams.name()});
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
@@ -203,6 +227,8 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
             supported_properties.emplace_back(configKey, ov::PropertyMutability::RW);
         }
         return decltype(ov::supported_properties)::value_type{supported_properties};
+    } else if (METRIC_KEY(IMPORT_EXPORT_SUPPORT) == name) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else if (ov::available_devices == name) {
         return decltype(ov::available_devices)::value_type{"NEON"};
     } else if (ov::device::full_name == name) {
@@ -218,7 +244,8 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
             ov::device::capability::FP16,
 #endif
-            ov::device::capability::FP32};
+            ov::device::capability::FP32,
+            ov::device::capability::EXPORT_IMPORT};
     } else {
         IE_THROW() << "Unsupported device metric: " << name;
     }
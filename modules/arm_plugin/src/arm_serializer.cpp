@@ -0,0 +1,558 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <ie_common.h>
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/runtime/aligned_buffer.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/result.hpp>
+
+#include "arm_serializer.hpp"
+#include "arm_converter/arm_converter.hpp"
+
+using namespace InferenceEngine;
+using namespace ArmPlugin;
+
+namespace {
+// Should be increased on any change of the blob layout or of attributes of ArmPlugin opset nodes
+constexpr std::uint32_t blobVersion = 1;
+constexpr char blobMagic[] = "ARM_CPU_BLOB";
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = true>
+void Write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void Write(std::ostream& stream, const std::string& value) {
+    Write(stream, static_cast<std::uint64_t>(value.size()));
+    stream.write(value.data(), value.size());
+}
+
+template<typename T>
+void Write(std::ostream& stream, const std::vector<T>& values) {
+    Write(stream, static_cast<std::uint64_t>(values.size()));
+    for (auto&& value : values) {
+        Write(stream, value);
+    }
+}
+
+void Write(std::ostream& stream, const std::unordered_set<std::string>& values) {
+    Write(stream, static_cast<std::uint64_t>(values.size()));
+    for (auto&& value : values) {
+        Write(stream, value);
+    }
+}
+
+void Check(std::istream& stream) {
+    if (!stream) {
+        IE_THROW(NetworkNotRead) << "Arm Plugin: unexpected end of the network blob";
+    }
+}
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = true>
+void Read(std::istream& stream, T& value) {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    Check(stream);
+}
+
+// Returns the number of bytes left in the stream or the maximal value if the stream is not seekable
+std::uint64_t Remaining(std::istream& stream) {
+    const auto position = stream.tellg();
+    if (position == std::istream::pos_type(-1)) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(position);
+    Check(stream);
+    return static_cast<std::uint64_t>(end - position);
+}
+
+// Reads a number of stored items, each of them takes at least itemSize bytes in the blob.
+// The number is checked against the rest of the stream, so a corrupted blob fails before anything is allocated
+std::uint64_t ReadSize(std::istream& stream, std::uint64_t itemSize) {
+    std::uint64_t size = 0;
+    Read(stream, size);
+    if (size > Remaining(stream) / itemSize) {
+        IE_THROW(NetworkNotRead) << "Arm Plugin: size " << size << " exceeds the rest of the network blob";
+    }
+    return size;
+}
+
+void Read(std::istream& stream, std::string& value) {
+    constexpr std::uint64_t chunkSize = 1 << 16;
+    const auto size = ReadSize(stream, 1);
+    // Read by chunks, so sizes are also limited by the data really stored in not seekable streams
+    value.clear();
+    while (value.size() < size) {
+        const auto offset = value.size();
+        const auto count = std::min(chunkSize, size - offset);
+        value.resize(offset + count);
+        stream.read(&value[offset], count);
+        Check(stream);
+    }
+}
+
+template<typename T>
+void Read(std::istream& stream, std::vector<T>& values) {
+    const auto size = ReadSize(stream, std::is_arithmetic<T>::value ? sizeof(T) : sizeof(std::uint64_t));
+    values.clear();
+    for (std::uint64_t i = 0; i < size; ++i) {
+        T value;
+        Read(stream, value);
+        values.push_back(std::move(value));
+    }
+}
+
+void Read(std::istream& stream, std::unordered_set<std::string>& values) {
+    std::vector<std::string> names;
+    Read(stream, names);
+    values = {names.begin(), names.end()};
+}
+
+template<typename T>
+T Read(std::istream& stream) {
+    T value;
+    Read(stream, value);
+    return value;
+}
+
+using BufferAdapter = ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
+struct AttributeWriter : public ngraph::AttributeVisitor {
+    explicit AttributeWriter(std::ostream& stream) : _stream{stream} {}
+
+    template<typename T>
+    void WriteValue(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        Write(_stream, name);
+        Write(_stream, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        auto bufferAdapter = ov::as_type<BufferAdapter>(&adapter);
+        if (bufferAdapter == nullptr) {
+            IE_THROW(NotImplemented) << "Arm Plugin: attribute " << name << " can not be exported";
+        }
+        const auto& buffer = bufferAdapter->get();
+        const auto size = buffer == nullptr ? std::uint64_t{0} : static_cast<std::uint64_t>(buffer->size());
+        Write(_stream, name);
+        Write(_stream, size);
+        if (size != 0) {
+            _stream.write(buffer->get_ptr<char>(), size);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int8_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int16_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int32_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int64_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint8_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint16_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint32_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint64_t>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int8_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int16_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int32_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int64_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint8_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint16_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint32_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint64_t>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { WriteValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { WriteValue(name, adapter); }
+
+    std::ostream&   _stream;
+};
+
+struct AttributeReader : public ngraph::AttributeVisitor {
+    explicit AttributeReader(std::istream& stream) : _stream{stream} {}
+
+    void ReadName(const std::string& name) {
+        auto storedName = Read<std::string>(_stream);
+        if (storedName != name) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: attribute " << name << " is expected in the network blob, got " << storedName;
+        }
+    }
+
+    template<typename T>
+    void ReadValue(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        ReadName(name);
+        adapter.set(Read<T>(_stream));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        auto bufferAdapter = ov::as_type<BufferAdapter>(&adapter);
+        if (bufferAdapter == nullptr) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: attribute " << name << " can not be imported";
+        }
+        ReadName(name);
+        auto size = ReadSize(_stream, 1);
+        auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(size);
+        if (size != 0) {
+            _stream.read(buffer->get_ptr<char>(), size);
+            Check(_stream);
+        }
+        bufferAdapter->set(buffer);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int8_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int16_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int32_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int64_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint8_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint16_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint32_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::uint64_t>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int8_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int16_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int32_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int64_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint8_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint16_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint32_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint64_t>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { ReadValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { ReadValue(name, adapter); }
+
+    std::istream&   _stream;
+};
+
+// Types of rt_info values which are used by the converter and kept in the blob
+enum class RtInfoType : std::uint8_t {
+    String,
+    QuantizationInfo,
+    ActivationLayerInfo
+};
+
+void WriteRtInfo(std::ostream& stream, const ov::RTMap& rtInfo) {
+    std::vector<std::pair<std::string, const ov::Any*>> values;
+    for (auto&& item : rtInfo) {
+        if (item.second.is<std::string>() ||
+            item.second.is<arm_compute::QuantizationInfo>() ||
+            item.second.is<arm_compute::ActivationLayerInfo>()) {
+            values.emplace_back(item.first, &item.second);
+        }
+    }
+    Write(stream, static_cast<std::uint64_t>(values.size()));
+    for (auto&& value : values) {
+        Write(stream, value.first);
+        const auto& any = *value.second;
+        if (any.is<std::string>()) {
+            Write(stream, static_cast<std::uint8_t>(RtInfoType::String));
+            Write(stream, any.as<std::string>());
+        } else if (any.is<arm_compute::QuantizationInfo>()) {
+            const auto& info = any.as<arm_compute::QuantizationInfo>();
+            Write(stream, static_cast<std::uint8_t>(RtInfoType::QuantizationInfo));
+            Write(stream, info.scale());
+            Write(stream, info.offset());
+        } else {
+            const auto& info = any.as<arm_compute::ActivationLayerInfo>();
+            Write(stream, static_cast<std::uint8_t>(RtInfoType::ActivationLayerInfo));
+            Write(stream, info.enabled());
+            Write(stream, static_cast<std::int32_t>(info.activation()));
+            Write(stream, info.a());
+            Write(stream, info.b());
+        }
+    }
+}
+
+void ReadRtInfo(std::istream& stream, ov::RTMap& rtInfo) {
+    auto size = ReadSize(stream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto key = Read<std::string>(stream);
+        auto type = static_cast<RtInfoType>(Read<std::uint8_t>(stream));
+        switch (type) {
+            case RtInfoType::String : {
+                rtInfo[key] = Read<std::string>(stream);
+            } break;
+            case RtInfoType::QuantizationInfo : {
+                auto scale = Read<std::vector<float>>(stream);
+                auto offset = Read<std::vector<std::int32_t>>(stream);
+                rtInfo[key] = arm_compute::QuantizationInfo{scale, offset};
+            } break;
+            case RtInfoType::ActivationLayerInfo : {
+                auto enabled = Read<bool>(stream);
+                auto activation = static_cast<arm_compute::ActivationLayerInfo::ActivationFunction>(Read<std::int32_t>(stream));
+                auto a = Read<float>(stream);
+                auto b = Read<float>(stream);
+                rtInfo[key] = enabled ? arm_compute::ActivationLayerInfo{activation, a, b} : arm_compute::ActivationLayerInfo{};
+            } break;
+            default: IE_THROW(NetworkNotRead) << "Arm Plugin: unsupported type of rt_info " << key << " in the network blob";
+        }
+    }
+}
+
+// Writes output element type, shape and tensor names of an input or output node of the network
+void WriteOutputDesc(std::ostream& stream, const ov::Node& node, const std::size_t index) {
+    AttributeWriter writer{stream};
+    auto elementType = node.get_output_element_type(index);
+    auto shape = node.get_output_partial_shape(index);
+    writer.on_attribute("element_type", elementType);
+    writer.on_attribute("shape", shape);
+    Write(stream, node.get_output_tensor(index).get_names());
+}
+
+std::shared_ptr<ov::op::v0::Parameter> ReadOutputDesc(std::istream& stream) {
+    AttributeReader reader{stream};
+    ov::element::Type elementType;
+    ov::PartialShape shape;
+    reader.on_attribute("element_type", elementType);
+    reader.on_attribute("shape", shape);
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(elementType, shape);
+    parameter->output(0).get_tensor().set_names(Read<std::unordered_set<std::string>>(stream));
+    return parameter;
+}
+
+void WriteTensorDesc(std::ostream& stream, const TensorDesc& desc) {
+    Write(stream, static_cast<std::int32_t>(desc.getPrecision()));
+    Write(stream, static_cast<std::int32_t>(desc.getLayout()));
+    Write(stream, desc.getDims());
+}
+
+TensorDesc ReadTensorDesc(std::istream& stream) {
+    auto precision = static_cast<Precision::ePrecision>(Read<std::int32_t>(stream));
+    auto layout = static_cast<Layout>(Read<std::int32_t>(stream));
+    auto dims = Read<SizeVector>(stream);
+    return {precision, dims, layout};
+}
+}  // namespace
+
+BlobWriter::BlobWriter(std::ostream& stream) : _stream{stream} {
+    _stream.write(blobMagic, sizeof(blobMagic));
+    ::Write(_stream, blobVersion);
+}
+
+void BlobWriter::Write(const Configuration& cfg) {
+    ::Write(_stream, cfg._exclusiveAsyncRequests);
+    ::Write(_stream, cfg._perfCount);
+    ::Write(_stream, cfg._ref);
+    ::Write(_stream, cfg._lpt);
+    ::Write(_stream, cfg._dump);
+    ::Write(_stream, static_cast<std::int32_t>(cfg._streamsExecutorConfig._streams));
+    ::Write(_stream, static_cast<std::int32_t>(cfg._streamsExecutorConfig._threads));
+    ::Write(_stream, static_cast<std::int32_t>(cfg._streamsExecutorConfig._threadsPerStream));
+}
+
+void BlobWriter::Write(const InputsDataMap& inputs) {
+    ::Write(_stream, static_cast<std::uint64_t>(inputs.size()));
+    for (auto&& input : inputs) {
+        ::Write(_stream, input.first);
+        WriteTensorDesc(_stream, input.second->getTensorDesc());
+    }
+}
+
+void BlobWriter::Write(const OutputsDataMap& outputs) {
+    ::Write(_stream, static_cast<std::uint64_t>(outputs.size()));
+    for (auto&& output : outputs) {
+        ::Write(_stream, output.first);
+        WriteTensorDesc(_stream, output.second->getTensorDesc());
+    }
+}
+
+void BlobWriter::WriteParameters(const std::vector<std::shared_ptr<const ov::Node>>& parameters) {
+    ::Write(_stream, static_cast<std::uint64_t>(parameters.size()));
+    for (auto&& parameter : parameters) {
+        ::Write(_stream, parameter->get_friendly_name());
+        WriteOutputDesc(_stream, *parameter, 0);
+    }
+}
+
+void BlobWriter::WriteResults(const std::vector<std::shared_ptr<const ov::Node>>& results) {
+    ::Write(_stream, static_cast<std::uint64_t>(results.size()));
+    for (auto&& result : results) {
+        ::Write(_stream, result->get_friendly_name());
+        ::Write(_stream, result->get_output_tensor(0).get_names());
+        // Inputs of results are used only for names of outputs
+        auto input = result->input_value(0);
+        ::Write(_stream, input.get_node()->get_friendly_name());
+        WriteOutputDesc(_stream, *input.get_node(), input.get_index());
+    }
+}
+
+void BlobWriter::Write(const ov::Model& model) {
+    if (!model.get_sinks().empty() || !model.get_variables().empty()) {
+        IE_THROW(NotImplemented) << "Arm Plugin: export of networks with state is not supported";
+    }
+    const auto orderedOps = model.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, std::uint64_t> indices;
+    ::Write(_stream, model.get_friendly_name());
+    ::Write(_stream, static_cast<std::uint64_t>(orderedOps.size()));
+    for (auto&& node : orderedOps) {
+        const auto& typeInfo = node->get_type_info();
+        ::Write(_stream, std::string{typeInfo.name});
+        ::Write(_stream, typeInfo.get_version());
+        ::Write(_stream, node->get_friendly_name());
+        ::Write(_stream, static_cast<std::uint64_t>(node->get_input_size()));
+        for (auto&& input : node->inputs()) {
+            auto sourceOutput = input.get_source_output();
+            ::Write(_stream, indices.at(sourceOutput.get_node()));
+            ::Write(_stream, static_cast<std::uint64_t>(sourceOutput.get_index()));
+        }
+        AttributeWriter writer{_stream};
+        if (!node->visit_attributes(writer)) {
+            IE_THROW(NotImplemented) << "Arm Plugin: attributes of " << *node << " can not be exported";
+        }
+        WriteRtInfo(_stream, node->get_rt_info());
+        ::Write(_stream, static_cast<std::uint64_t>(node->get_output_size()));
+        for (auto&& output : node->outputs()) {
+            ::Write(_stream, output.get_tensor().get_names());
+        }
+        indices.emplace(node.get(), indices.size());
+    }
+    ::Write(_stream, static_cast<std::uint64_t>(model.get_parameters().size()));
+    for (auto&& parameter : model.get_parameters()) {
+        ::Write(_stream, indices.at(parameter.get()));
+    }
+    ::Write(_stream, static_cast<std::uint64_t>(model.get_results().size()));
+    for (auto&& result : model.get_results()) {
+        ::Write(_stream, indices.at(result.get()));
+    }
+}
+
+BlobReader::BlobReader(std::istream& stream) : _stream{stream} {
+    char magic[sizeof(blobMagic)] = {};
+    _stream.read(magic, sizeof(magic));
+    if (!_stream || std::memcmp(magic, blobMagic, sizeof(blobMagic)) != 0) {
+        IE_THROW(NetworkNotRead) << "Arm Plugin: the blob was not exported by Arm Plugin";
+    }
+    auto version = ::Read<std::uint32_t>(_stream);
+    if (version != blobVersion) {
+        IE_THROW(NetworkNotRead) << "Arm Plugin: the blob has format version " << version
+                                 << ", while version " << blobVersion << " is supported";
+    }
+}
+
+Configuration BlobReader::ReadConfiguration(const Configuration& defaultCfg) {
+    Configuration cfg = defaultCfg;
+    ::Read(_stream, cfg._exclusiveAsyncRequests);
+    ::Read(_stream, cfg._perfCount);
+    ::Read(_stream, cfg._ref);
+    ::Read(_stream, cfg._lpt);
+    ::Read(_stream, cfg._dump);
+    cfg._streamsExecutorConfig._streams = ::Read<std::int32_t>(_stream);
+    cfg._streamsExecutorConfig._threads = ::Read<std::int32_t>(_stream);
+    cfg._streamsExecutorConfig._threadsPerStream = ::Read<std::int32_t>(_stream);
+    return cfg;
+}
+
+InputsDataMap BlobReader::ReadInputs() {
+    InputsDataMap inputs;
+    auto size = ReadSize(_stream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto name = ::Read<std::string>(_stream);
+        auto inputInfo = std::make_shared<InputInfo>();
+        inputInfo->setInputData(std::make_shared<Data>(name, ReadTensorDesc(_stream)));
+        inputs.emplace(name, inputInfo);
+    }
+    return inputs;
+}
+
+OutputsDataMap BlobReader::ReadOutputs() {
+    OutputsDataMap outputs;
+    auto size = ReadSize(_stream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto name = ::Read<std::string>(_stream);
+        outputs.emplace(name, std::make_shared<Data>(name, ReadTensorDesc(_stream)));
+    }
+    return outputs;
+}
+
+std::vector<std::shared_ptr<const ov::Node>> BlobReader::ReadParameters() {
+    std::vector<std::shared_ptr<const ov::Node>> parameters;
+    auto size = ReadSize(_stream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto name = ::Read<std::string>(_stream);
+        auto parameter = ReadOutputDesc(_stream);
+        parameter->set_friendly_name(name);
+        parameters.emplace_back(parameter);
+    }
+    return parameters;
+}
+
+std::vector<std::shared_ptr<const ov::Node>> BlobReader::ReadResults() {
+    std::vector<std::shared_ptr<const ov::Node>> results;
+    auto size = ReadSize(_stream, sizeof(std::uint64_t));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto name = ::Read<std::string>(_stream);
+        auto names = ::Read<std::unordered_set<std::string>>(_stream);
+        auto inputName = ::Read<std::string>(_stream);
+        auto input = ReadOutputDesc(_stream);
+        input->set_friendly_name(inputName);
+        auto result = std::make_shared<ov::op::v0::Result>(input);
+        result->set_friendly_name(name);
+        result->output(0).get_tensor().set_names(names);
+        results.emplace_back(result);
+    }
+    return results;
+}
+
+std::shared_ptr<ov::Model> BlobReader::ReadModel(const Configuration& cfg) {
+    Converter converter{std::make_shared<ov::Model>(ov::ResultVector{}, ov::ParameterVector{}), cfg};
+    std::map<std::pair<std::string, std::string>, Converter::MakeNodeFn> makeNodes;
+    for (auto&& makeNode : converter._makeNodes) {
+        makeNodes.emplace(std::make_pair(std::string{makeNode.first.name}, makeNode.first.get_version()), makeNode.second);
+    }
+    auto name = ::Read<std::string>(_stream);
+    auto size = ReadSize(_stream, sizeof(std::uint64_t));
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    nodes.reserve(size);
+    for (std::uint64_t i = 0; i < size; ++i) {
+        auto typeName = ::Read<std::string>(_stream);
+        auto version = ::Read<std::string>(_stream);
+        auto itMakeNode = makeNodes.find({typeName, version});
+        if (itMakeNode == makeNodes.end()) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: node type " << typeName << " from " << version << " is not supported";
+        }
+        auto node = itMakeNode->second();
+        node->set_friendly_name(::Read<std::string>(_stream));
+        ngraph::OutputVector arguments(ReadSize(_stream, 2 * sizeof(std::uint64_t)));
+        for (auto&& argument : arguments) {
+            auto sourceNode = nodes.at(::Read<std::uint64_t>(_stream));
+            argument = sourceNode->output(::Read<std::uint64_t>(_stream));
+        }
+        node->set_arguments(arguments);
+        AttributeReader reader{_stream};
+        node->visit_attributes(reader);
+        node->constructor_validate_and_infer_types();
+        ReadRtInfo(_stream, node->get_rt_info());
+        auto outputSize = ::Read<std::uint64_t>(_stream);
+        if (outputSize != node->get_output_size()) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: " << *node << " has " << node->get_output_size()
+                                     << " outputs, while " << outputSize << " outputs are in the network blob";
+        }
+        for (auto&& output : node->outputs()) {
+            output.get_tensor().set_names(::Read<std::unordered_set<std::string>>(_stream));
+        }
+        nodes.emplace_back(std::move(node));
+    }
+    ov::ParameterVector parameters(ReadSize(_stream, sizeof(std::uint64_t)));
+    for (auto&& parameter : parameters) {
+        parameter = ov::as_type_ptr<ov::op::v0::Parameter>(nodes.at(::Read<std::uint64_t>(_stream)));
+        IE_ASSERT(parameter != nullptr);
+    }
+    ov::ResultVector results(ReadSize(_stream, sizeof(std::uint64_t)));
+    for (auto&& result : results) {
+        result = ov::as_type_ptr<ov::op::v0::Result>(nodes.at(::Read<std::uint64_t>(_stream)));
+        IE_ASSERT(result != nullptr);
+    }
+    return std::make_shared<ov::Model>(results, parameters, name);
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include <ie_input_info.hpp>
+#include <ngraph/function.hpp>
+
+#include "arm_config.hpp"
+
+namespace ArmPlugin {
+
+/**
+ * @brief Writes an executable network into a blob which is read back by BlobReader.
+ * The blob keeps the model transformed by ArmOptimizations, so imported networks are not transformed again.
+ * Nodes are stored with their attributes, output tensor names and rt_info values used by the converter.
+ * Parts of the blob should be written and read in the same order.
+ */
+struct BlobWriter {
+    explicit BlobWriter(std::ostream& stream);
+
+    void Write(const Configuration& cfg);
+    void Write(const InferenceEngine::InputsDataMap& inputs);
+    void Write(const InferenceEngine::OutputsDataMap& outputs);
+    void WriteParameters(const std::vector<std::shared_ptr<const ov::Node>>& parameters);
+    void WriteResults(const std::vector<std::shared_ptr<const ov::Node>>& results);
+    void Write(const ov::Model& model);
+
+    std::ostream&   _stream;
+};
+
+/**
+ * @brief Reads a blob written by BlobWriter, throws if the blob has another format version
+ */
+struct BlobReader {
+    explicit BlobReader(std::istream& stream);
+
+    Configuration ReadConfiguration(const Configuration& defaultCfg);
+    InferenceEngine::InputsDataMap ReadInputs();
+    InferenceEngine::OutputsDataMap ReadOutputs();
+    std::vector<std::shared_ptr<const ov::Node>> ReadParameters();
+    std::vector<std::shared_ptr<const ov::Node>> ReadResults();
+    /**
+     * Node types are resolved among the ones supported by the converter with configuration @cfg
+     */
+    std::shared_ptr<ov::Model> ReadModel(const Configuration& cfg);
+
+    std::istream&   _stream;
+};
+}  // namespace ArmPlugin
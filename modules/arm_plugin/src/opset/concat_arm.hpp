@@ -13,6 +13,7 @@ namespace opset {
 class ArmConcat : public Concat {
 public:
     OPENVINO_OP("ArmConcat", "arm_opset", Concat);
+    ArmConcat() = default;
     ArmConcat(const ngraph::OutputVector& args, int64_t axis);
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 };
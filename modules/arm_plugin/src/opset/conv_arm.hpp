@@ -15,6 +15,7 @@ namespace opset {
 class ArmConvolution : public Convolution {
 public:
     OPENVINO_OP("ArmConvolution", "arm_opset", Convolution);
+    ArmConvolution() = default;
     ArmConvolution(const ngraph::Output<ngraph::Node>& data_batch,
                    const ngraph::Output<ngraph::Node>& filters,
                    const ngraph::Strides& strides,
@@ -13,6 +13,7 @@ namespace opset {
 class ArmConvert : public Convert {
 public:
     OPENVINO_OP("ArmConvert", "arm_opset", Convert);
+    ArmConvert() = default;
     ArmConvert(const ngraph::Output<ngraph::Node>& data, const ngraph::element::Type& destination_type);
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 };
@@ -18,6 +18,7 @@ public:
         axisY
     };
 
+    ArmFFT() = default;
     ArmFFT(const ngraph::Output<ngraph::Node>& data, Axis axis, bool inverse);
 
     unsigned int get_arm_axis() const { return m_axis; }
@@ -28,8 +29,8 @@ public:
 
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 private:
-    unsigned int m_axis;
-    bool m_inverse;
+    unsigned int m_axis = 0;
+    bool m_inverse = false;
 };
 }  // namespace opset
 }  // namespace ArmPlugin
@@ -13,6 +13,7 @@ namespace opset {
 class ArmGather : public Gather {
 public:
     OPENVINO_OP("ArmGather", "arm_opset", Gather);
+    ArmGather() = default;
     ArmGather(const ngraph::Output<ngraph::Node>& data,
               const ngraph::Output<ngraph::Node>& indices,
               const ngraph::Output<ngraph::Node>& axes);
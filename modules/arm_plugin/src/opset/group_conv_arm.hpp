@@ -15,6 +15,7 @@ namespace opset {
 class ArmGroupConvolution : public GroupConvolution {
 public:
     OPENVINO_OP("ArmGroupConvolution", "arm_opset", GroupConvolution);
+    ArmGroupConvolution() = default;
 
     ArmGroupConvolution(const ngraph::Output<ngraph::Node>& data_batch,
                         const ngraph::Output<ngraph::Node>& filters,
@@ -33,6 +33,12 @@ opset::ArmInterpolate::ArmInterpolate(const ngraph::Output<ngraph::Node>& image,
     constructor_validate_and_infer_types();
 }
 
+bool opset::ArmInterpolate::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    Interpolate::visit_attributes(visitor);
+    m_attrs = get_attrs();
+    return true;
+}
+
 std::shared_ptr<ngraph::Node> ArmPlugin::opset::ArmInterpolate::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     auto num_args = new_args.size();
     if (num_args == 3) {
@@ -13,6 +13,7 @@ namespace opset {
 class ArmInterpolate : public Interpolate {
 public:
     OPENVINO_OP("ArmInterpolate", "arm_opset", Interpolate);
+    ArmInterpolate() = default;
 
     ArmInterpolate(const ngraph::Output<ngraph::Node>& image,
                    const ngraph::Output<ngraph::Node>& output_shape,
@@ -25,6 +26,7 @@ public:
                    const ngraph::Output<ngraph::Node>& axes,
                    const Interpolate::InterpolateAttrs& attrs);
 
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 private:
     Interpolate::InterpolateAttrs m_attrs;
@@ -24,6 +24,12 @@ opset::ArmMatMulBias::ArmMatMulBias(const ngraph::Output<ngraph::Node>& data,
     constructor_validate_and_infer_types();
 }
 
+bool opset::ArmMatMulBias::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    MatMul::visit_attributes(visitor);
+    m_transpose_b = get_transpose_b();
+    return true;
+}
+
 shared_ptr<Node> opset::ArmMatMulBias::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     check_new_args_count(this, new_args);
     return make_shared<ArmMatMulBias>(new_args.at(0), new_args.at(1), new_args.at(2), m_transpose_b);
@@ -17,12 +17,14 @@ namespace opset {
 class ArmMatMulBias : public MatMul {
 public:
     OPENVINO_OP("ArmMatMulBias", "arm_opset", MatMul);
+    ArmMatMulBias() = default;
 
     ArmMatMulBias(const ngraph::Output<ngraph::Node>& data,
                   const ngraph::Output<ngraph::Node>& weights,
                   const ngraph::Output<ngraph::Node>& bias,
                   const bool& transpose_b = false);
 
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 
 private:
@@ -12,6 +12,11 @@ opset::ArmMVN::ArmMVN(const ngraph::Output<ngraph::Node>& data, float eps)
     constructor_validate_and_infer_types();
 }
 
+bool opset::ArmMVN::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    visitor.on_attribute("eps", m_eps);
+    return true;
+}
+
 std::shared_ptr<ngraph::Node> opset::ArmMVN::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     auto num_args = new_args.size();
     OPENVINO_ASSERT(num_args == 1, "Unsupported number of arguments for ArmMVN operation: ", num_args);
@@ -13,8 +13,10 @@ namespace opset {
 class ArmMVN : public ngraph::op::Op {
 public:
     OPENVINO_OP("ArmMVN", "arm_opset");
+    ArmMVN() = default;
     ArmMVN(const ngraph::Output<ngraph::Node>& data, float eps);
     float get_eps() const { return m_eps; }
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 private:
     float m_eps = 0.00001f;
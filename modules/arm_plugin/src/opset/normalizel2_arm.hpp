@@ -13,6 +13,7 @@ namespace opset {
 class ArmNormalizeL2 : public NormalizeL2 {
 public:
     OPENVINO_OP("ArmNormalizeL2", "arm_opset", NormalizeL2);
+    ArmNormalizeL2() = default;
     ArmNormalizeL2(const ngraph::Output<ngraph::Node>& data,
                    const ngraph::Output<ngraph::Node>& axes,
                    float eps,
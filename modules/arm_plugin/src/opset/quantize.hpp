@@ -14,6 +14,7 @@ namespace opset {
 
 struct ArmQuantize : public ngraph::op::Op {
     OPENVINO_OP("ArmQuantize", "arm_opset");
+    ArmQuantize() = default;
     ArmQuantize(const ngraph::Output<ngraph::Node>& data);
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
     void validate_and_infer_types() override;
@@ -21,6 +22,7 @@ struct ArmQuantize : public ngraph::op::Op {
 
 struct ArmDequantize : public ngraph::op::Op {
     OPENVINO_OP("ArmDequantize", "arm_opset");
+    ArmDequantize() = default;
     ArmDequantize(const ngraph::Output<ngraph::Node>& data);
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
     void validate_and_infer_types() override;
@@ -13,6 +13,7 @@ namespace opset {
 class ArmSplit : public Split {
 public:
     OPENVINO_OP("ArmSplit", "arm_opset", Split);
+    ArmSplit() = default;
 
     ArmSplit(const ngraph::Output<ngraph::Node>& data, const ngraph::Output<ngraph::Node>& axis, const size_t num_splits);
 
@@ -38,6 +38,16 @@ opset::ArmStridedSlice::ArmStridedSlice(const ngraph::Output<ngraph::Node>& data
     constructor_validate_and_infer_types();
 }
 
+bool opset::ArmStridedSlice::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    StridedSlice::visit_attributes(visitor);
+    m_begin_mask = get_begin_mask();
+    m_end_mask = get_end_mask();
+    m_new_axis_mask = get_new_axis_mask();
+    m_shrink_axis_mask = get_shrink_axis_mask();
+    m_ellipsis_mask = get_ellipsis_mask();
+    return true;
+}
+
 std::shared_ptr<ngraph::Node> ArmPlugin::opset::ArmStridedSlice::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     auto num_args = new_args.size();
     if (num_args == 4) {
@@ -13,6 +13,7 @@ namespace opset {
 class ArmStridedSlice : public StridedSlice {
 public:
     OPENVINO_OP("ArmStridedSlice", "arm_opset", StridedSlice);
+    ArmStridedSlice() = default;
 
     ~ArmStridedSlice() override;
 
@@ -35,6 +36,7 @@ public:
                     const std::vector<int64_t>& shrink_axis_mask = std::vector<int64_t>{},
                     const std::vector<int64_t>& ellipsis_mask = std::vector<int64_t>{});
 
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 
 protected:
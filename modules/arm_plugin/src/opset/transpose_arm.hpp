@@ -13,6 +13,7 @@ namespace opset {
 class ArmTranspose : public Transpose {
 public:
     OPENVINO_OP("ArmTranspose", "arm_opset", Transpose);
+    ArmTranspose() = default;
     ArmTranspose(const ngraph::Output<ngraph::Node>& arg, const ngraph::Output<ngraph::Node>& input_order);
     std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
 };
@@ -0,0 +1,69 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> makeModel() {
+    using namespace ov::opset8;
+    constexpr std::size_t channels = 256;
+    auto parameter = std::make_shared<Parameter>(ov::element::f32, ov::Shape{1, channels, 28, 28});
+    std::shared_ptr<ov::Node> node = parameter;
+    for (int i = 0; i < 8; ++i) {
+        auto weights = Constant::create(ov::element::f32, ov::Shape{channels, channels, 3, 3},
+                                        std::vector<float>(channels * channels * 3 * 3, 0.01f));
+        node = std::make_shared<Convolution>(node, weights, ov::Strides{1, 1}, ov::CoordinateDiff{1, 1},
+                                             ov::CoordinateDiff{1, 1}, ov::Strides{1, 1});
+        node = std::make_shared<Relu>(node);
+    }
+    node = std::make_shared<ReduceMean>(node, Constant::create(ov::element::i64, ov::Shape{2}, {2, 3}), false);
+    auto weights = Constant::create(ov::element::f32, ov::Shape{channels, 1000}, std::vector<float>(channels * 1000, 0.01f));
+    node = std::make_shared<MatMul>(node, weights);
+    return std::make_shared<ov::Model>(ov::NodeVector{node}, ov::ParameterVector{parameter}, "InferRequestCreation");
+}
+
+// Resident set size of the process in megabytes
+double residentSetSize() {
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1 << 20);
+}
+
+}  // namespace
+
+TEST(InferRequestCreation, DISABLED_benchmark) {
+    using Time = std::chrono::steady_clock;
+    ov::Core core;
+    const auto model = makeModel();
+    for (int streams : {1, 2, 4, 8}) {
+        const auto rssBefore = residentSetSize();
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(streams));
+        std::vector<ov::InferRequest> requests;
+        const auto start = Time::now();
+        for (int i = 0; i < streams; ++i) {
+            requests.push_back(compiledModel.create_infer_request());
+        }
+        const std::chrono::duration<double, std::milli> creationTime = Time::now() - start;
+        // Weights are transformed at latest on the first inference
+        for (auto&& request : requests) {
+            request.infer();
+        }
+        std::cout << streams << " streams: " << creationTime.count() / streams << " ms per infer request, "
+                  << residentSetSize() - rssBefore << " MB RSS" << std::endl;
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+constexpr std::size_t height = 38;
+constexpr std::size_t width = 50;
+constexpr float spatialScale = 1.f / 16;
+
+// Boxes in image coordinates of (x1, y1, x2, y2), optionally prepended with the batch index
+std::vector<float> makeBoxes(std::size_t numRois, bool withBatchIndex) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<float> x{0.f, width / spatialScale};
+    std::uniform_real_distribution<float> y{0.f, height / spatialScale};
+    std::vector<float> boxes;
+    for (std::size_t i = 0; i < numRois; ++i) {
+        if (withBatchIndex) {
+            boxes.push_back(0.f);
+        }
+        const auto x1 = x(generator), y1 = y(generator), x2 = x(generator), y2 = y(generator);
+        boxes.insert(boxes.end(), {std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2)});
+    }
+    return boxes;
+}
+
+std::shared_ptr<ov::Model> makeROIAlign(std::size_t numRois) {
+    using namespace ov::opset8;
+    auto parameter = std::make_shared<Parameter>(ov::element::f32, ov::Shape{1, 256, height, width});
+    auto rois = Constant::create(ov::element::f32, ov::Shape{numRois, 4}, makeBoxes(numRois, false));
+    auto batchIndices = Constant::create(ov::element::i32, ov::Shape{numRois}, std::vector<std::int32_t>(numRois, 0));
+    auto node = std::make_shared<ROIAlign>(parameter, rois, batchIndices, 7, 7, 2, spatialScale, "avg");
+    return std::make_shared<ov::Model>(ov::NodeVector{node}, ov::ParameterVector{parameter}, "ROIAlign");
+}
+
+std::shared_ptr<ov::Model> makeROIPooling(std::size_t numRois) {
+    using namespace ov::opset8;
+    auto parameter = std::make_shared<Parameter>(ov::element::f32, ov::Shape{1, 256, height, width});
+    auto rois = Constant::create(ov::element::f32, ov::Shape{numRois, 5}, makeBoxes(numRois, true));
+    auto node = std::make_shared<ROIPooling>(parameter, rois, ov::Shape{7, 7}, spatialScale, "max");
+    return std::make_shared<ov::Model>(ov::NodeVector{node}, ov::ParameterVector{parameter}, "ROIPooling");
+}
+
+std::shared_ptr<ov::Model> makePSROIPooling(std::size_t numRois) {
+    using namespace ov::opset8;
+    constexpr std::size_t outputDim = 8;
+    constexpr std::size_t groupSize = 7;
+    auto parameter = std::make_shared<Parameter>(ov::element::f32, ov::Shape{1, outputDim * groupSize * groupSize, height, width});
+    auto rois = Constant::create(ov::element::f32, ov::Shape{numRois, 5}, makeBoxes(numRois, true));
+    auto node = std::make_shared<PSROIPooling>(parameter, rois, outputDim, groupSize, spatialScale, 1, 1, "average");
+    return std::make_shared<ov::Model>(ov::NodeVector{node}, ov::ParameterVector{parameter}, "PSROIPooling");
+}
+}  // namespace
+
+TEST(RoiOps, DISABLED_benchmark) {
+    using Time = std::chrono::steady_clock;
+    constexpr int iterations = 20;
+    ov::Core core;
+    const std::vector<std::pair<std::string, std::function<std::shared_ptr<ov::Model>(std::size_t)>>> makers = {
+        {"ROIAlign", makeROIAlign},
+        {"ROIPooling", makeROIPooling},
+        {"PSROIPooling", makePSROIPooling},
+    };
+    for (auto&& maker : makers) {
+        for (std::size_t numRois : {10, 100, 300, 1000}) {
+            auto compiledModel = core.compile_model(maker.second(numRois), CommonTestUtils::DEVICE_CPU);
+            auto request = compiledModel.create_infer_request();
+            request.infer();
+            const auto start = Time::now();
+            for (int i = 0; i < iterations; ++i) {
+                request.infer();
+            }
+            const std::chrono::duration<double, std::milli> time = Time::now() - start;
+            std::cout << maker.first << " " << numRois << " ROIs: " << time.count() / iterations << " ms" << std::endl;
+        }
+    }
+}
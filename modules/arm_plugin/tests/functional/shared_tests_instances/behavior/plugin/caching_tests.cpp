@@ -0,0 +1,26 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "behavior/plugin/caching_tests.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+    const std::vector<ngraph::element::Type> precisions = {
+            ngraph::element::f32,
+            ngraph::element::f16
+    };
+
+    const std::vector<std::size_t> batchSizes = {
+            1, 2
+    };
+
+    INSTANTIATE_TEST_CASE_P(smoke_CachingSupportCase, LoadNetworkCacheTestBase,
+            ::testing::Combine(
+            ::testing::ValuesIn(LoadNetworkCacheTestBase::getStandardFunctions()),
+            ::testing::ValuesIn(precisions),
+            ::testing::ValuesIn(batchSizes),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            LoadNetworkCacheTestBase::getTestCaseName);
+}  // namespace
@@ -76,4 +76,46 @@ const auto params5Inputs = ::testing::Combine(
 );
 
 INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput5In, DetectionOutputLayerTest, params5Inputs, DetectionOutputLayerTest::getTestCaseName);
+
+/* =============== batches of images =============== */
+// Images of a batch are processed in parallel, decrease_label_id selects boxes across classes as MXNet does
+const std::vector<int> topKBatch = {75, -1};
+const std::vector<std::vector<int>> keepTopKBatch = { {20}, {-1} };
+const std::vector<bool> decreaseLabelIdBatch = {false, true};
+const std::vector<size_t> numberBatchMany = {2, 5};
+
+const auto commonAttributesBatch = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(backgroundLabelId),
+        ::testing::ValuesIn(topKBatch),
+        ::testing::ValuesIn(keepTopKBatch),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(confidenceThreshold),
+        ::testing::Values(true),
+        ::testing::Values(true),
+        ::testing::ValuesIn(decreaseLabelIdBatch)
+);
+
+const auto params3InputsBatch = ::testing::Combine(
+        commonAttributesBatch,
+        ::testing::ValuesIn(specificParams3In),
+        ::testing::ValuesIn(numberBatchMany),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput3InBatch, DetectionOutputLayerTest, params3InputsBatch,
+                        DetectionOutputLayerTest::getTestCaseName);
+
+const auto params5InputsBatch = ::testing::Combine(
+        commonAttributesBatch,
+        ::testing::ValuesIn(specificParams5In),
+        ::testing::ValuesIn(numberBatchMany),
+        ::testing::Values(objectnessScore),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput5InBatch, DetectionOutputLayerTest, params5InputsBatch,
+                        DetectionOutputLayerTest::getTestCaseName);
 }  // namespace
@@ -31,6 +31,11 @@ namespace {
                                                            ngraph::op::RecurrentSequenceDirection::REVERSE,
                                                            ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL
     };
+    // Sequences of f32 are executed natively, hidden sizes cover whole NEON lanes and remainders of them
+    std::vector<ngraph::helpers::SequenceTestsMode> native_mode{ngraph::helpers::SequenceTestsMode::PURE_SEQ,
+                                                                ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST,
+                                                                ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM};
+    std::vector<size_t> native_hidden_size{4, 7, 16};
     std::vector<InferenceEngine::Precision> netPrecisions = {InferenceEngine::Precision::FP32,
                                                              InferenceEngine::Precision::FP16};
 
@@ -64,4 +69,19 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                             GRUSequenceTest::getTestCaseName);
 
+    INSTANTIATE_TEST_CASE_P(smoke_GRUSequenceNative, GRUSequenceTest,
+                            ::testing::Combine(
+                                    ::testing::ValuesIn(native_mode),
+                                    ::testing::ValuesIn(seq_lengths_clip_non_zero),
+                                    ::testing::ValuesIn(batch),
+                                    ::testing::ValuesIn(native_hidden_size),
+                                    // ::testing::ValuesIn(input_size),  // hardcoded to 10 due to Combine supports up to 10 args
+                                    ::testing::ValuesIn(activations),
+                                    ::testing::ValuesIn(clip_non_zeros),
+                                    ::testing::ValuesIn(linear_before_reset),
+                                    ::testing::ValuesIn(direction),
+                                    ::testing::Values(InferenceEngine::Precision::FP32),
+                                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                            GRUSequenceTest::getTestCaseName);
+
 }  // namespace
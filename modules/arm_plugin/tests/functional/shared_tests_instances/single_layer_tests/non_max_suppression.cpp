@@ -46,3 +46,25 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_CASE_P(smoke_NMS5, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// Batches with many boxes and classes, IoU of candidates is computed with NEON for groups of selected boxes
+const std::vector<InputShapeParams> inShapeParamsLarge = {
+    InputShapeParams{4, 300, 10},
+    InputShapeParams{1, 1000, 2}
+};
+
+const auto nmsParamsLarge = ::testing::Combine(::testing::ValuesIn(inShapeParamsLarge),
+                                               ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                  ::testing::Values(Precision::I32),
+                                                                  ::testing::Values(Precision::FP32)),
+                                               ::testing::Values(1, 100),
+                                               ::testing::ValuesIn(threshold),
+                                               ::testing::Values(0.0f),
+                                               ::testing::ValuesIn(sigmaThreshold),
+                                               ::testing::ValuesIn(encodType),
+                                               ::testing::ValuesIn(sortResDesc),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_NMS5Large, NmsLayerTest, nmsParamsLarge, NmsLayerTest::getTestCaseName);
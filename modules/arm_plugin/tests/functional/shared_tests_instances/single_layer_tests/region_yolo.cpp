@@ -85,6 +85,45 @@ const auto testCase_yolov2_caffe = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+// Regions of all images of a batch are processed in parallel
+const std::vector<ngraph::Shape> inShapes_batch_v3 = {
+    {2, 255, 13, 13},
+    {3, 255, 26, 26}
+};
+
+const std::vector<ngraph::Shape> inShapes_batch_caffe = {
+    {2, 125, 13, 13},
+    {4, 125, 8, 8}
+};
+
+const auto testCase_yolov3_batch = ::testing::Combine(
+    ::testing::ValuesIn(inShapes_batch_v3),
+    ::testing::Values(classes[0]),
+    ::testing::Values(coords),
+    ::testing::Values(num_regions[1]),
+    ::testing::Values(do_softmax[1]),
+    ::testing::Values(masks[2]),
+    ::testing::Values(start_axis),
+    ::testing::Values(end_axis),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCase_yolov2_caffe_batch = ::testing::Combine(
+    ::testing::ValuesIn(inShapes_batch_caffe),
+    ::testing::Values(classes[1]),
+    ::testing::Values(coords),
+    ::testing::Values(num_regions[0]),
+    ::testing::Values(do_softmax[0]),
+    ::testing::Values(masks[0]),
+    ::testing::Values(start_axis),
+    ::testing::Values(end_axis),
+    ::testing::Values(InferenceEngine::Precision::FP32),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 INSTANTIATE_TEST_CASE_P(smoke_TestsRegionYolov3, RegionYoloLayerTest, testCase_yolov3, RegionYoloLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_TestsRegionYoloMxnet, RegionYoloLayerTest, testCase_yolov3_mxnet, RegionYoloLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_TestsRegionYoloCaffe, RegionYoloLayerTest, testCase_yolov2_caffe, RegionYoloLayerTest::getTestCaseName);
+INSTANTIATE_TEST_CASE_P(smoke_TestsRegionYolov3Batch, RegionYoloLayerTest, testCase_yolov3_batch, RegionYoloLayerTest::getTestCaseName);
+INSTANTIATE_TEST_CASE_P(smoke_TestsRegionYoloCaffeBatch, RegionYoloLayerTest, testCase_yolov2_caffe_batch, RegionYoloLayerTest::getTestCaseName);
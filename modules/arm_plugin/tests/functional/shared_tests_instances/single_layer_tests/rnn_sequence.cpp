@@ -29,6 +29,11 @@ namespace {
                                                            ngraph::op::RecurrentSequenceDirection::REVERSE,
                                                            ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL,
     };
+    // Sequences of f32 are executed natively, hidden sizes cover whole NEON lanes and remainders of them
+    std::vector<ngraph::helpers::SequenceTestsMode> native_mode{ngraph::helpers::SequenceTestsMode::PURE_SEQ,
+                                                                ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST,
+                                                                ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_PARAM};
+    std::vector<size_t> native_hidden_size{4, 7, 16};
     std::vector<InferenceEngine::Precision> netPrecisions = {InferenceEngine::Precision::FP32};
 
     INSTANTIATE_TEST_CASE_P(smoke_RNNSequenceCommonZeroClip, RNNSequenceTest,
@@ -59,4 +64,18 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                             RNNSequenceTest::getTestCaseName);
 
+    INSTANTIATE_TEST_CASE_P(smoke_RNNSequenceNative, RNNSequenceTest,
+                            ::testing::Combine(
+                                    ::testing::ValuesIn(native_mode),
+                                    ::testing::ValuesIn(seq_lengths_clip_non_zero),
+                                    ::testing::ValuesIn(batch),
+                                    ::testing::ValuesIn(native_hidden_size),
+                                    ::testing::ValuesIn(input_size),
+                                    ::testing::ValuesIn(activations),
+                                    ::testing::ValuesIn(clip_non_zeros),
+                                    ::testing::ValuesIn(direction),
+                                    ::testing::Values(InferenceEngine::Precision::FP32),
+                                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                            RNNSequenceTest::getTestCaseName);
+
 }  // namespace
\ No newline at end of file
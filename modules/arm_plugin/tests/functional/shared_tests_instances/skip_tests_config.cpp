@@ -21,8 +21,6 @@ std::vector<std::string> disabledTestPatterns() {
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         ".*ActivationLayerTest.*CompareWithRefs/Tan_.*netPRC=FP16.*" // Failed (a small input change leads to a large output change)
 #endif
-        // need to implement Export / Import
-        ".*IEClassImportExportTestP.*",
         ".*Multi_BehaviorTests/InferRequestTests.canRun3SyncRequestsConsistentlyFromThreads.*", // Sporadic hangs,
         // CVS-58963: Not implemented yet
         ".*InferRequestIOBBlobTest.*OutOfFirstOutIsInputForSecondNetwork.*",
@@ -32,7 +30,6 @@ std::vector<std::string> disabledTestPatterns() {
         ".*Behavior.*ExecutableNetworkBaseTest.*(canSetConfigToExecNet|canSetConfigToExecNetAndCheckConfigAndCheck).*",
         ".*Behavior.*ExecutableNetworkBaseTest.*CanCreateTwoExeNetworksAndCheckFunction.*",
         ".*Behavior.*ExecutableNetworkBaseTest.*(CheckExecGraphInfoBeforeExecution|CheckExecGraphInfoAfterExecution).*",
-        ".*Behavior.*ExecutableNetworkBaseTest.*canExport.*",
         ".*Behavior.*ExecutableNetworkBaseTest.*canSetConfigToExecNetWithIncorrectConfig.*",
         ".*Multi.*BehaviorTests.*ExecutableNetworkBaseTest.*checkGetExecGraphInfoIsNotNullptr.*",
         ".*(Auto|Multi).*Behavior.*ExecutableNetworkBaseTest.*CheckExecGraphInfoSerialization.*",
@@ -33,6 +33,77 @@ namespace CUDAMetrics {
 DECLARE_NVIDIA_METRIC_VALUE(HARDWARE_CONVOLUTION);
 // ! [public_header:metrics]
 
+/**
+ * @def NVIDIA_METRIC_KEY(name)
+ * @brief Shortcut for defining NVIDIA GPU plugin specific metric keys
+ */
+#define NVIDIA_METRIC_KEY(name) InferenceEngine::CUDAMetrics::METRIC_NVIDIA_##name
+#define DECLARE_NVIDIA_METRIC_KEY(name) static constexpr auto METRIC_NVIDIA_##name = "NVIDIA_" #name
+
+/**
+ * @brief Number of bytes currently allocated by the shared device memory arena of the device.
+ */
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_ARENA_ALLOCATED_SIZE);
+
+/**
+ * @brief Maximum number of bytes that have been allocated by the shared device memory arena of the device.
+ */
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_ARENA_HIGH_WATER_MARK);
+
+/**
+ * @brief Memory pool metrics of an executable network: number of memory blocks allocated on device,
+ * number of blocks currently used by infer requests and the maximum of it.
+ */
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_ALLOCATED_BLOCKS);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_BLOCKS_IN_USE);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_PEAK_BLOCKS_IN_USE);
+
+/**
+ * @brief Memory pool metrics of an executable network: number of memory block requests, number of
+ * requests which had to wait for a block, total and maximum time of waiting in microseconds.
+ */
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_REQUESTS);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_WAITS);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_TOTAL_WAIT_TIME);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_POOL_MAX_WAIT_TIME);
+
+/**
+ * @brief Time in milliseconds spent on network load to find the optimal number of infer requests
+ * and whether the number was taken from NVIDIA_THROUGHPUT_TUNING_CACHE.
+ */
+DECLARE_NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_TIME);
+DECLARE_NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_FROM_CACHE);
+
+/**
+ * @brief Time in microseconds spent on network load in every graph transformation pass,
+ * as std::map<std::string, uint64_t> from pass name to time.
+ */
+DECLARE_NVIDIA_METRIC_KEY(TRANSFORMATION_PASS_TIMES);
+
+/**
+ * @brief Median and 99th percentile of execution time of every operation in microseconds over timed
+ * inferences of all infer requests, as std::map<std::string, std::vector<float>> from operation name
+ * to {p50, p99}. Inferences are timed when PERF_COUNT is enabled, see NVIDIA_PROFILING_SAMPLING_INTERVAL.
+ */
+DECLARE_NVIDIA_METRIC_KEY(OPERATION_LATENCY_PERCENTILES);
+
+/**
+ * @brief Number of batches executed for infer requests gathered with NVIDIA_REQUEST_BATCH_SIZE and
+ * the average ratio of their size to NVIDIA_REQUEST_BATCH_SIZE as float.
+ */
+DECLARE_NVIDIA_METRIC_KEY(REQUEST_BATCHES);
+DECLARE_NVIDIA_METRIC_KEY(REQUEST_BATCH_FILL_RATIO);
+
+/**
+ * @brief Size in bytes of the planned memory block of intermediate tensors of an infer request, the lower
+ * bound of it (max total size of tensors alive at the same time) and the name of the planner which made
+ * the plan, see NVIDIA_MEMORY_PLANNING. The lower bound is 0 and the planner is empty if the plan was
+ * imported with the network.
+ */
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_PLAN_SIZE);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_PLAN_LOWER_BOUND);
+DECLARE_NVIDIA_METRIC_KEY(MEMORY_PLANNER);
+
 }  // namespace CUDAMetrics
 
 namespace CUDAConfigParams {
@@ -61,10 +132,113 @@ DECLARE_NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS);
  */
 DECLARE_NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK);
 
+/**
+ * @brief Defines a file where the optimal number of infer requests found for NVIDIA_THROUGHPUT_AUTO
+ * is stored per network and device, so it is not searched for on the next load ("" - default, no cache).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_CACHE);
+
+/**
+ * @brief Defines if the optimal number of infer requests found for NVIDIA_THROUGHPUT_AUTO should be
+ * refined from throughput of live inferences after network load ("NVIDIA_YES", "NVIDIA_NO" - default).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_BACKGROUND);
+
+/**
+ * @brief Defines implementations of operations which have several of them, as a comma separated list of
+ * "<operation type>:<implementation>" pairs, e.g. "Add:cudnn,Clamp:cuda" ("" - default, implementations
+ * are chosen as NVIDIA_OPERATION_COST_MODEL defines). The chosen implementation of every node is recorded
+ * in the runtime info of the execution graph.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(OPERATION_IMPLEMENTATIONS);
+
+/**
+ * @brief Defines if implementations of operations which have several of them are chosen by host-side
+ * estimates of their execution time ("NVIDIA_YES"), or the cuDNN based ones are preferred ("NVIDIA_NO" -
+ * default). The estimates are not calibrated against measurements yet.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(OPERATION_COST_MODEL);
+
+/**
+ * @brief Defines that only every N-th inference of an infer request is timed when PERF_COUNT is enabled
+ * ("1" - default, every inference is timed).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL);
+
+/**
+ * @brief Defines the number of operations timed in a timed inference, the next operations are timed
+ * in the next timed inference and so on ("0" - default, all operations are timed).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(PROFILING_OPS_PER_INFERENCE);
+
+/**
+ * @brief Defines a file where spans of infer request stages and operations are written in Chrome trace
+ * format ("" - default, no trace). Spans of operations are written for inferences and operations timed
+ * with PERF_COUNT. The key may also be changed with SetConfig of a loaded network to start or stop tracing.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(TRACE_FILE);
+
+/**
+ * @brief Defines the maximal number of CUDA streams an infer request runs independent branches of
+ * a network on ("1" - default, operations are executed one by one on a single stream).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST);
+
+/**
+ * @brief Defines the number of concurrent infer requests which are gathered into a single execution of
+ * the network compiled with this batch size ("1" - default, every infer request is executed on its own).
+ * Network inputs should have batch size 1 and outputs should depend on the batch dimension only.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE);
+
+/**
+ * @brief Defines time in microseconds for which the first infer request of a batch waits for more
+ * infer requests ("1000" - default).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(REQUEST_BATCH_WINDOW);
+
+/**
+ * @brief Defines time in microseconds in which a batched infer request should be executed, a batch is
+ * executed earlier than NVIDIA_REQUEST_BATCH_WINDOW expires to fit into it ("0" - default, no bound).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(REQUEST_BATCH_MAX_LATENCY);
+
 /**
  * @brief Defines possibility to disable TensorIterator transformation for test purposes.
  */
 DECLARE_NVIDIA_CONFIG_KEY(DISABLE_TENSORITERATOR_TRANSFORM);
 
+/**
+ * @brief Defines where memory of intermediate tensors of infer requests comes from:
+ * "NVIDIA_MEMORY_DEDICATED" (default) - each network preallocates memory blocks of its own,
+ * "NVIDIA_MEMORY_SHARED" - networks loaded on the same device lease memory from a common arena.
+ */
+DECLARE_NVIDIA_CONFIG_VALUE(MEMORY_DEDICATED);
+DECLARE_NVIDIA_CONFIG_VALUE(MEMORY_SHARED);
+DECLARE_NVIDIA_CONFIG_KEY(MEMORY_POLICY);
+
+/**
+ * @brief Defines the number of memory blocks which are allocated on network load and kept when idle.
+ * More blocks are allocated on demand up to the number of throughput streams. By default all of them
+ * are allocated on network load.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(MEMORY_POOL_MIN_SIZE);
+
+/**
+ * @brief Defines time in milliseconds after which an unused memory block above the minimal number
+ * is released ("10000" - default, "0" - blocks are never released).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(MEMORY_POOL_IDLE_TIMEOUT);
+
+/**
+ * @brief Defines how memory of intermediate tensors is planned on network load:
+ * "NVIDIA_MEMORY_PLANNING_FAST" (default) - boxes are placed greedily from the biggest one,
+ * "NVIDIA_MEMORY_PLANNING_BEST" - several planners are tried and the smallest memory block is kept,
+ * which may take several times longer on big networks.
+ */
+DECLARE_NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_FAST);
+DECLARE_NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_BEST);
+DECLARE_NVIDIA_CONFIG_KEY(MEMORY_PLANNING);
+
 }  // namespace CUDAConfigParams
 }  // namespace InferenceEngine
@@ -20,6 +20,10 @@ public:
         return std::move(*this);
     }
     void synchronize() { throwIfError(cudaEventSynchronize(get())); }
+    /**
+     * Makes work submitted to the stream later wait until the last record of the event completes
+     */
+    void streamWait(const Stream& stream) const { throwIfError(cudaStreamWaitEvent(stream.get(), get(), 0)); }
     float elapsedSince(const Event& start) const { return createFirstArg(cudaEventElapsedTime, start.get(), get()); }
 };
 
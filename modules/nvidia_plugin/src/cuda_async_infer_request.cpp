@@ -13,10 +13,31 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * Submits the execution stage of an infer request to BatchedNetwork, which runs it
+ * on CudaThreadPool when the batch of the infer request is executed
+ */
+class BatchingExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    BatchingExecutor(BatchedNetwork& batchedNetwork, CudaInferRequest& inferRequest)
+        : batched_network_{batchedNetwork}, infer_request_{inferRequest} {}
+
+    void run(InferenceEngine::Task task) override { batched_network_.Submit(infer_request_, std::move(task)); }
+
+private:
+    BatchedNetwork& batched_network_;
+    CudaInferRequest& infer_request_;
+};
+
+}  // namespace
+
 CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferRequest,
                                              const InferenceEngine::ITaskExecutor::Ptr& cpuTaskExecutor,
                                              const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
-                                             const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
+                                             const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                             BatchedNetwork* batchedNetwork)
     : AsyncInferRequestThreadSafeDefault(inferRequest, cpuTaskExecutor, callbackExecutor), _inferRequest(inferRequest) {
     // In current implementation we have CPU only tasks and no needs in 2 executors
     // So, by default single stage pipeline is created.
@@ -49,6 +70,12 @@ CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferR
                           _inferRequest->inferPostprocess();
                       }}};
     }
+    if (batchedNetwork) {
+        _pipeline[1] = {std::make_shared<BatchingExecutor>(*batchedNetwork, *_inferRequest), [this] {
+                            OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::WaitBatch");
+                            _inferRequest->waitBatch();
+                        }};
+    }
 }
 
 void CudaAsyncInferRequest::Cancel() {
@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 
+#include "cuda_batched_network.hpp"
 #include "cuda_infer_request.hpp"
 
 namespace ov {
@@ -13,10 +14,14 @@ namespace nvidia_gpu {
 
 class CudaAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
+    /**
+     * @param batchedNetwork If set, the infer request is executed in batches of it
+     */
     CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferRequest,
                           const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                           const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
-                          const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+                          const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                          BatchedNetwork* batchedNetwork = nullptr);
 
     /**
      * Cancel AsyncInferRequest
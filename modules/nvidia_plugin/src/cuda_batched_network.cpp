@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_batched_network.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <error.hpp>
+#include <exception>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <utility>
+
+#include "cuda_infer_request.hpp"
+#include "cuda_inference_request_context.hpp"
+#include "cuda_itt.hpp"
+#include "ops/parameter.hpp"
+#include "ops/result.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::uint8_t* hostData(const std::shared_ptr<ngraph::runtime::Tensor>& tensor) {
+    return static_cast<std::uint8_t*>(std::static_pointer_cast<ngraph::HostTensor>(tensor)->get_data_ptr());
+}
+
+}  // namespace
+
+BatchedNetwork::BatchedNetwork(const CreationContext& context,
+                               const std::shared_ptr<const ngraph::Function>& function,
+                               const std::map<std::string, std::size_t>& inputIndex,
+                               const std::map<std::string, std::size_t>& outputIndex,
+                               const Batcher::Options& options,
+                               std::shared_ptr<CudaThreadPool> executor)
+    : executor_{std::move(executor)},
+      graph_{context, function},
+      input_index_{inputIndex},
+      output_index_{outputIndex},
+      memory_pool_{std::make_shared<MemoryPool>(options.maxBatchesInFlight,
+                                                graph_.memoryManager().mutableTensorsMemoryModel())},
+      batcher_{options, [this](Batcher::Batch&& batch) { Dispatch(std::move(batch)); }} {
+    for (const auto& parameter : function->get_parameters()) {
+        const auto name = ParameterOp::GetInputTensorName(*parameter);
+        if (input_index_.at(name) != function->get_parameter_index(parameter)) {
+            throwIEException(fmt::format("Input {} of batched network has another index", name));
+        }
+    }
+    for (const auto& result : function->get_results()) {
+        for (const auto& name : ResultOp::GetOutputTensorName(*result)) {
+            if (output_index_.at(name) != function->get_result_index(result->input_value(0))) {
+                throwIEException(fmt::format("Output {} of batched network has another index", name));
+            }
+        }
+    }
+    for (std::size_t i = 0; i < options.maxBatchesInFlight; ++i) {
+        auto batchContext = std::make_unique<BatchContext>(graph_);
+        for (const auto& parameter : function->get_parameters()) {
+            batchContext->inputs.push_back(
+                std::make_shared<ngraph::HostTensor>(parameter->get_element_type(), parameter->get_shape()));
+        }
+        for (const auto& result : function->get_results()) {
+            batchContext->outputs.push_back(
+                std::make_shared<ngraph::HostTensor>(result->get_element_type(), result->get_shape()));
+        }
+        free_contexts_.push_back(std::move(batchContext));
+    }
+}
+
+std::shared_ptr<ngraph::Function> BatchedNetwork::MakeBatchedFunction(const ngraph::Function& function,
+                                                                      const std::size_t batchSize) {
+    auto batched = ngraph::clone_function(function);
+    std::map<ov::Output<ov::Node>, ov::PartialShape> shapes;
+    for (const auto& parameter : batched->get_parameters()) {
+        auto shape = parameter->get_partial_shape();
+        if (shape.is_dynamic() || shape.rank().get_length() == 0 || shape[0].get_length() != 1) {
+            throwIEException(fmt::format(
+                "NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE): input {} should have static shape with batch size 1 !!",
+                parameter->get_friendly_name()));
+        }
+        shape[0] = batchSize;
+        shapes.emplace(parameter->output(0), std::move(shape));
+    }
+    batched->reshape(shapes);
+    for (std::size_t i = 0; i < batched->get_results().size(); ++i) {
+        auto expected = function.get_results().at(i)->get_output_partial_shape(0);
+        const auto& actual = batched->get_results()[i]->get_output_partial_shape(0);
+        const bool batchable = expected.is_static() && expected.rank().get_length() > 0 && expected[0].get_length() == 1;
+        if (batchable) {
+            expected[0] = batchSize;
+        }
+        if (!batchable || actual != expected) {
+            throwIEException(
+                fmt::format("NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE): output {} doesn't follow batch size of inputs !!",
+                            batched->get_results()[i]->get_friendly_name()));
+        }
+    }
+    return batched;
+}
+
+void BatchedNetwork::Submit(CudaInferRequest& request, InferenceEngine::Task continuation) {
+    batcher_.Submit({&request, std::move(continuation)});
+}
+
+void BatchedNetwork::Dispatch(Batcher::Batch&& batch) {
+    executor_->run([this, batch = std::make_shared<Batcher::Batch>(std::move(batch))] { Run(*batch); });
+}
+
+void BatchedNetwork::Run(const Batcher::Batch& batch) {
+    OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "BatchedNetwork::Run");
+    const auto start = Batcher::Time::now();
+    std::unique_ptr<BatchContext> context;
+    {
+        // Batcher doesn't dispatch more batches than there are contexts
+        std::lock_guard<std::mutex> lock{contexts_mtx_};
+        context = std::move(free_contexts_.back());
+        free_contexts_.pop_back();
+    }
+    try {
+        Execute(batch, *context);
+    } catch (...) {
+        const auto error = std::current_exception();
+        for (const auto& request : batch) {
+            request.request->batch_error_ = error;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock{contexts_mtx_};
+        free_contexts_.push_back(std::move(context));
+    }
+    const auto executionTime = Batcher::Time::now() - start;
+    for (const auto& request : batch) {
+        request.continuation();
+    }
+    batcher_.OnBatchCompleted(executionTime);
+}
+
+void BatchedNetwork::Execute(const Batcher::Batch& batch, BatchContext& context) const {
+    const auto batchSize = batcher_.GetOptions().maxBatchSize;
+    // Items of a partial batch which are not used keep data of a previous batch, they don't affect used ones
+    for (std::size_t k = 0; k < context.inputs.size(); ++k) {
+        const auto itemSize = context.inputs[k]->get_size_in_bytes() / batchSize;
+        auto* data = hostData(context.inputs[k]);
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            const auto& input = batch[i].request->input_tensors_.at(k);
+            if (input->get_size_in_bytes() != itemSize) {
+                throwIEException(fmt::format("Input {} of batched infer request has unexpected size", k));
+            }
+            input->read(data + i * itemSize, itemSize);
+        }
+    }
+
+    const auto& threadContext = executor_->GetThreadContext();
+    {
+        auto memory = memory_pool_->WaitAndGet(context.token);
+        InferenceRequestContext inferRequestContext{context.inputs,
+                                                    input_index_,
+                                                    context.outputs,
+                                                    output_index_,
+                                                    threadContext,
+                                                    context.token,
+                                                    context.profiler};
+        graph_.Run(inferRequestContext, memory.Get());
+        threadContext.stream().synchronize();
+    }
+
+    for (std::size_t k = 0; k < context.outputs.size(); ++k) {
+        const auto itemSize = context.outputs[k]->get_size_in_bytes() / batchSize;
+        const auto* data = hostData(context.outputs[k]);
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            const auto& output = batch[i].request->output_tensors_.at(k);
+            if (output->get_size_in_bytes() != itemSize) {
+                throwIEException(fmt::format("Output {} of batched infer request has unexpected size", k));
+            }
+            output->write(data + i * itemSize, itemSize);
+        }
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ngraph/function.hpp>
+#include <ngraph/runtime/tensor.hpp>
+#include <string>
+#include <threading/ie_itask_executor.hpp>
+#include <vector>
+
+#include "cancellation_token.hpp"
+#include "cuda_creation_context.hpp"
+#include "cuda_dynamic_batcher.hpp"
+#include "cuda_graph.hpp"
+#include "cuda_profiler.hpp"
+#include "cuda_thread_pool.hpp"
+#include "memory_manager/cuda_memory_pool.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class CudaInferRequest;
+
+/**
+ * @brief BatchedNetwork executes infer requests of a network with batch size 1 together,
+ * on the same network compiled with a larger batch size.
+ *
+ * Inputs of infer requests gathered by DynamicBatcher are copied into consecutive items
+ * of the batched inputs, the batched graph is executed on CudaThreadPool and items of
+ * the batched outputs are copied back into outputs of the infer requests.
+ */
+class BatchedNetwork {
+public:
+    struct Request {
+        CudaInferRequest* request;
+        // Continues the pipeline of the infer request when its batch is executed
+        InferenceEngine::Task continuation;
+    };
+    using Batcher = DynamicBatcher<Request>;
+
+    /**
+     * @param function Batched function which inputs and outputs are indexed as the ones of the network
+     */
+    BatchedNetwork(const CreationContext& context,
+                   const std::shared_ptr<const ngraph::Function>& function,
+                   const std::map<std::string, std::size_t>& inputIndex,
+                   const std::map<std::string, std::size_t>& outputIndex,
+                   const Batcher::Options& options,
+                   std::shared_ptr<CudaThreadPool> executor);
+
+    /**
+     * Makes a copy of @function with batch dimension of inputs set to @batchSize.
+     * Throws if inputs don't have batch size 1 or outputs don't follow the batch size of inputs
+     */
+    static std::shared_ptr<ngraph::Function> MakeBatchedFunction(const ngraph::Function& function,
+                                                                 std::size_t batchSize);
+
+    void Submit(CudaInferRequest& request, InferenceEngine::Task continuation);
+
+    const Batcher::Options& GetOptions() const { return batcher_.GetOptions(); }
+    Batcher::Statistics GetStatistics() const { return batcher_.GetStatistics(); }
+    double FillRatio() const { return GetStatistics().fillRatio(batcher_.GetOptions().maxBatchSize); }
+
+private:
+    /**
+     * Host tensors and per-execution state of a batch being executed
+     */
+    struct BatchContext {
+        explicit BatchContext(const SubGraph& graph) : profiler{false, graph} {}
+
+        CancellationToken token;
+        Profiler profiler;
+        std::vector<std::shared_ptr<ngraph::runtime::Tensor>> inputs;
+        std::vector<std::shared_ptr<ngraph::runtime::Tensor>> outputs;
+    };
+
+    void Dispatch(Batcher::Batch&& batch);
+    void Run(const Batcher::Batch& batch);
+    void Execute(const Batcher::Batch& batch, BatchContext& context) const;
+
+    std::shared_ptr<CudaThreadPool> executor_;
+    CudaGraph graph_;
+    std::map<std::string, std::size_t> input_index_;
+    std::map<std::string, std::size_t> output_index_;
+    std::shared_ptr<MemoryPool> memory_pool_;
+    std::mutex contexts_mtx_;
+    std::vector<std::unique_ptr<BatchContext>> free_contexts_;
+    // Destroyed first, so batches in flight are completed before the rest is destroyed
+    Batcher batcher_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
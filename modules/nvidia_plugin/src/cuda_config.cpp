@@ -8,9 +8,38 @@
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <error.hpp>
+#include <sstream>
 
 using namespace ov::nvidia_gpu;
 
+namespace {
+
+std::map<std::string, std::string> parseOperationImplementations(const std::string& value) {
+    std::map<std::string, std::string> implementations;
+    std::stringstream stream{value};
+    std::string pair;
+    while (std::getline(stream, pair, ',')) {
+        const auto separator = pair.find(':');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == pair.size()) {
+            throwIEException(fmt::format(
+                "NVIDIA_CONFIG_KEY(OPERATION_IMPLEMENTATIONS) entry '{}' is not <operation type>:<implementation>",
+                pair));
+        }
+        implementations[pair.substr(0, separator)] = pair.substr(separator + 1);
+    }
+    return implementations;
+}
+
+std::string formatOperationImplementations(const std::map<std::string, std::string>& implementations) {
+    std::string value;
+    for (const auto& [opType, implementation] : implementations) {
+        value += (value.empty() ? "" : ",") + opType + ':' + implementation;
+    }
+    return value;
+}
+
+}  // namespace
+
 Configuration::Configuration() {}
 
 Configuration::Configuration(const ConfigMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
@@ -51,6 +80,26 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             } else {
                 throwIEException(fmt::format("operation benchmark option value {} is not supported", value));
             }
+        } else if (NVIDIA_CONFIG_KEY(OPERATION_IMPLEMENTATIONS) == key) {
+            operation_implementations = parseOperationImplementations(value);
+        } else if (NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_CACHE) == key) {
+            throughput_tuning_cache = value;
+        } else if (NVIDIA_CONFIG_KEY(OPERATION_COST_MODEL) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                operation_cost_model = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                operation_cost_model = false;
+            } else {
+                throwIEException(fmt::format("operation cost model option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_BACKGROUND) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                throughput_tuning_background = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                throughput_tuning_background = false;
+            } else {
+                throwIEException(fmt::format("throughput tuning background option value {} is not supported", value));
+            }
         } else if (NVIDIA_CONFIG_KEY(DISABLE_TENSORITERATOR_TRANSFORM) == key) {
             if (value == NVIDIA_CONFIG_VALUE(YES)) {
                 disabled_tensoriterator_transform = true;
@@ -59,6 +108,87 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             } else {
                 throwIEException(fmt::format("disabled_transformations option value {} is not supported", value));
             }
+        } else if (NVIDIA_CONFIG_KEY(MEMORY_POLICY) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(MEMORY_SHARED)) {
+                shared_memory_policy = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(MEMORY_DEDICATED)) {
+                shared_memory_policy = false;
+            } else {
+                throwIEException(fmt::format("memory policy option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(MEMORY_POOL_MIN_SIZE) == key) {
+            try {
+                memory_pool_min_size = std::stoul(value);
+            } catch (...) {
+                throwIEException(fmt::format("NVIDIA_CONFIG_KEY(MEMORY_POOL_MIN_SIZE) = {} is not a number !!", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(MEMORY_POOL_IDLE_TIMEOUT) == key) {
+            try {
+                memory_pool_idle_timeout = std::chrono::milliseconds{std::stoul(value)};
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(MEMORY_POOL_IDLE_TIMEOUT) = {} is not a number !!", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(MEMORY_PLANNING) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_BEST)) {
+                best_memory_planning = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_FAST)) {
+                best_memory_planning = false;
+            } else {
+                throwIEException(fmt::format("memory planning option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL) == key) {
+            try {
+                profiling_sampling_interval = std::stoul(value);
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL) = {} is not a number !!", value));
+            }
+            if (profiling_sampling_interval == 0) {
+                throwIEException("NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL) should be positive !!");
+            }
+        } else if (NVIDIA_CONFIG_KEY(PROFILING_OPS_PER_INFERENCE) == key) {
+            try {
+                profiling_ops_per_inference = std::stoul(value);
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(PROFILING_OPS_PER_INFERENCE) = {} is not a number !!", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(TRACE_FILE) == key) {
+            trace_file = value;
+        } else if (NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST) == key) {
+            try {
+                streams_per_infer_request = std::stoul(value);
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST) = {} is not a number !!", value));
+            }
+            if (streams_per_infer_request == 0) {
+                throwIEException("NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST) should be positive !!");
+            }
+        } else if (NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE) == key) {
+            try {
+                request_batch_size = std::stoul(value);
+            } catch (...) {
+                throwIEException(fmt::format("NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE) = {} is not a number !!", value));
+            }
+            if (request_batch_size == 0) {
+                throwIEException("NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE) should be positive !!");
+            }
+        } else if (NVIDIA_CONFIG_KEY(REQUEST_BATCH_WINDOW) == key) {
+            try {
+                request_batch_window = std::chrono::microseconds{std::stoul(value)};
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(REQUEST_BATCH_WINDOW) = {} is not a number !!", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(REQUEST_BATCH_MAX_LATENCY) == key) {
+            try {
+                request_batch_max_latency = std::chrono::microseconds{std::stoul(value)};
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(REQUEST_BATCH_MAX_LATENCY) = {} is not a number !!", value));
+            }
         } else if (CONFIG_KEY(PERF_COUNT) == key) {
             perfCount = (CONFIG_VALUE(YES) == value);
         } else if (ov::hint::performance_mode == key) {
@@ -79,10 +209,43 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {std::to_string(deviceId)};
     } else if (name == CONFIG_KEY(PERF_COUNT)) {
         return {perfCount};
+    } else if (name == NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL)) {
+        return {std::to_string(profiling_sampling_interval)};
+    } else if (name == NVIDIA_CONFIG_KEY(PROFILING_OPS_PER_INFERENCE)) {
+        return {std::to_string(profiling_ops_per_inference)};
+    } else if (name == NVIDIA_CONFIG_KEY(TRACE_FILE)) {
+        return {trace_file};
+    } else if (name == NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST)) {
+        return {std::to_string(streams_per_infer_request)};
+    } else if (name == NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE)) {
+        return {std::to_string(request_batch_size)};
+    } else if (name == NVIDIA_CONFIG_KEY(REQUEST_BATCH_WINDOW)) {
+        return {std::to_string(request_batch_window.count())};
+    } else if (name == NVIDIA_CONFIG_KEY(REQUEST_BATCH_MAX_LATENCY)) {
+        return {std::to_string(request_batch_max_latency.count())};
     } else if (name == NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK)) {
         return {std::string(operation_benchmark ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(OPERATION_IMPLEMENTATIONS)) {
+        return {formatOperationImplementations(operation_implementations)};
+    } else if (name == NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_CACHE)) {
+        return {throughput_tuning_cache};
+    } else if (name == NVIDIA_CONFIG_KEY(OPERATION_COST_MODEL)) {
+        return {std::string(operation_cost_model ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_BACKGROUND)) {
+        return {std::string(throughput_tuning_background ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
     } else if (name == NVIDIA_CONFIG_KEY(DISABLE_TENSORITERATOR_TRANSFORM)) {
         return {std::string(disabled_tensoriterator_transform ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(MEMORY_POLICY)) {
+        return {std::string(shared_memory_policy ? NVIDIA_CONFIG_VALUE(MEMORY_SHARED)
+                                                 : NVIDIA_CONFIG_VALUE(MEMORY_DEDICATED))};
+    } else if (name == NVIDIA_CONFIG_KEY(MEMORY_POOL_MIN_SIZE)) {
+        // By default the pool is not elastic and its minimal size is the number of throughput streams
+        return {memory_pool_min_size ? std::to_string(*memory_pool_min_size) : cuda_throughput_streams_};
+    } else if (name == NVIDIA_CONFIG_KEY(MEMORY_POOL_IDLE_TIMEOUT)) {
+        return {std::to_string(memory_pool_idle_timeout.count())};
+    } else if (name == NVIDIA_CONFIG_KEY(MEMORY_PLANNING)) {
+        return {std::string(best_memory_planning ? NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_BEST)
+                                                 : NVIDIA_CONFIG_VALUE(MEMORY_PLANNING_FAST))};
     } else if (name == NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS)) {
         return {cuda_throughput_streams_};
     } else if (name == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <ie_parameter.hpp>
 #include <map>
 #include <memory>
 #include <nvidia/nvidia_config.hpp>
 #include <openvino/runtime/properties.hpp>
+#include <optional>
 #include <string>
 #include <threading/ie_istreams_executor.hpp>
 
@@ -36,8 +38,29 @@ struct Configuration {
 
     int deviceId = 0;
     bool perfCount = true;
+    std::size_t profiling_sampling_interval = 1;
+    // All operations are timed if 0
+    std::size_t profiling_ops_per_inference = 0;
+    std::string trace_file;
+    // Operations are executed on a single stream if 1
+    std::size_t streams_per_infer_request = 1;
+    // Infer requests are not batched if 1
+    std::size_t request_batch_size = 1;
+    std::chrono::microseconds request_batch_window{1000};
+    // Latency is not bounded if 0
+    std::chrono::microseconds request_batch_max_latency{0};
     bool operation_benchmark = false;
+    std::string throughput_tuning_cache;
+    // Operation type name to implementation name
+    std::map<std::string, std::string> operation_implementations;
+    bool operation_cost_model = false;
+    bool throughput_tuning_background = false;
     bool disabled_tensoriterator_transform = false;
+    bool shared_memory_policy = false;
+    // All memory blocks are allocated on network load if not set
+    std::optional<std::size_t> memory_pool_min_size;
+    std::chrono::milliseconds memory_pool_idle_timeout{10000};
+    bool best_memory_planning = false;
     std::string cuda_throughput_streams_ = std::to_string(1);
     InferenceEngine::IStreamsExecutor::Config streams_executor_config_;
     // TODO: Should be added usage of this property (What to do with NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS) ?)
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <cuda_config.hpp>
+#include <map>
+#include <string>
 
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
@@ -17,13 +19,46 @@ class CreationContext {
     CUDA::Device device_;
     CUDA::DnnHandle dnn_handle_;
     bool op_bench_option_;
+    std::map<std::string, std::string> operation_implementations_;
+    std::size_t streams_per_infer_request_;
+    bool best_memory_planning_;
+    bool operation_cost_model_;
 
 public:
-    explicit CreationContext(CUDA::Device d, bool opBenchOption)
-        : device_{d.setCurrent()}, op_bench_option_{opBenchOption} {}
+    explicit CreationContext(CUDA::Device d,
+                             bool opBenchOption,
+                             std::map<std::string, std::string> operationImplementations = {},
+                             std::size_t streamsPerInferRequest = 1,
+                             bool bestMemoryPlanning = false,
+                             bool operationCostModel = false)
+        : device_{d.setCurrent()},
+          op_bench_option_{opBenchOption},
+          operation_implementations_{std::move(operationImplementations)},
+          streams_per_infer_request_{streamsPerInferRequest},
+          best_memory_planning_{bestMemoryPlanning},
+          operation_cost_model_{operationCostModel} {}
     CUDA::Device device() const { return device_; }
     const CUDA::DnnHandle& dnnHandle() const { return dnn_handle_; }
     bool opBenchOption() const noexcept { return op_bench_option_; }
+    /**
+     * Implementations requested by configuration, as operation type name to implementation name
+     */
+    const std::map<std::string, std::string>& operationImplementations() const noexcept {
+        return operation_implementations_;
+    }
+    /**
+     * Maximal number of streams which independent branches of a graph are executed on
+     */
+    std::size_t streamsPerInferRequest() const noexcept { return streams_per_infer_request_; }
+    /**
+     * Whether all memory planners are tried instead of the default one, see NVIDIA_MEMORY_PLANNING
+     */
+    bool bestMemoryPlanning() const noexcept { return best_memory_planning_; }
+    /**
+     * Whether implementations of operations are ranked by their estimated cost instead of
+     * the order of registration, see NVIDIA_OPERATION_COST_MODEL
+     */
+    bool operationCostModel() const noexcept { return operation_cost_model_; }
 };
 
 }  // namespace nvidia_gpu
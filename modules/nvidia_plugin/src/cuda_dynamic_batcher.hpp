@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief DynamicBatcher gathers requests submitted by different threads into batches.
+ *
+ * A batch is dispatched when it is full, or when its first request has waited for a time
+ * window. If a latency bound is set, the batch is dispatched earlier so that its first request
+ * is completed within the bound, given the average execution time of previous batches.
+ * The number of batches executed at the same time is limited, while they are executed
+ * new requests are gathered into the next batch.
+ */
+template <typename Request>
+class DynamicBatcher {
+public:
+    using Time = std::chrono::steady_clock;
+    using Batch = std::vector<Request>;
+    /**
+     * Called from the batcher thread, should start execution of a batch and return.
+     * OnBatchCompleted should be called when the batch is executed
+     */
+    using Dispatch = std::function<void(Batch&&)>;
+
+    struct Options {
+        std::size_t maxBatchSize = 1;
+        // How long the first request of a batch waits for more requests
+        std::chrono::microseconds window{0};
+        // Bound of time from submission of a request till completion of its batch, 0 - no bound
+        std::chrono::microseconds maxLatency{0};
+        std::size_t maxBatchesInFlight = 1;
+    };
+
+    struct Statistics {
+        std::size_t numBatches = 0;
+        std::size_t numRequests = 0;
+        /**
+         * Average ratio of batch size to the maximal one
+         */
+        double fillRatio(std::size_t maxBatchSize) const {
+            return numBatches == 0 ? 0.0 : static_cast<double>(numRequests) / (numBatches * maxBatchSize);
+        }
+    };
+
+    DynamicBatcher(Options options, Dispatch dispatch)
+        : options_{options}, dispatch_{std::move(dispatch)}, thread_{[this] { Loop(); }} {}
+
+    /**
+     * Dispatches pending requests without waiting for the window and waits for completion
+     * of all batches. The limit of batches in flight is kept while pending requests are drained
+     */
+    ~DynamicBatcher() {
+        {
+            std::lock_guard<std::mutex> lock{mtx_};
+            is_stopped_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+        std::unique_lock<std::mutex> lock{mtx_};
+        cv_.wait(lock, [this] { return in_flight_ == 0; });
+    }
+
+    DynamicBatcher(const DynamicBatcher&) = delete;
+    DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+    void Submit(Request request) {
+        {
+            std::lock_guard<std::mutex> lock{mtx_};
+            pending_.push_back({std::move(request), Time::now()});
+        }
+        cv_.notify_all();
+    }
+
+    void OnBatchCompleted(const Time::duration executionTime) {
+        std::lock_guard<std::mutex> lock{mtx_};
+        --in_flight_;
+        // Exponential moving average smooths out outliers of single batches
+        constexpr double kWeight = 0.2;
+        expected_execution_time_ =
+            expected_execution_time_ == Time::duration::zero()
+                ? executionTime
+                : std::chrono::duration_cast<Time::duration>(expected_execution_time_ * (1.0 - kWeight) +
+                                                             executionTime * kWeight);
+        // Notified under the lock, because the destructor may return as soon as the last batch is completed
+        cv_.notify_all();
+    }
+
+    Statistics GetStatistics() const {
+        std::lock_guard<std::mutex> lock{mtx_};
+        return statistics_;
+    }
+
+    const Options& GetOptions() const { return options_; }
+
+private:
+    struct Pending {
+        Request request;
+        Time::time_point submitted;
+    };
+
+    Time::time_point Deadline() const {
+        const auto submitted = pending_.front().submitted;
+        auto deadline = submitted + options_.window;
+        if (options_.maxLatency.count() > 0) {
+            deadline = std::min(deadline, submitted + options_.maxLatency - expected_execution_time_);
+        }
+        return deadline;
+    }
+
+    void Loop() {
+        std::unique_lock<std::mutex> lock{mtx_};
+        while (true) {
+            cv_.wait(lock, [this] {
+                return (in_flight_ < options_.maxBatchesInFlight && !pending_.empty()) ||
+                       (is_stopped_ && pending_.empty());
+            });
+            if (pending_.empty()) {
+                return;
+            }
+            if (!is_stopped_ && pending_.size() < options_.maxBatchSize) {
+                cv_.wait_until(lock, Deadline(), [this] {
+                    return is_stopped_ || pending_.size() >= options_.maxBatchSize || Time::now() >= Deadline();
+                });
+            }
+            const auto batchSize = std::min(pending_.size(), options_.maxBatchSize);
+            Batch batch;
+            batch.reserve(batchSize);
+            std::transform(std::make_move_iterator(pending_.begin()),
+                           std::make_move_iterator(pending_.begin() + batchSize),
+                           std::back_inserter(batch),
+                           [](Pending&& p) { return std::move(p.request); });
+            pending_.erase(pending_.begin(), pending_.begin() + batchSize);
+            ++in_flight_;
+            ++statistics_.numBatches;
+            statistics_.numRequests += batchSize;
+            lock.unlock();
+            dispatch_(std::move(batch));
+            lock.lock();
+        }
+    }
+
+    const Options options_;
+    Dispatch dispatch_;
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<Pending> pending_;
+    std::size_t in_flight_ = 0;
+    Time::duration expected_execution_time_ = Time::duration::zero();
+    Statistics statistics_;
+    bool is_stopped_ = false;
+    std::thread thread_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
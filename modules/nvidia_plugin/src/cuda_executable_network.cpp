@@ -8,6 +8,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <ie_icore.hpp>
 #include <ie_plugin_config.hpp>
 #include <memory_manager/cuda_memory_manager.hpp>
@@ -19,6 +20,7 @@
 #include "nvidia/nvidia_config.hpp"
 #include "cuda_executable_network.hpp"
 #include "cuda_itt.hpp"
+#include "cuda_tuning_cache.hpp"
 #include "cuda_operation_registry.hpp"
 #include "cuda_plugin.hpp"
 #include "memory_manager/cuda_immutable_memory_block_builder.hpp"
@@ -84,6 +86,9 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
         model.read(dataBlob->buffer(), dataSize);
     }
 
+    // Read memory plan if network was exported with it
+    const auto memoryPlan = MemoryPlan::read(model);
+
     auto cnnNetwork = plugin_->GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
 
     // TODO: implement Import / Export of configuration options and merge with `cfg`
@@ -96,7 +101,8 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
     SetPointerToPlugin(plugin_->shared_from_this());
 
     try {
-        CompileNetwork(cnnNetwork.getFunction(), cnnNetwork.getInputsInfo(), cnnNetwork.getOutputsInfo());
+        CompileNetwork(
+            cnnNetwork.getFunction(), cnnNetwork.getInputsInfo(), cnnNetwork.getOutputsInfo(), memoryPlan);
         InitExecutor();  // creates thread-based executor using for async requests
         BenchmarkOptimalNumberOfRequests();
     } catch (const InferenceEngine::Exception&) {
@@ -110,12 +116,18 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
 
 void ExecutableNetwork::CompileNetwork(const std::shared_ptr<const ngraph::Function>& function,
                                        const InferenceEngine::InputsDataMap& inputInfoMap,
-                                       const InferenceEngine::OutputsDataMap& outputsInfoMap) {
+                                       const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                                       const std::optional<MemoryPlan>& memoryPlan) {
     CUDA::Device device{cfg_.deviceId};
     GraphTransformer transformer;
-    export_function_ =
-        transformer.export_transform(CUDA::Device{cfg_.deviceId}, function, inputInfoMap, outputsInfoMap, cfg_);
-    function_ = transformer.transform(CUDA::Device{cfg_.deviceId}, function, inputInfoMap, outputsInfoMap, cfg_);
+    // Memory plan is exported together with the function which already went through common passes,
+    // so imported networks skip them and only device passes are applied
+    auto transformed = memoryPlan
+                           ? transformer.transform_exported(device, function, cfg_)
+                           : transformer.export_and_transform(device, function, inputInfoMap, outputsInfoMap, cfg_);
+    export_function_ = std::move(transformed.exported);
+    function_ = std::move(transformed.executable);
+    transformation_timings_ = std::move(transformed.timings);
     // Generate backend specific blob mappings. For example Inference Engine uses not ov::Result nodes friendly name
     // as inference request output names but the name of the layer before.
     for (auto&& result : function_->get_results()) {
@@ -133,11 +145,47 @@ void ExecutableNetwork::CompileNetwork(const std::shared_ptr<const ngraph::Funct
     // Perform any other steps like allocation and filling backend specific memory handles and so on
     const std::string opBenchOptionString = cfg_.Get(NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK));
     const bool opBenchOption = opBenchOptionString == NVIDIA_CONFIG_VALUE(YES);
-    const auto creationContext = CreationContext{device, opBenchOption};
-
-    graph_ = std::make_unique<CudaGraph>(creationContext, function_);
+    const auto creationContext =
+        CreationContext{device,
+                        opBenchOption,
+                        cfg_.operation_implementations,
+                        cfg_.streams_per_infer_request,
+                        cfg_.best_memory_planning,
+                        cfg_.operation_cost_model};
+
+    if (memoryPlan) {
+        try {
+            graph_ = std::make_unique<CudaGraph>(creationContext, function_, *memoryPlan);
+        } catch (const InferenceEngine::Exception&) {
+            // Plan was made for another device or plugin version, so plan memory from scratch
+        }
+    }
+    if (!graph_) {
+        graph_ = std::make_unique<CudaGraph>(creationContext, function_);
+    }
 
     memory_pool_ = CreateMemoryPool();
+    if (cfg_.request_batch_size > 1) {
+        // While a batch is executed, inputs of the next one may be gathered and copied
+        constexpr std::size_t kBatchesInFlight = 2;
+        auto batchedFunction =
+            transformer.transform(device,
+                                  BatchedNetwork::MakeBatchedFunction(*function, cfg_.request_batch_size),
+                                  inputInfoMap,
+                                  outputsInfoMap,
+                                  cfg_);
+        batched_network_ = std::make_unique<BatchedNetwork>(
+            creationContext,
+            batchedFunction,
+            input_index_,
+            output_index_,
+            BatchedNetwork::Batcher::Options{
+                cfg_.request_batch_size, cfg_.request_batch_window, cfg_.request_batch_max_latency, kBatchesInFlight},
+            std::dynamic_pointer_cast<CudaThreadPool>(cuda_stream_executor_));
+    }
+    if (!cfg_.trace_file.empty()) {
+        trace_writer_ = std::make_shared<TraceWriter>(cfg_.trace_file);
+    }
 }
 
 void ExecutableNetwork::BenchmarkOptimalNumberOfRequests() {
@@ -146,70 +194,61 @@ void ExecutableNetwork::BenchmarkOptimalNumberOfRequests() {
         return;
     }
 
-    struct BenchmarkResult {
-        unsigned numberOfInferRequests;
-        unsigned fps;
-
-        bool operator<(const BenchmarkResult& other) const { return other.fps < this->fps; }
-    };
-
-    auto start = Time::now();
+    const auto start = Time::now();
+    const auto maxRequests = memory_pool_->Size();
+    const TuningCache cache{cfg_.throughput_tuning_cache};
+    const auto cacheKey =
+        cache.Enabled() ? TuningCache::MakeKey(*export_function_, CUDA::Device{cfg_.deviceId}) : std::string{};
+    if (const auto cached = cache.Get(cacheKey); cached && *cached > 0) {
+        memory_pool_->Resize(std::min<std::size_t>(*cached, maxRequests));
+        tuning_from_cache_ = true;
+    } else {
+        const auto optimalNumberOfRequests = SearchOptimalNumberOfRequests(maxRequests);
+        memory_pool_->Resize(optimalNumberOfRequests);
+        cache.Set(cacheKey, optimalNumberOfRequests);
+    }
+    tuning_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(Time::now() - start);
+
+    if (cfg_.throughput_tuning_background) {
+        constexpr auto kTuningWindow = std::chrono::seconds{2};
+        tuner_ = std::make_unique<InferRequestsTuner>(
+            memory_pool_, maxRequests, kTuningWindow, [cache, cacheKey](std::size_t numberOfRequests) {
+                cache.Set(cacheKey, numberOfRequests);
+            });
+    }
+}
 
+unsigned ExecutableNetwork::SearchOptimalNumberOfRequests(const unsigned maxRequests) {
     CreateBenchmarkInferRequest()->Infer();
 
-    auto numMemManagers = memory_pool_->Size();
     std::mutex mtx;
     std::condition_variable cond_var;
 
-    constexpr auto kTimesBenchmarkRun = 3;
-    std::vector<BenchmarkResult> benchmarks;
-    benchmarks.reserve(numMemManagers);
-    for (unsigned numInfers = 1; numInfers <= numMemManagers; ++numInfers) {
-        std::array<unsigned, kTimesBenchmarkRun> allFps{};
-        std::for_each(allFps.begin(), allFps.end(), [this, &mtx, &cond_var, &numInfers](auto& fps) {
-            fps = RunBenchmarkFor(numInfers, mtx, cond_var);
-        });
-        const unsigned fps = std::accumulate(allFps.begin(), allFps.end(), 0) / allFps.size();
-        benchmarks.push_back({numInfers, fps});
-    }
-    std::sort(benchmarks.begin(), benchmarks.end(), std::less<>{});
-
-    constexpr auto kNumberBestThroughputs = 3;
-    std::vector<BenchmarkResult> optimalBenchmarks{};
-    optimalBenchmarks.reserve(kNumberBestThroughputs);
-    for (unsigned i = 0; i < kNumberBestThroughputs && i < benchmarks.size(); ++i) {
-        optimalBenchmarks.push_back(benchmarks[i]);
-    }
-
-    constexpr auto kMaxFpsRelativeDiff = 0.01;
-    const auto avgFps = std::accumulate(optimalBenchmarks.begin(),
-                                        optimalBenchmarks.end(),
-                                        0,
-                                        [](const auto init, const auto& z) { return init + z.fps; }) /
-                        optimalBenchmarks.size();
-    const auto maxFpsDiff = kMaxFpsRelativeDiff * avgFps;
-
-    auto optimalBenchmarkResult = optimalBenchmarks[0];
-    for (auto& benchmark : optimalBenchmarks) {
-        if (std::fabs(optimalBenchmarkResult.fps - benchmark.fps) < maxFpsDiff &&
-            benchmark.numberOfInferRequests < optimalBenchmarkResult.numberOfInferRequests) {
-            optimalBenchmarkResult = benchmark;
+    // Throughput grows with the number of infer requests until the device is saturated,
+    // so the search stops once a few larger numbers do not give noticeable gain
+    constexpr auto kTimesBenchmarkRun = 2;
+    constexpr auto kMinRelativeGain = 0.02;
+    constexpr auto kMaxStepsWithoutGain = 2;
+    unsigned optimalNumberOfRequests = 1;
+    double optimalFps = 0.0;
+    int stepsWithoutGain = 0;
+    for (unsigned numInfers = 1; numInfers <= maxRequests && stepsWithoutGain < kMaxStepsWithoutGain; ++numInfers) {
+        double fps = 0.0;
+        for (int i = 0; i < kTimesBenchmarkRun; ++i) {
+            fps = std::max(fps, RunBenchmarkFor(numInfers, mtx, cond_var));
+        }
+        if (fps > optimalFps * (1.0 + kMinRelativeGain)) {
+            optimalNumberOfRequests = numInfers;
+            optimalFps = fps;
+            stepsWithoutGain = 0;
+        } else {
+            ++stepsWithoutGain;
         }
     }
-    fmt::print("Optimal number infer-requests = {}\n", optimalBenchmarkResult.numberOfInferRequests);
-    if (optimalBenchmarkResult.numberOfInferRequests < numMemManagers) {
-        memory_pool_->Resize(optimalBenchmarkResult.numberOfInferRequests);
-        fmt::print(
-            "Resize MemoryManagerPool from {} to {}\n", numMemManagers, optimalBenchmarkResult.numberOfInferRequests);
-    }
-    auto duration = Time::now() - start;
-    auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-    fmt::print("Time of benchmark for optimal number infer-requests = {} ms\n", durationMs.count());
+    return optimalNumberOfRequests;
 }
 
-unsigned int ExecutableNetwork::RunBenchmarkFor(const int numInfers,
-                                                std::mutex& mtx,
-                                                std::condition_variable& cond_var) {
+double ExecutableNetwork::RunBenchmarkFor(const int numInfers, std::mutex& mtx, std::condition_variable& cond_var) {
     std::unique_lock<std::mutex> lock{mtx};
     uint32_t callbackCalled = 0;
     std::vector<InferenceEngine::IInferRequestInternal::Ptr> inferRequests;
@@ -229,9 +268,8 @@ unsigned int ExecutableNetwork::RunBenchmarkFor(const int numInfers,
         e->StartAsync();
     }
     cond_var.wait(lock, [&callbackCalled, &numInfers] { return numInfers == callbackCalled; });
-    const auto duration = Time::now() - start;
-    const auto fps = numInfers * (std::chrono::seconds(1) / duration);
-    return fps;
+    const std::chrono::duration<double> duration = Time::now() - start;
+    return numInfers / duration.count();
 }
 
 void ExecutableNetwork::InitExecutor() {
@@ -274,6 +312,37 @@ std::size_t ExecutableNetwork::GetOptimalNumberOfStreams(const std::size_t const
     }
 }
 
+void ExecutableNetwork::RegisterLatencyHistograms(std::shared_ptr<const Profiler::LatencyHistograms> histograms) {
+    std::lock_guard<std::mutex> lock{latency_histograms_mtx_};
+    // Histograms of destroyed infer requests are dropped here, so the list doesn't grow unbounded
+    latency_histograms_.erase(std::remove_if(latency_histograms_.begin(),
+                                             latency_histograms_.end(),
+                                             [](const auto& h) { return h.expired(); }),
+                              latency_histograms_.end());
+    latency_histograms_.push_back(std::move(histograms));
+}
+
+std::map<std::string, std::vector<float>> ExecutableNetwork::GetLatencyPercentiles() const {
+    std::map<std::string, utils::LatencyHistogram::Snapshot> merged;
+    {
+        std::lock_guard<std::mutex> lock{latency_histograms_mtx_};
+        for (const auto& weakHistograms : latency_histograms_) {
+            if (const auto histograms = weakHistograms.lock()) {
+                for (const auto& [opName, histogram] : *histograms) {
+                    merged[opName].add(histogram.snapshot());
+                }
+            }
+        }
+    }
+    std::map<std::string, std::vector<float>> percentiles;
+    for (const auto& [opName, snapshot] : merged) {
+        if (snapshot.count() > 0) {
+            percentiles.emplace(opName, std::vector<float>{snapshot.percentile(0.5), snapshot.percentile(0.99)});
+        }
+    }
+    return percentiles;
+}
+
 std::shared_ptr<MemoryPool> ExecutableNetwork::CreateMemoryPool() {
     const auto& memoryManager = graph_->memoryManager();
     const auto constBlobSize = memoryManager.immutableTensors().memoryModel()->deviceMemoryBlockSize();
@@ -281,6 +350,13 @@ std::shared_ptr<MemoryPool> ExecutableNetwork::CreateMemoryPool() {
     const auto& memory_model = memoryManager.mutableTensorsMemoryModel();
     const auto memoryBlobSize = memory_model->deviceMemoryBlockSize();
     const auto numStreams = GetOptimalNumberOfStreams(constBlobSize + immutableWorkBuffersSize, memoryBlobSize);
+    if (cfg_.shared_memory_policy) {
+        return std::make_shared<MemoryPool>(numStreams, memory_model, plugin_->GetMemoryArena(cfg_));
+    }
+    if (cfg_.memory_pool_min_size && *cfg_.memory_pool_min_size < numStreams) {
+        return std::make_shared<MemoryPool>(
+            *cfg_.memory_pool_min_size, numStreams, cfg_.memory_pool_idle_timeout, memory_model);
+    }
     return std::make_shared<MemoryPool>(numStreams, memory_model);
 }
 
@@ -330,10 +406,37 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferReques
     return std::make_shared<CudaAsyncInferRequest>(std::static_pointer_cast<CudaInferRequest>(internalRequest),
                                                    _taskExecutor,
                                                    cuda_stream_executor_,
-                                                   _callbackExecutor);
+                                                   _callbackExecutor,
+                                                   batched_network_.get());
 }
 
-InferenceEngine::Parameter ExecutableNetwork::GetConfig(const std::string& name) const { return cfg_.Get(name); }
+InferenceEngine::Parameter ExecutableNetwork::GetConfig(const std::string& name) const {
+    if (name == NVIDIA_CONFIG_KEY(TRACE_FILE)) {
+        std::lock_guard<std::mutex> lock{trace_writer_mtx_};
+        return {trace_writer_ ? trace_writer_->Path() : std::string{}};
+    }
+    return cfg_.Get(name);
+}
+
+void ExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
+    for (const auto& [key, value] : config) {
+        if (key != NVIDIA_CONFIG_KEY(TRACE_FILE)) {
+            throwIEException(fmt::format("Config key {} can't be changed after network load", key));
+        }
+    }
+    for (const auto& [key, value] : config) {
+        const auto path = value.as<std::string>();
+        auto writer = path.empty() ? nullptr : std::make_shared<TraceWriter>(path);
+        std::lock_guard<std::mutex> lock{trace_writer_mtx_};
+        // Infer requests keep the previous writer until their current inference is completed
+        trace_writer_ = std::move(writer);
+    }
+}
+
+std::shared_ptr<TraceWriter> ExecutableNetwork::GetTraceWriter() const {
+    std::lock_guard<std::mutex> lock{trace_writer_mtx_};
+    return trace_writer_;
+}
 
 InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string& name) const {
     // TODO: return more supported values for metrics
@@ -342,12 +445,43 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string& name)
                              std::vector<std::string>{METRIC_KEY(NETWORK_NAME),
                                                       METRIC_KEY(SUPPORTED_METRICS),
                                                       METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                                      METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)});
+                                                      METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_ALLOCATED_BLOCKS),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_BLOCKS_IN_USE),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_PEAK_BLOCKS_IN_USE),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_REQUESTS),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_WAITS),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_TOTAL_WAIT_TIME),
+                                                      NVIDIA_METRIC_KEY(MEMORY_POOL_MAX_WAIT_TIME),
+                                                      NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_TIME),
+                                                      NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_FROM_CACHE),
+                                                      NVIDIA_METRIC_KEY(TRANSFORMATION_PASS_TIMES),
+                                                      NVIDIA_METRIC_KEY(OPERATION_LATENCY_PERCENTILES),
+                                                      NVIDIA_METRIC_KEY(REQUEST_BATCHES),
+                                                      NVIDIA_METRIC_KEY(REQUEST_BATCH_FILL_RATIO),
+                                                      NVIDIA_METRIC_KEY(MEMORY_PLAN_SIZE),
+                                                      NVIDIA_METRIC_KEY(MEMORY_PLAN_LOWER_BOUND),
+                                                      NVIDIA_METRIC_KEY(MEMORY_PLANNER)});
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {CONFIG_KEY(DEVICE_ID),
                                                CONFIG_KEY(PERF_COUNT),
                                                CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
-                                               NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS)};
+                                               NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS),
+                                               NVIDIA_CONFIG_KEY(OPERATION_IMPLEMENTATIONS),
+                                               NVIDIA_CONFIG_KEY(OPERATION_COST_MODEL),
+                                               NVIDIA_CONFIG_KEY(PROFILING_SAMPLING_INTERVAL),
+                                               NVIDIA_CONFIG_KEY(PROFILING_OPS_PER_INFERENCE),
+                                               NVIDIA_CONFIG_KEY(TRACE_FILE),
+                                               NVIDIA_CONFIG_KEY(STREAMS_PER_INFER_REQUEST),
+                                               NVIDIA_CONFIG_KEY(REQUEST_BATCH_SIZE),
+                                               NVIDIA_CONFIG_KEY(REQUEST_BATCH_WINDOW),
+                                               NVIDIA_CONFIG_KEY(REQUEST_BATCH_MAX_LATENCY),
+                                               NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_CACHE),
+                                               NVIDIA_CONFIG_KEY(THROUGHPUT_TUNING_BACKGROUND),
+                                               NVIDIA_CONFIG_KEY(MEMORY_POLICY),
+                                               NVIDIA_CONFIG_KEY(MEMORY_POOL_MIN_SIZE),
+                                               NVIDIA_CONFIG_KEY(MEMORY_POOL_IDLE_TIMEOUT),
+                                               NVIDIA_CONFIG_KEY(MEMORY_PLANNING)};
         auto streamExecutorConfigKeys = InferenceEngine::IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
             configKeys.emplace_back(configKey);
@@ -357,8 +491,50 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string& name)
         auto networkName = export_function_->get_friendly_name();
         IE_SET_METRIC_RETURN(NETWORK_NAME, networkName);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
-        const unsigned value = memory_pool_->Size();
+        unsigned value = memory_pool_->Size();
+        if (batched_network_) {
+            // Batches executed at the same time should be filled
+            const auto& options = batched_network_->GetOptions();
+            value = std::max<unsigned>(value, options.maxBatchSize * options.maxBatchesInFlight);
+        }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_ALLOCATED_BLOCKS) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().numAllocated)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_BLOCKS_IN_USE) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().numInUse)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_PEAK_BLOCKS_IN_USE) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().peakInUse)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_REQUESTS) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().numRequests)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_WAITS) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().numWaits)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_TOTAL_WAIT_TIME) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().totalWaitTime.count())};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_POOL_MAX_WAIT_TIME) == name) {
+        return {static_cast<std::uint64_t>(memory_pool_->GetStatistics().maxWaitTime.count())};
+    } else if (NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_TIME) == name) {
+        return {static_cast<std::uint64_t>(tuning_time_.count())};
+    } else if (NVIDIA_METRIC_KEY(THROUGHPUT_TUNING_FROM_CACHE) == name) {
+        return {tuning_from_cache_};
+    } else if (NVIDIA_METRIC_KEY(TRANSFORMATION_PASS_TIMES) == name) {
+        std::map<std::string, std::uint64_t> passTimes;
+        for (const auto& [pass, time] : transformation_timings_) {
+            passTimes.emplace(pass, static_cast<std::uint64_t>(time.count()));
+        }
+        return {passTimes};
+    } else if (NVIDIA_METRIC_KEY(OPERATION_LATENCY_PERCENTILES) == name) {
+        return {GetLatencyPercentiles()};
+    } else if (NVIDIA_METRIC_KEY(REQUEST_BATCHES) == name) {
+        const auto batches = batched_network_ ? batched_network_->GetStatistics().numBatches : 0;
+        return {static_cast<std::uint64_t>(batches)};
+    } else if (NVIDIA_METRIC_KEY(REQUEST_BATCH_FILL_RATIO) == name) {
+        return {static_cast<float>(batched_network_ ? batched_network_->FillRatio() : 0.0)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_PLAN_SIZE) == name) {
+        return {static_cast<std::uint64_t>(graph_->memoryManager().mutableTensorsMemoryModel()->deviceMemoryBlockSize())};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_PLAN_LOWER_BOUND) == name) {
+        return {static_cast<std::uint64_t>(graph_->memoryPlanningReport().lowerBound)};
+    } else if (NVIDIA_METRIC_KEY(MEMORY_PLANNER) == name) {
+        return {graph_->memoryPlanningReport().planner};
     } else {
         throwIEException(fmt::format("Unsupported ExecutableNetwork metric: {}", name));
     }
@@ -391,6 +567,8 @@ void ExecutableNetwork::Export(std::ostream& modelStream) {
     modelStream.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
     modelStream.write(reinterpret_cast<char*>(&m_constants[0]), dataSize);
 
+    graph_->memoryPlan().write(modelStream);
+
     // TODO: implement network precision, layout, preprocessing info serialization
 }
 
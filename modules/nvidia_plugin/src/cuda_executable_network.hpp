@@ -5,18 +5,24 @@
 #pragma once
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <mutex>
 #include <ngraph/function.hpp>
 
 #include "cuda_async_infer_request.hpp"
+#include "cuda_batched_network.hpp"
 #include "cuda_config.hpp"
 #include "cuda_graph.hpp"
 #include "cuda_infer_request.hpp"
+#include "cuda_infer_requests_tuner.hpp"
 #include "cuda_op_buffers_extractor.hpp"
+#include "cuda_trace_writer.hpp"
 #include "memory_manager/cuda_device_mem_block.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
+#include "memory_manager/cuda_memory_plan.hpp"
 #include "memory_manager/cuda_memory_pool.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 #include "ops/subgraph.hpp"
+#include "transformer/timed_pass_manager.hpp"
 
 class ExecNetworkTest;
 
@@ -54,6 +60,10 @@ public:
 
     InferenceEngine::Parameter GetMetric(const std::string& name) const override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    /**
+     * Only NVIDIA_TRACE_FILE may be changed after network load
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     std::string newRequestName() {
         return "Cuda" + std::to_string(cfg_.deviceId) + "_" + export_function_->get_friendly_name() + "_Req" +
                std::to_string(request_id_++);
@@ -70,16 +80,21 @@ private:
     friend class CudaInferRequest;
     void CompileNetwork(const std::shared_ptr<const ngraph::Function>& function,
                         const InferenceEngine::InputsDataMap& inputInfoMap,
-                        const InferenceEngine::OutputsDataMap& outputsInfoMap);
+                        const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                        const std::optional<MemoryPlan>& memoryPlan = std::nullopt);
     void InitExecutor();
     std::size_t GetOptimalNumberOfStreams(std::size_t constBlobSize, std::size_t memoryBlobSize) const;
+    std::shared_ptr<TraceWriter> GetTraceWriter() const;
+    void RegisterLatencyHistograms(std::shared_ptr<const Profiler::LatencyHistograms> histograms);
+    std::map<std::string, std::vector<float>> GetLatencyPercentiles() const;
     InferenceEngine::IInferRequestInternal::Ptr CreateBenchmarkInferRequestImpl(
         InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs);
     InferenceEngine::IInferRequestInternal::Ptr CreateBenchmarkInferRequest();
     std::shared_ptr<MemoryPool> CreateMemoryPool();
     int GetCudaDeviceId() const noexcept;
     void BenchmarkOptimalNumberOfRequests();
-    unsigned int RunBenchmarkFor(int numInfers, std::mutex& mtx, std::condition_variable& cond_var);
+    unsigned SearchOptimalNumberOfRequests(unsigned maxRequests);
+    double RunBenchmarkFor(int numInfers, std::mutex& mtx, std::condition_variable& cond_var);
 
     std::atomic<std::size_t> request_id_ = {0};
     Configuration cfg_;
@@ -91,6 +106,17 @@ private:
     std::map<std::string, std::size_t> output_index_;
     std::unique_ptr<CudaGraph> graph_;
     std::shared_ptr<MemoryPool> memory_pool_;
+    std::unique_ptr<InferRequestsTuner> tuner_;
+    // Executes infer requests in batches if NVIDIA_REQUEST_BATCH_SIZE > 1
+    std::unique_ptr<BatchedNetwork> batched_network_;
+    // Operation latency histograms of infer requests, which are merged on metric request
+    mutable std::mutex latency_histograms_mtx_;
+    mutable std::vector<std::weak_ptr<const Profiler::LatencyHistograms>> latency_histograms_;
+    mutable std::mutex trace_writer_mtx_;
+    std::shared_ptr<TraceWriter> trace_writer_;
+    bool tuning_from_cache_ = false;
+    std::chrono::milliseconds tuning_time_{0};
+    PassTimings transformation_timings_;
 };
 
 }  // namespace nvidia_gpu
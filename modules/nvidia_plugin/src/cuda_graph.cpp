@@ -10,6 +10,11 @@ namespace nvidia_gpu {
 CudaGraph::CudaGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function)
     : SubGraph(context, function) {}
 
+CudaGraph::CudaGraph(const CreationContext& context,
+                     const std::shared_ptr<const ngraph::Function>& function,
+                     const MemoryPlan& memoryPlan)
+    : SubGraph(context, function, memoryPlan) {}
+
 void CudaGraph::Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
     Workbuffers workbuffers{};
     workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
@@ -16,6 +16,9 @@ public:
     friend class ::ExecNetworkTest;
 
     CudaGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function);
+    CudaGraph(const CreationContext& context,
+              const std::shared_ptr<const ngraph::Function>& function,
+              const MemoryPlan& memoryPlan);
     ~CudaGraph() override = default;
 
     void Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const;
@@ -25,6 +25,8 @@
 #include "cuda_plugin.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ngraph/util.hpp"
+#include "utils/precision_convert.hpp"
+#include "utils/strided_copy.hpp"
 
 using namespace InferenceEngine;
 
@@ -91,7 +93,10 @@ CudaInferRequest::CudaInferRequest(const std::vector<std::shared_ptr<const ov::N
     : IInferRequestInternal(inputs, outputs),
       _executableNetwork(executableNetwork),
       cancellation_token_{[this] { memory_proxy_.reset(); }},
-      profiler_{_executableNetwork->cfg_.perfCount, *_executableNetwork->graph_},
+      profiler_{_executableNetwork->cfg_.perfCount,
+                *_executableNetwork->graph_,
+                Profiler::Sampling{_executableNetwork->cfg_.profiling_sampling_interval,
+                                   _executableNetwork->cfg_.profiling_ops_per_inference}},
       is_benchmark_mode_{isBenchmarkMode} {
     createInferRequest();
 }
@@ -103,7 +108,10 @@ CudaInferRequest::CudaInferRequest(const InferenceEngine::InputsDataMap& network
     : IInferRequestInternal(networkInputs, networkOutputs),
       _executableNetwork(executableNetwork),
       cancellation_token_{[this] { memory_proxy_.reset(); }},
-      profiler_{_executableNetwork->cfg_.perfCount, *_executableNetwork->graph_},
+      profiler_{_executableNetwork->cfg_.perfCount,
+                *_executableNetwork->graph_,
+                Profiler::Sampling{_executableNetwork->cfg_.profiling_sampling_interval,
+                                   _executableNetwork->cfg_.profiling_ops_per_inference}},
       is_benchmark_mode_{isBenchmarkMode} {
     createInferRequest();
 }
@@ -152,6 +160,7 @@ void CudaInferRequest::createInferRequest() {
     // actual list of profiling tasks
 
     std::string name = _executableNetwork->newRequestName();
+    profiler_.SetRequestName(name);
     _profilingTask = {
         openvino::itt::handle(name + "_Preprocess"),
         openvino::itt::handle(name + "_Postprocess"),
@@ -161,11 +170,15 @@ void CudaInferRequest::createInferRequest() {
 
     allocateDeviceBuffers();
     allocateBlobs();
+    if (!is_benchmark_mode_) {
+        _executableNetwork->RegisterLatencyHistograms(profiler_.GetLatencyHistograms());
+    }
 }
 
 void CudaInferRequest::inferPreprocess() {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::Preprocess]);
     cancellation_token_.Check();
+    profiler_.SetTraceWriter(is_benchmark_mode_ ? nullptr : _executableNetwork->GetTraceWriter());
     profiler_.StartStage();
     IInferRequestInternal::convertBatchedInputBlobs();
     IInferRequestInternal::execDataPreprocessing(_deviceInputs);
@@ -185,29 +198,11 @@ void CudaInferRequest::inferPreprocess() {
         auto index = _executableNetwork->input_index_.at(networkInput.first);
         const auto& parameter = _executableNetwork->function_->get_parameters().at(index);
         auto parameterShape = networkInput.second->getTensorDesc().getDims();
-        auto srcShape = networkInput.second->getTensorDesc().getBlockingDesc().getBlockDims();
         const auto& parameterType = parameter->get_element_type();
         auto mem_blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(networkInput.second);
-        auto isNonRoiDesc = [](const BlockingDesc& desc) {
-            size_t exp_stride = 1;
-            const auto& blockDims = desc.getBlockDims();
-            const auto& order = desc.getOrder();
-            const auto& strides = desc.getStrides();
-            const auto& offsetPaddingToData = desc.getOffsetPaddingToData();
-            for (size_t i = 0; i < blockDims.size(); i++) {
-                const size_t rev_idx = blockDims.size() - i - 1;
-                OPENVINO_ASSERT(order.at(rev_idx) == rev_idx,
-                                "ov::nvidia_gpu: unsupported tensors with mixed axes order: ",
-                                ngraph::vector_to_string(order));
-                if (strides.at(rev_idx) != exp_stride || offsetPaddingToData.at(rev_idx) != 0) {
-                    return false;
-                }
-                exp_stride *= blockDims.at(rev_idx);
-            }
-            return true;
-        };
         convertPrecision(_deviceInputs.at(inputName), networkInput.second);
-        if (isNonRoiDesc(networkInput.second->getTensorDesc().getBlockingDesc())) {
+        const auto& blockingDesc = networkInput.second->getTensorDesc().getBlockingDesc();
+        if (isDenseDesc(blockingDesc, parameterShape)) {
             // No ROI extraction is needed
             input_tensors_.at(index) =
                 std::make_shared<ngraph::HostTensor>(parameterType, parameterShape, mem_blob->rmap().as<void*>());
@@ -216,29 +211,13 @@ void CudaInferRequest::inferPreprocess() {
                             "ov::nvidia_gpu: Unsupported ROI tensor with element type having ",
                             std::to_string(parameterType.bitwidth()),
                             " bits size");
-            // Perform manual extraction of ROI tensor
-            // Basic implementation doesn't take axis order into account `desc.getBlockingDesc().getOrder()`
-            // Performance of manual extraction is not optimal, but it is ok for template implementation
-            input_tensors_.at(index) = std::make_shared<ngraph::HostTensor>(parameterType, parameterShape);
-            auto desc = mem_blob->getTensorDesc();
-            auto* src_data = mem_blob->rmap().as<uint8_t*>();
-            auto dst_tensor = std::dynamic_pointer_cast<ngraph::runtime::HostTensor>(input_tensors_.at(index));
-            OPENVINO_ASSERT(dst_tensor, "nvidia_gpu error: Can't cast created tensor to HostTensor");
-            auto* dst_data = dst_tensor->get_data_ptr<uint8_t>();
-            std::vector<size_t> indexes(parameterShape.size());
-            for (size_t dst_idx = 0; dst_idx < ov::shape_size(parameterShape); dst_idx++) {
-                size_t val = dst_idx;
-                size_t src_idx = 0;
-                for (size_t j1 = 0; j1 < indexes.size(); j1++) {
-                    size_t j = indexes.size() - j1 - 1;
-                    indexes.at(j) = val % parameterShape.at(j) + desc.getBlockingDesc().getOffsetPaddingToData().at(j);
-                    val /= parameterShape.at(j);
-                    src_idx += indexes.at(j) * desc.getBlockingDesc().getStrides().at(j);
-                }
-                std::copy(src_data + src_idx * parameterType.size(),
-                          src_data + (src_idx + 1) * parameterType.size(),
-                          dst_data + dst_idx * parameterType.size());
-            }
+            auto dst_tensor = std::make_shared<ngraph::HostTensor>(parameterType, parameterShape);
+            copyToDense(mem_blob->rmap().as<const void*>(),
+                        dst_tensor->get_data_ptr(),
+                        blockingDesc,
+                        parameterShape,
+                        parameterType.size());
+            input_tensors_.at(index) = std::move(dst_tensor);
         }
     }
     for (auto&& output : _outputs) {
@@ -297,9 +276,20 @@ void CudaInferRequest::waitPipeline(const ThreadContext& threadContext) {
     // TODO: probably all time will be spent in synchonize, out of reach of ThrowIfCanceled
     threadContext.stream().synchronize();
     memory_proxy_.reset();
+    if (auto& tuner = _executableNetwork->tuner_; tuner && !is_benchmark_mode_) {
+        tuner->OnInferCompleted();
+    }
     profiler_.StopStage(Profiler::WaitPipeline);
 }
 
+void CudaInferRequest::waitBatch() {
+    OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::WaitPipeline])
+    if (auto error = std::exchange(batch_error_, nullptr)) {
+        std::rethrow_exception(error);
+    }
+    cancellation_token_.Check();
+}
+
 void CudaInferRequest::inferPostprocess() {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::Postprocess]);
     cancellation_token_.Check();
@@ -587,63 +577,9 @@ InferenceEngine::Precision::ePrecision CudaInferRequest::convertType(ov::element
 
 template <typename SrcT, typename DstT>
 void CudaInferRequest::convertPrecision(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    std::copy_n(InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const SrcT*>(),
-                src->size(),
-                InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<DstT*>());
-}
-
-template <>
-void CudaInferRequest::convertPrecision<__half, float>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const __half*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<float*>(),
-                   __half2float);
-}
-
-template <>
-void CudaInferRequest::convertPrecision<float, __half>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const float*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<__half*>(),
-                   __float2half);
-}
-
-template <>
-void CudaInferRequest::convertPrecision<std::uint8_t, __half>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const std::uint8_t*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<__half*>(),
-                   [](auto x) { return __float2half(static_cast<float>(x)); });
-}
-
-template <>
-void CudaInferRequest::convertPrecision<__half, std::uint8_t>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const __half*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<std::uint8_t*>(),
-                   [](auto x) { return static_cast<std::uint8_t>(static_cast<float>(x)); });
-}
-
-template <>
-void CudaInferRequest::convertPrecision<std::int16_t, __half>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const std::int16_t*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<__half*>(),
-                   [](auto x) { return __float2half(static_cast<float>(x)); });
-}
-
-template <>
-void CudaInferRequest::convertPrecision<__half, std::int16_t>(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto begin = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const __half*>();
-    std::transform(begin,
-                   begin + src->size(),
-                   InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<std::int16_t*>(),
-                   [](auto x) { return static_cast<std::int16_t>(__half2float(x)); });
+    utils::convertPrecision(InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const SrcT*>(),
+                            InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<DstT*>(),
+                            src->size());
 }
 
 void CudaInferRequest::convertPrecision(const Blob::Ptr& src, const Blob::Ptr& dst) {
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <chrono>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/runtime/tensor.hpp>
@@ -28,6 +29,7 @@
 namespace ov {
 namespace nvidia_gpu {
 
+class BatchedNetwork;
 class ExecutableNetwork;
 
 // ! [infer_request:header]
@@ -53,12 +55,17 @@ public:
     void startPipeline(const ThreadContext& threadContext);
     void waitPipeline(const ThreadContext& threadContext);
     void inferPostprocess();
+    /**
+     * Replaces startPipeline and waitPipeline when the infer request is executed in a batch of BatchedNetwork
+     */
+    void waitBatch();
     /**
      * Cancel InferRequest
      */
     void Cancel() override;
 
 private:
+    friend class BatchedNetwork;
     void createInferRequest();
     void allocateDeviceBuffers();
     void allocateBlobs();
@@ -104,6 +111,8 @@ private:
     Profiler profiler_;
     std::vector<std::shared_ptr<ngraph::runtime::Tensor>> input_tensors_;
     std::vector<std::shared_ptr<ngraph::runtime::Tensor>> output_tensors_;
+    // Error of the last batch the infer request was executed in
+    std::exception_ptr batch_error_;
     bool is_benchmark_mode_;
 };
 // ! [infer_request:header]
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_infer_requests_tuner.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+InferRequestsTuner::InferRequestsTuner(std::shared_ptr<MemoryPool> memoryPool,
+                                       const std::size_t maxRequests,
+                                       const std::chrono::milliseconds window,
+                                       OnTuned onTuned)
+    : memory_pool_{std::move(memoryPool)},
+      max_requests_{maxRequests},
+      window_{window},
+      on_tuned_{std::move(onTuned)},
+      window_start_{Time::now()},
+      window_waits_{memory_pool_->GetStatistics().numWaits},
+      best_size_{memory_pool_->Size()},
+      trial_size_{best_size_} {}
+
+void InferRequestsTuner::OnInferCompleted() {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (converged_) {
+        return;
+    }
+    ++window_inferences_;
+    const auto now = Time::now();
+    if (now - window_start_ < window_) {
+        return;
+    }
+    const auto numWaits = memory_pool_->GetStatistics().numWaits;
+    const bool saturated = numWaits > window_waits_;
+    const double throughput = window_inferences_ / std::chrono::duration<double>(now - window_start_).count();
+    window_start_ = now;
+    window_inferences_ = 0;
+    window_waits_ = numWaits;
+    if (saturated) {
+        Step(throughput);
+    } else if (direction_ > 0) {
+        // Current load does not use the larger pool, so it can not be better
+        Step(0.0);
+    } else if (direction_ < 0) {
+        // Current load is served by the smaller pool without waiting
+        Step(best_throughput_);
+    }
+}
+
+bool InferRequestsTuner::Converged() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return converged_;
+}
+
+void InferRequestsTuner::Step(const double throughput) {
+    if (direction_ == 0) {
+        best_throughput_ = throughput;
+        direction_ = 1;
+        if (trial_size_ < max_requests_) {
+            Try(trial_size_ + 1);
+            return;
+        }
+    } else if (direction_ > 0) {
+        if (throughput > best_throughput_ * (1.0 + kMinRelativeGain)) {
+            best_size_ = trial_size_;
+            best_throughput_ = throughput;
+            improved_ = true;
+            if (trial_size_ < max_requests_) {
+                Try(trial_size_ + 1);
+            } else {
+                Finish();
+            }
+            return;
+        }
+        if (improved_) {
+            Finish();
+            return;
+        }
+    } else {
+        // Smaller pool is preferred while throughput does not drop noticeably
+        if (throughput < best_throughput_ * (1.0 - kMinRelativeGain)) {
+            Finish();
+            return;
+        }
+        best_size_ = trial_size_;
+        if (trial_size_ > 1) {
+            Try(trial_size_ - 1);
+        } else {
+            Finish();
+        }
+        return;
+    }
+    direction_ = -1;
+    if (best_size_ > 1) {
+        Try(best_size_ - 1);
+    } else {
+        Finish();
+    }
+}
+
+void InferRequestsTuner::Try(const std::size_t size) {
+    trial_size_ = size;
+    memory_pool_->Resize(size);
+}
+
+void InferRequestsTuner::Finish() {
+    converged_ = true;
+    memory_pool_->Resize(best_size_);
+    if (on_tuned_) on_tuned_(best_size_);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
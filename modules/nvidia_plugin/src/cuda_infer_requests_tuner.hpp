@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "memory_manager/cuda_memory_pool.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief InferRequestsTuner refines the number of concurrently executed infer
+ * requests of a network from throughput of live inferences.
+ *
+ * Throughput is measured in time windows. Only windows in which infer requests
+ * had to wait for MemoryPool are taken into account, because otherwise MemoryPool
+ * size does not limit the throughput. Starting from the current MemoryPool size
+ * the tuner tries larger sizes while throughput grows, then smaller sizes while
+ * throughput does not drop, and settles on the best one.
+ */
+class InferRequestsTuner {
+public:
+    using Time = std::chrono::steady_clock;
+    using OnTuned = std::function<void(std::size_t)>;
+
+    /**
+     * @param memoryPool MemoryPool which size is tuned
+     * @param maxRequests Upper limit of MemoryPool size
+     * @param window Duration of a single throughput measurement
+     * @param onTuned Callback which is called once with the tuned size
+     */
+    InferRequestsTuner(std::shared_ptr<MemoryPool> memoryPool,
+                       std::size_t maxRequests,
+                       std::chrono::milliseconds window,
+                       OnTuned onTuned);
+
+    /**
+     * Should be called by infer requests when an inference is completed
+     */
+    void OnInferCompleted();
+
+    bool Converged() const;
+
+private:
+    void Step(double throughput);
+    void Try(std::size_t size);
+    void Finish();
+
+    static constexpr double kMinRelativeGain = 0.02;
+
+    std::shared_ptr<MemoryPool> memory_pool_;
+    const std::size_t max_requests_;
+    const Time::duration window_;
+    OnTuned on_tuned_;
+
+    mutable std::mutex mtx_;
+    Time::time_point window_start_;
+    std::size_t window_inferences_ = 0;
+    std::size_t window_waits_ = 0;
+    std::size_t best_size_;
+    double best_throughput_ = 0.0;
+    std::size_t trial_size_;
+    int direction_ = 0;
+    bool improved_ = false;
+    bool converged_ = false;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -42,6 +42,18 @@ public:
           blob_outputs{outputs},
           outputs_mapping{outputMapping},
           is_benchmark_mode_{isBenchmarkMode} {}
+    /**
+     * Creates context of the same inference which runs operations on another stream of the thread
+     */
+    InferenceRequestContext(const InferenceRequestContext& other, const ThreadContext& threadContext)
+        : threadContext{threadContext},
+          token{other.token},
+          profiler{other.profiler},
+          blob_inputs{other.blob_inputs},
+          inputs_mapping{other.inputs_mapping},
+          blob_outputs{other.blob_outputs},
+          outputs_mapping{other.outputs_mapping},
+          is_benchmark_mode_{other.is_benchmark_mode_} {}
     // don't allow storing references to temporary
     template <typename... Args>
     InferenceRequestContext(InferenceEngine::BlobMap&& inputs, Args... args) = delete;
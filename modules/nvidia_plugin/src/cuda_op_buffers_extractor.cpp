@@ -15,8 +15,12 @@
 #include <openvino/op/tensor_iterator.hpp>
 #include <openvino/op/transpose.hpp>
 #include <openvino/op/unsqueeze.hpp>
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <transformer/nodes/concat_optimized.hpp>
+#include <transformer/nodes/split_optimized.hpp>
+#include <transformer/nodes/strided_slice_optimized.hpp>
 #include <utility>
 
 namespace ov {
@@ -24,10 +28,25 @@ namespace nvidia_gpu {
 
 OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                                                      bool is_stable_params,
-                                                     bool is_stable_results)
+                                                     bool is_stable_results,
+                                                     InPlacePredicate is_in_place_capable)
     : is_stable_params_{is_stable_params},
       is_stable_results_{is_stable_results},
-      num_ordered_nodes_{static_cast<unsigned long>(ordered_nodes.size())} {
+      num_ordered_nodes_{static_cast<unsigned long>(ordered_nodes.size())},
+      is_in_place_capable_{std::move(is_in_place_capable)} {
+    node_indices_.reserve(num_ordered_nodes_);
+    output_offsets_.reserve(num_ordered_nodes_ + 1);
+    output_offsets_.push_back(0);
+    for (std::size_t node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
+        const auto& node = ordered_nodes[node_idx];
+        node_indices_.emplace(node.get(), node_idx);
+        output_offsets_.push_back(output_offsets_.back() + node->get_output_size());
+    }
+    tensors_.resize(output_offsets_.back());
+    if (is_in_place_capable_) {
+        computeTensorLastUses(ordered_nodes);
+    }
+
     for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
         const auto& node = ordered_nodes[node_idx];
         if (IsParameterNode(*node))
@@ -40,21 +59,24 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             mergeConcatMutableTensors(node, node_idx);
         else if (isReshapeOnlyNode(*node))
             extractReshapeTensors(node, node_idx);
+        else if (IsViewNode(*node))
+            extractViewTensors(node);
         else
             extractMutableTensors(node, node_idx);
     }
     for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
         for (const auto& input : ordered_nodes[node_idx]->inputs()) {
             try {
-                const auto tensorName = GetTensorNameInternal(input);
-                const BufferID bufferId = tensor_names_.at(tensorName)->GetBuffer().GetId();
-                const bool isImmutableBuffer = immutable_buffers_.find(bufferId) != immutable_buffers_.end();
-                if (!isImmutableBuffer) {
-                    auto& mutableBuffer = mutable_buffers_.at(bufferId);
-                    if (node_idx > mutableBuffer.lifespan_end) {
-                        mutableBuffer.lifespan_end = node_idx;
+                const BufferID bufferId = tensor(input)->GetBuffer().GetId();
+                if (!findImmutableBuffer(bufferId)) {
+                    auto mutableBuffer = findMutableBuffer(bufferId);
+                    if (!mutableBuffer) {
+                        ThrowGraphIsBadFormedError(input);
                     }
-                    if (mutableBuffer.size < GetTensorByteSize(input)) {
+                    if (node_idx > mutableBuffer->lifespan_end) {
+                        mutableBuffer->lifespan_end = node_idx;
+                    }
+                    if (mutableBuffer->size < GetTensorByteSize(input)) {
                         ThrowBufferSizesAreNotMatchError(input);
                     }
                 }
@@ -67,9 +89,9 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
 
 std::vector<TensorID> OperationBuffersExtractor::inputTensorIds(const ov::Node& node) const {
     std::vector<TensorID> result{};
+    result.reserve(node.get_input_size());
     for (const auto& input : node.inputs()) {
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
-        result.push_back(*tensorId);
+        result.push_back(*tensor(input));
     }
     return result;
 }
@@ -77,104 +99,128 @@ std::vector<TensorID> OperationBuffersExtractor::inputTensorIds(const ov::Node&
 std::vector<TensorID> OperationBuffersExtractor::outputTensorIds(const ov::Node& node) const {
     if (IsResultNode(node)) return {};
     std::vector<TensorID> result{};
+    result.reserve(node.get_output_size());
     for (const auto& output : node.outputs()) {
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(output));
-        result.push_back(*tensorId);
+        result.push_back(*tensor(output));
     }
     return result;
 }
 
 int OperationBuffersExtractor::mutableBufferLifespanStart(BufferID buffer_id) const {
-    try {
-        return mutable_buffers_.at(buffer_id).lifespan_start;
-    } catch (std::out_of_range& e) {
+    const auto buffer = findMutableBuffer(buffer_id);
+    if (!buffer) {
         throwIEException(fmt::format("Buffer id {} is out of range.", buffer_id));
     }
+    return buffer->lifespan_start;
 }
 
 int OperationBuffersExtractor::mutableBufferLifespanEnd(BufferID buffer_id) const {
-    try {
-        return mutable_buffers_.at(buffer_id).lifespan_end;
-    } catch (std::out_of_range& e) {
+    const auto buffer = findMutableBuffer(buffer_id);
+    if (!buffer) {
+        throwIEException(fmt::format("Buffer id {} is out of range.", buffer_id));
+    }
+    return buffer->lifespan_end;
+}
+
+void OperationBuffersExtractor::extendMutableBufferLifespan(BufferID buffer_id, int lifespan_end) {
+    const auto buffer = findMutableBuffer(buffer_id);
+    if (!buffer) {
         throwIEException(fmt::format("Buffer id {} is out of range.", buffer_id));
     }
+    if (buffer->lifespan_end != -1) {
+        buffer->lifespan_end = std::max(buffer->lifespan_end, lifespan_end);
+    }
 }
 
 std::size_t OperationBuffersExtractor::mutableBufferSize(BufferID buffer_id) const {
-    try {
-        return mutable_buffers_.at(buffer_id).size;
-    } catch (std::out_of_range& e) {
+    const auto buffer = findMutableBuffer(buffer_id);
+    if (!buffer) {
         throwIEException(fmt::format("Buffer id {} is out of range.", buffer_id));
     }
+    return buffer->size;
 }
 
 gsl::span<const OperationBuffersExtractor::Byte> OperationBuffersExtractor::immutableBuffer(BufferID buffer_id) const {
-    try {
-        return immutable_buffers_.at(buffer_id);
-    } catch (std::out_of_range& e) {
+    const auto buffer = findImmutableBuffer(buffer_id);
+    if (!buffer) {
         throwIEException(fmt::format("Buffer id {} is out of range.", buffer_id));
     }
+    return *buffer;
 }
 
 std::vector<BufferID> OperationBuffersExtractor::mutableBuffersIds() const {
     std::vector<BufferID> result{};
-    for (const auto& pair : mutable_buffers_) {
-        result.push_back(pair.first);
+    for (BufferID id = 0; id < mutable_buffers_.size(); ++id) {
+        if (mutable_buffers_[id]) result.push_back(id);
     }
     return result;
 }
 
 std::vector<BufferID> OperationBuffersExtractor::immutableBuffersIds() const {
     std::vector<BufferID> result{};
-    for (const auto& pair : immutable_buffers_) {
-        result.push_back(pair.first);
+    for (BufferID id = 0; id < immutable_buffers_.size(); ++id) {
+        if (immutable_buffers_[id]) result.push_back(id);
     }
     return result;
 }
 
+BufferID OperationBuffersExtractor::addMutableBuffer(const BufferDesc& desc, int last_use) {
+    const BufferID id = next_buffer_id_++;
+    if (mutable_buffers_.size() <= id) mutable_buffers_.resize(id + 1);
+    mutable_buffers_[id] = desc;
+    if (is_in_place_capable_) {
+        if (buffer_last_uses_.size() <= id) buffer_last_uses_.resize(id + 1, -1);
+        buffer_last_uses_[id] = last_use;
+    }
+    return id;
+}
+
+const OperationBuffersExtractor::BufferDesc* OperationBuffersExtractor::findMutableBuffer(BufferID buffer_id) const {
+    if (buffer_id >= mutable_buffers_.size() || !mutable_buffers_[buffer_id]) return nullptr;
+    return &*mutable_buffers_[buffer_id];
+}
+
+OperationBuffersExtractor::BufferDesc* OperationBuffersExtractor::findMutableBuffer(BufferID buffer_id) {
+    return const_cast<BufferDesc*>(std::as_const(*this).findMutableBuffer(buffer_id));
+}
+
+const gsl::span<const OperationBuffersExtractor::Byte>* OperationBuffersExtractor::findImmutableBuffer(
+    BufferID buffer_id) const {
+    if (buffer_id >= immutable_buffers_.size() || !immutable_buffers_[buffer_id]) return nullptr;
+    return &*immutable_buffers_[buffer_id];
+}
+
 void OperationBuffersExtractor::mergeConcatMutableTensors(const NodePtr& node, int node_idx) {
-    std::vector<std::pair<std::string, TensorID::Ptr>> mergedTensors;
+    std::vector<std::pair<TensorID::Ptr, std::size_t>> mergedTensors;
     mergedTensors.reserve(node->inputs().size());
     for (const auto& input : node->inputs()) {
-        const auto& tensorName = GetTensorNameInternal(input.get_source_output());
-        const auto& tensorId = tensor_names_.at(tensorName);
+        const auto& tensorId = tensor(input);
         Expects(&tensorId->GetBuffer() == tensorId.get());
-        mergedTensors.emplace_back(tensorName, tensorId);
+        mergedTensors.emplace_back(tensorId, GetTensorByteSize(input));
     }
     Expects(!mergedTensors.empty());
 
-    std::vector<BufferID> mergedBufferIds;
-    std::transform(mergedTensors.begin(), mergedTensors.end(), std::back_inserter(mergedBufferIds), [](const auto& nt) {
-        return nt.second->GetBuffer().GetId();
-    });
-
-    int minLifespanStart = mutable_buffers_.at(mergedBufferIds.front()).lifespan_start;
-    for (const auto& bufferId : mergedBufferIds) {
-        const int lifespanStart = mutable_buffers_.at(bufferId).lifespan_start;
-        if (lifespanStart < minLifespanStart) {
-            minLifespanStart = lifespanStart;
-        }
+    int minLifespanStart = std::numeric_limits<int>::max();
+    for (const auto& [tensorId, tensorSize] : mergedTensors) {
+        const auto buffer = findMutableBuffer(tensorId->GetBuffer().GetId());
+        Expects(buffer);
+        minLifespanStart = std::min(minLifespanStart, buffer->lifespan_start);
     }
 
     const auto& output = node->output(0);
     auto mergedTensorByteSize = GetTensorByteSize(output);
-    auto parentTensor = std::make_shared<TensorID>(next_buffer_id_);
-    next_buffer_id_ += 1;
-    tensor_names_.emplace(GetTensorNameInternal(output), parentTensor);
-
-    mutable_buffers_.emplace(std::make_pair(parentTensor->GetBuffer().GetId(),
-                                            BufferDesc{minLifespanStart, node_idx, mergedTensorByteSize}));
-    for (const auto& bufferId : mergedBufferIds) {
-        mutable_buffers_.erase(bufferId);
+    auto parentTensor = std::make_shared<TensorID>(
+        addMutableBuffer(BufferDesc{minLifespanStart, node_idx, mergedTensorByteSize}, tensorLastUse(output)));
+    setTensor(output, parentTensor);
+    for (const auto& [tensorId, tensorSize] : mergedTensors) {
+        mutable_buffers_[tensorId->GetBuffer().GetId()].reset();
     }
 
     unsigned totalSize = 0;
-    for (const auto& t : mergedTensors) {
-        auto& tensor = tensor_names_.at(t.first);
-        tensor->SetParent(parentTensor, totalSize);
-        totalSize += mutable_tensor_sizes_.at(tensor->GetId());
+    for (const auto& [tensorId, tensorSize] : mergedTensors) {
+        tensorId->SetParent(parentTensor, totalSize);
+        totalSize += tensorSize;
     }
-    mutable_tensor_sizes_[parentTensor->GetId()] = totalSize;
     Expects(mergedTensorByteSize == totalSize);
 }
 
@@ -183,63 +229,83 @@ void OperationBuffersExtractor::extractReshapeTensors(const NodePtr& node, int n
         Expects(node->inputs().size() >= 1);
         Expects(node->outputs().size() == 1);
         const auto input = node->inputs().at(0);
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor(input);
         const auto output = node->outputs().at(0);
-        tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+        setTensor(output, tensorId);
     } catch (std::out_of_range&) {
         throwIEException(fmt::format("Failed to extract output buffer for reshape only node '{}'", node->get_name()));
     }
 }
 
+void OperationBuffersExtractor::extractViewTensors(const NodePtr& node) {
+    try {
+        const auto& inputTensor = tensor(node->input(0));
+        std::size_t offset = 0;
+        if (auto slice = std::dynamic_pointer_cast<const nodes::StridedSliceOptimized>(node)) {
+            const auto elementOffset = nodes::StridedSliceOptimized::get_contiguous_offset(*slice);
+            Expects(elementOffset);
+            offset = *elementOffset * slice->get_element_type().size();
+        }
+        // Outputs of splits follow each other in the input buffer
+        for (const auto& output : node->outputs()) {
+            auto view = std::make_shared<TensorID>(next_buffer_id_++);
+            view->SetParent(inputTensor, offset);
+            setTensor(output, std::move(view));
+            offset += GetTensorByteSize(output);
+        }
+    } catch (std::out_of_range&) {
+        throwIEException(fmt::format("Failed to extract output views for node '{}'", node->get_name()));
+    }
+}
+
 void OperationBuffersExtractor::extractMutableTensors(const NodePtr& node, int node_idx) {
+    if (is_in_place_capable_ && is_in_place_capable_(*node)) {
+        if (auto tensorId = findInPlaceTensor(*node, node_idx)) {
+            const auto& output = node->output(0);
+            buffer_last_uses_[tensorId->GetId()] = tensorLastUse(output);
+            setTensor(output, std::move(tensorId));
+            return;
+        }
+    }
     for (const auto& output : node->outputs()) {
         auto tensorByteSize = GetTensorByteSize(output);
-        mutable_tensor_sizes_[next_buffer_id_] = tensorByteSize;
-        mutable_buffers_.emplace(std::make_pair(next_buffer_id_, BufferDesc{node_idx, node_idx, tensorByteSize}));
-        tensor_names_.emplace(GetTensorNameInternal(output), std::make_shared<TensorID>(next_buffer_id_));
-        next_buffer_id_++;
+        const auto bufferId = addMutableBuffer(BufferDesc{node_idx, node_idx, tensorByteSize}, tensorLastUse(output));
+        setTensor(output, std::make_shared<TensorID>(bufferId));
     }
 }
 
 void OperationBuffersExtractor::extractParameterTensors(const NodePtr& node, int node_idx) {
     if (node->inputs().size() > 0) {
         Expects(node->get_output_size() > 0);
-        auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor(node->inputs().front());
         for (auto& output : node->outputs()) {
-            tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+            setTensor(output, tensorId);
         }
     } else {
         const int lastNodeIdx = is_stable_params_ ? num_ordered_nodes_ : node_idx;
         for (const auto& output : node->outputs()) {
             auto tensorByteSize = GetTensorByteSize(output);
-            mutable_tensor_sizes_[next_buffer_id_] = tensorByteSize;
-            mutable_buffers_.emplace(
-                std::make_pair(next_buffer_id_, BufferDesc{node_idx, lastNodeIdx, tensorByteSize}));
-            tensor_names_.emplace(GetTensorNameInternal(output), std::make_shared<TensorID>(next_buffer_id_));
-            next_buffer_id_++;
+            const auto bufferId =
+                addMutableBuffer(BufferDesc{node_idx, lastNodeIdx, tensorByteSize}, tensorLastUse(output));
+            setTensor(output, std::make_shared<TensorID>(bufferId));
         }
     }
 }
 
 void OperationBuffersExtractor::extractResultTensors(const NodePtr& node) {
     if (node->get_output_size() > 0) {
-        auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
+        const auto& tensorId = tensor(node->inputs().front());
         for (auto& output : node->outputs()) {
-            tensor_names_.emplace(GetTensorNameInternal(output), tensorId);
+            setTensor(output, tensorId);
         }
     }
     if (is_stable_results_) {
-        auto input = node->inputs().front().get_source_output();
-        const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
-        auto resultBuffer = std::find_if(mutable_buffers_.begin(), mutable_buffers_.end(), [&tensorId](const auto& mb) {
-            return mb.first == tensorId->GetId();
-        });
-        if (resultBuffer == mutable_buffers_.end()) {
+        const auto& tensorId = tensor(node->inputs().front());
+        auto resultBuffer = findMutableBuffer(tensorId->GetBuffer().GetId());
+        if (!resultBuffer) {
             throwIEException(fmt::format("Cannot find mutable buffer for Result with name {}", node->get_name()));
         }
-        resultBuffer->second.lifespan_end = num_ordered_nodes_;
+        resultBuffer->lifespan_end = num_ordered_nodes_;
     }
 }
 
@@ -247,10 +313,66 @@ void OperationBuffersExtractor::extractImmutableTensors(const NodePtr& node) {
     auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node);
     const Byte* ptr = reinterpret_cast<const Byte*>(constant->get_data_ptr());
     auto span = gsl::make_span(ptr, GetTensorByteSize(node->output(0)));
-    auto tensor = std::make_shared<TensorID>(next_buffer_id_);
-    immutable_buffers_.emplace(std::make_pair(tensor->GetId(), span));
-    tensor_names_.emplace(GetTensorNameInternal(node->output(0)), tensor);
-    next_buffer_id_++;
+    const BufferID bufferId = next_buffer_id_++;
+    immutable_buffers_.resize(next_buffer_id_);
+    immutable_buffers_[bufferId] = span;
+    setTensor(node->output(0), std::make_shared<TensorID>(bufferId));
+}
+
+TensorID::Ptr OperationBuffersExtractor::findInPlaceTensor(const ov::Node& node, int node_idx) const {
+    if (node.get_output_size() != 1) return nullptr;
+    const auto output = node.output(0);
+    const auto inputs = node.inputs();
+    for (const auto& input : inputs) {
+        if (input.get_element_type() != output.get_element_type() || input.get_shape() != output.get_shape()) {
+            continue;
+        }
+        const auto& tensorId = tensor(input);
+        if (&tensorId->GetBuffer() != tensorId.get()) {
+            continue;
+        }
+        const BufferID bufferId = tensorId->GetId();
+        const auto buffer = findMutableBuffer(bufferId);
+        // Buffers of stable parameters are alive till the end of the graph, so they are never reused
+        if (!buffer || buffer->size != GetTensorByteSize(output) || buffer->lifespan_end > node_idx ||
+            bufferId >= buffer_last_uses_.size() || buffer_last_uses_[bufferId] != node_idx) {
+            continue;
+        }
+        // Other inputs reading the same buffer should read every element before it is overwritten
+        const bool isReadElementwise = std::all_of(inputs.begin(), inputs.end(), [&](const auto& other) {
+            return tensor(other)->GetBuffer().GetId() != bufferId || other.get_shape() == output.get_shape();
+        });
+        if (isReadElementwise) {
+            return tensorId;
+        }
+    }
+    return nullptr;
+}
+
+void OperationBuffersExtractor::computeTensorLastUses(gsl::span<const NodePtr> ordered_nodes) {
+    tensor_last_uses_.assign(tensors_.size(), -1);
+    // Consumers follow their producers in the execution order, so their last uses are already known
+    for (int node_idx = static_cast<int>(num_ordered_nodes_) - 1; node_idx >= 0; node_idx--) {
+        for (const auto& output : ordered_nodes[node_idx]->outputs()) {
+            auto& lastUse = tensor_last_uses_[tensorIndex(output)];
+            for (const auto& input : output.get_target_inputs()) {
+                const auto consumer = node_indices_.find(input.get_node());
+                if (consumer == node_indices_.end()) {
+                    continue;
+                }
+                lastUse = std::max(lastUse, static_cast<int>(consumer->second));
+                if (isAliasingNode(*consumer->first)) {
+                    for (const auto& aliasOutput : consumer->first->outputs()) {
+                        lastUse = std::max(lastUse, tensor_last_uses_[tensorIndex(aliasOutput)]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int OperationBuffersExtractor::tensorLastUse(const ov::Output<ov::Node>& output) const {
+    return tensor_last_uses_.empty() ? -1 : tensor_last_uses_[tensorIndex(output)];
 }
 
 WorkbufferIds OperationBuffersExtractor::processWorkbufferRequest(int node_idx, const WorkbufferRequest& request) {
@@ -262,9 +384,7 @@ WorkbufferIds OperationBuffersExtractor::processWorkbufferRequest(int node_idx,
     }
     for (auto size : request.mutable_sizes) {
         // mutable workbuffers share the same memory space with mutable I/O buffers
-        mutable_buffers_.emplace(std::make_pair(next_buffer_id_, BufferDesc{node_idx, node_idx, size}));
-        result.mutableIds.push_back(next_buffer_id_);
-        next_buffer_id_++;
+        result.mutableIds.push_back(addMutableBuffer(BufferDesc{node_idx, node_idx, size}));
     }
     return result;
 }
@@ -288,13 +408,16 @@ MemoryModel::Ptr OperationBuffersExtractor::createConstantMemoryModel() const {
     return constants_block_builder.build();
 }
 
-MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel() const {
-    MemoryModelBuilder mutable_model_builder;
+MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel(std::vector<MemoryPlanner::Ptr> planners,
+                                                                     MemoryModelBuilder::PlanningReport* report) const {
+    MemoryModelBuilder mutable_model_builder{std::move(planners)};
     for (auto id : mutableBuffersIds()) {
         mutable_model_builder.addAllocation(
             id, mutableBufferLifespanStart(id), mutableBufferLifespanEnd(id), mutableBufferSize(id));
     }
-    return mutable_model_builder.build();
+    auto model = mutable_model_builder.build();
+    if (report) *report = mutable_model_builder.planningReport();
+    return model;
 }
 
 MemoryModel::Ptr OperationBuffersExtractor::createImmutableMemoryModel() const {
@@ -322,11 +445,22 @@ bool OperationBuffersExtractor::IsConcatOptimizedNode(const ov::Node& node) {
     return dynamic_cast<const nodes::ConcatOptimized*>(&node) != nullptr;
 }
 
+bool OperationBuffersExtractor::IsViewNode(const ov::Node& node) {
+    return dynamic_cast<const nodes::SplitOptimized*>(&node) != nullptr ||
+           dynamic_cast<const nodes::VariadicSplitOptimized*>(&node) != nullptr ||
+           dynamic_cast<const nodes::StridedSliceOptimized*>(&node) != nullptr;
+}
+
 bool OperationBuffersExtractor::isReshapeOnlyNode(const ov::Node& node) {
     return ov::is_type<const ov::op::v1::Reshape>(&node) || ov::is_type<const ov::op::v0::Squeeze>(&node) ||
            ov::is_type<const ov::op::v0::Unsqueeze>(&node);
 }
 
+bool OperationBuffersExtractor::isAliasingNode(const ov::Node& node) {
+    return IsParameterNode(node) || IsResultNode(node) || IsConcatOptimizedNode(node) || isReshapeOnlyNode(node) ||
+           IsViewNode(node);
+}
+
 void OperationBuffersExtractor::ThrowBufferSizesAreNotMatchError(const ov::Input<ov::Node>& input) {
     throwIEException(
         fmt::format("Buffer size of Input #{} of {} node and corresponding "
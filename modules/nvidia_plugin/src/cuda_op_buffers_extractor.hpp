@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <gsl/span>
 #include <memory>
 #include <memory_manager/cuda_device_mem_block.hpp>
@@ -11,6 +12,8 @@
 #include <memory_manager/model/cuda_memory_model.hpp>
 #include <memory_manager/model/cuda_memory_model_builder.hpp>
 #include <ngraph/node.hpp>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,7 +32,7 @@ class OperationBuffersExtractor {
 public:
     using NodePtr = std::shared_ptr<ov::Node>;
     using Byte = char;
-    static constexpr char kOutputNumberSeparator = '_';
+    using InPlacePredicate = std::function<bool(const ov::Node&)>;
 
     /**
      * c-tor
@@ -37,11 +40,15 @@ public:
      * Nodes are ordered in their execution order.
      * @param [in] is_stable_params Makes input parameters alive for whole graph's life time
      * @param [in] is_stable_results Makes output results alive for till end of the graph's life time
+     * @param [in] is_in_place_capable Tells whether a node may write its output into the buffer
+     * of an input with the same shape and element type. If set, such node reuses the buffer of
+     * an input which isn't used by any of the following nodes instead of allocating a new one
      * @throws InferenceEngineException if the given subgraph is bad formed
      */
     OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                               bool is_stable_params = false,
-                              bool is_stable_results = false);
+                              bool is_stable_results = false,
+                              InPlacePredicate is_in_place_capable = {});
 
     /**
      * Provides input tensors ids of the given ngraph node
@@ -77,6 +84,17 @@ public:
      */
     int mutableBufferLifespanEnd(BufferID buffer_id) const;
 
+    /**
+     * Makes the given mutable buffer alive at least till the given node. It's used when
+     * operations are executed concurrently, so the memory of a buffer may be reused only
+     * after all operations which could run concurrently with its users
+     * @param buffer_id Identifier of a buffer
+     * @param lifespan_end Index of the last node the buffer should be alive at
+     * @throws InferenceEngine::details::InferenceEngineException
+     * if buffer with the provided index doesn't exist
+     */
+    void extendMutableBufferLifespan(BufferID buffer_id, int lifespan_end);
+
     /**
      * Provides size of the given mutable buffer
      * @param buffer_id Identifier of a buffer.
@@ -133,9 +151,12 @@ public:
 
     /**
      * Create mutable memory model
+     * @param [in] planners Planning strategies, the smallest memory blob wins
+     * @param [out] report Planning result if not nullptr
      * @return MemoryModel for mutable buffers
      */
-    MemoryModel::Ptr createMutableMemoryModel() const;
+    MemoryModel::Ptr createMutableMemoryModel(std::vector<MemoryPlanner::Ptr> planners = defaultMemoryPlanners(),
+                                              MemoryModelBuilder::PlanningReport* report = nullptr) const;
 
     /**
      * Create immutable memory model
@@ -192,6 +213,14 @@ private:
      */
     void extractReshapeTensors(const NodePtr& node, int node_idx);
 
+    /**
+     * Encapsulates tensors extraction for the nodes which outputs are contiguous
+     * parts of the input (nodes that checked by @IsViewNode(...)). Output tensors
+     * are children of the input tensor, so no new buffers are allocated
+     * @param node SplitOptimized, VariadicSplitOptimized or StridedSliceOptimized node
+     */
+    void extractViewTensors(const NodePtr& node);
+
     /**
      * Encapsulates mutable tensors extraction for the given node
      * @param node ngraph node from which tensors to be extracted
@@ -206,6 +235,30 @@ private:
      */
     void mergeConcatMutableTensors(const NodePtr& node, int node_idx);
 
+    /**
+     * Looks for an input tensor which buffer can be reused by the output of the in-place capable node
+     * @param node In-place capable node
+     * @param node_idx Current node index
+     * @returns Input tensor or nullptr if there is no such tensor
+     */
+    TensorID::Ptr findInPlaceTensor(const ov::Node& node, int node_idx) const;
+
+    /**
+     * Computes index of the last node which uses every tensor, directly or
+     * through nodes that alias their input buffers
+     */
+    void computeTensorLastUses(gsl::span<const NodePtr> ordered_nodes);
+
+    /**
+     * @returns Index of the last node which uses the output tensor or -1 if it's unknown
+     */
+    int tensorLastUse(const ov::Output<ov::Node>& output) const;
+
+    /**
+     * Checks whether the output tensors of the given node alias its input buffers
+     */
+    static bool isAliasingNode(const ov::Node& node);
+
     /**
      * Encapsulates immutable tensors extraction for the given node
      * @param node ngraph node from which tensors to be extracted
@@ -213,26 +266,67 @@ private:
     void extractImmutableTensors(const NodePtr& node);
 
     /**
-     * Provides internal tensor name
+     * Provides internal tensor index. Tensors are stored densely by node index
+     * and output index, so no string formatting or hashing of names is needed
      * @param [in] output Output to process
-     * @returns internal tensor name
+     * @returns internal tensor index
+     * @throws std::out_of_range if the output's node isn't in the ordered nodes
      */
     template <class Node>
-    static inline std::string GetTensorNameInternal(const ov::Output<Node>& output) {
-        return output.get_node()->get_name() + kOutputNumberSeparator + std::to_string(output.get_index());
+    std::size_t tensorIndex(const ov::Output<Node>& output) const {
+        return output_offsets_[node_indices_.at(output.get_node())] + output.get_index();
     }
 
     /**
-     * Provides internal tensor name
+     * Provides internal tensor index of the output connected to the input
      * @param [in] input Input to process
-     * @returns internal tensor name
+     * @returns internal tensor index
+     * @throws std::out_of_range if the input isn't connected to any extracted output
      */
     template <class Node>
-    static inline std::string GetTensorNameInternal(const ov::Input<Node>& input) {
-        const auto output = input.get_source_output();
-        return output.get_node()->get_name() + kOutputNumberSeparator + std::to_string(output.get_index());
+    std::size_t tensorIndex(const ov::Input<Node>& input) const {
+        return tensorIndex(input.get_source_output());
     }
 
+    /**
+     * Provides tensor of the given output or of the output connected to the given input
+     * @throws std::out_of_range if the tensor isn't extracted yet
+     */
+    template <class Port>
+    const TensorID::Ptr& tensor(const Port& port) const {
+        const auto& item = tensors_.at(tensorIndex(port));
+        if (!item) throw std::out_of_range{"Tensor isn't extracted"};
+        return item;
+    }
+
+    /**
+     * Binds tensor to the output unless the output already has one
+     */
+    template <class Node>
+    void setTensor(const ov::Output<Node>& output, TensorID::Ptr tensorId) {
+        auto& item = tensors_.at(tensorIndex(output));
+        if (!item) item = std::move(tensorId);
+    }
+
+    /**
+     * Adds new mutable buffer
+     * @param desc Buffer description
+     * @param last_use Index of the last node which uses the buffer, if known
+     * @returns Identifier of the buffer
+     */
+    BufferID addMutableBuffer(const BufferDesc& desc, int last_use = -1);
+
+    /**
+     * @returns Mutable buffer or nullptr if there is no mutable buffer with the given id
+     */
+    const BufferDesc* findMutableBuffer(BufferID buffer_id) const;
+    BufferDesc* findMutableBuffer(BufferID buffer_id);
+
+    /**
+     * @returns Immutable buffer or nullptr if there is no immutable buffer with the given id
+     */
+    const gsl::span<const Byte>* findImmutableBuffer(BufferID buffer_id) const;
+
     /**
      * Checks whether the given node is a parameter node
      */
@@ -253,6 +347,11 @@ private:
      */
     static bool IsConcatOptimizedNode(const ov::Node& node);
 
+    /**
+     * Checks whether the given node outputs are views of its input (split or slice optimized)
+     */
+    static bool IsViewNode(const ov::Node& node);
+
     /**
      * Exception helper
      */
@@ -264,15 +363,22 @@ private:
     static void ThrowGraphIsBadFormedError(const ov::Input<ov::Node>& input);
 
 private:
-    std::unordered_map<BufferID, BufferDesc> mutable_buffers_;
-    std::unordered_map<BufferID, size_t> mutable_tensor_sizes_;
-    std::unordered_map<BufferID, gsl::span<const Byte>> immutable_buffers_;
+    // Buffers are indexed by BufferID, which are allocated densely
+    std::vector<std::optional<BufferDesc>> mutable_buffers_;
+    std::vector<std::optional<gsl::span<const Byte>>> immutable_buffers_;
     std::unordered_map<BufferID, size_t> immutable_workbuffers_;
-    std::unordered_map<std::string, TensorID::Ptr> tensor_names_;
+    // Tensors are indexed by output_offsets_[node index] + output index
+    std::unordered_map<const ov::Node*, std::size_t> node_indices_;
+    std::vector<std::size_t> output_offsets_;
+    std::vector<TensorID::Ptr> tensors_;
+    // In-place reuse only, indexed as tensors_ and mutable_buffers_ respectively
+    std::vector<int> tensor_last_uses_;
+    std::vector<int> buffer_last_uses_;
     unsigned next_buffer_id_{};
     const bool is_stable_params_ = false;
     const bool is_stable_results_ = false;
     const unsigned long num_ordered_nodes_ = 0;
+    const InPlacePredicate is_in_place_capable_;
 };
 
 }  // namespace nvidia_gpu
@@ -4,7 +4,12 @@
 
 #include "cuda_operation_registry.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <error.hpp>
 #include <ngraph/node.hpp>
+#include <sstream>
 
 namespace ov {
 namespace nvidia_gpu {
@@ -15,8 +20,29 @@ OperationRegistry& OperationRegistry::getInstance() {
 }
 
 void OperationRegistry::registerOp(const std::string& opName, OperationBuilder&& builder) {
-    if (!registered_operations_.try_emplace(opName, move(builder)).second)
+    if (registered_implementations_.count(opName) > 0 ||
+        !registered_operations_.try_emplace(opName, move(builder)).second)
+        throw std::runtime_error{"Operation " + opName + " is already registered !!"};
+}
+
+void OperationRegistry::registerImplementation(const std::string& opName,
+                                               const std::string& implName,
+                                               OperationBuilder&& builder,
+                                               CostEstimator&& cost) {
+    if (registered_operations_.count(opName) > 0)
         throw std::runtime_error{"Operation " + opName + " is already registered !!"};
+    auto& implementations = registered_implementations_[opName];
+    if (std::any_of(implementations.begin(), implementations.end(), [&](const auto& impl) {
+            return impl.name == implName;
+        }))
+        throw std::runtime_error{"Implementation " + implName + " of operation " + opName +
+                                 " is already registered !!"};
+    implementations.push_back({implName, move(builder), move(cost)});
+}
+
+void OperationRegistry::registerInPlaceOp(const std::string& opName) {
+    if (!in_place_operations_.emplace(opName).second)
+        throw std::runtime_error{"Operation " + opName + " is already declared in-place !!"};
 }
 
 bool OperationRegistry::hasOperation(const std::shared_ptr<ov::Node>& node) {
@@ -30,24 +56,84 @@ std::optional<std::type_index> OperationRegistry::getOperationType(const std::sh
     return std::nullopt;
 }
 
+bool OperationRegistry::isInPlaceCapable(const ov::Node& node) const {
+    return in_place_operations_.count(node.get_type_info().name) > 0;
+}
+
 bool OperationRegistry::hasOperation(const std::string& name) {
-    return registered_operations_.end() != registered_operations_.find(name);
+    return registered_operations_.end() != registered_operations_.find(name) ||
+           registered_implementations_.end() != registered_implementations_.find(name);
 }
 
 OperationBase::Ptr OperationRegistry::createOperation(const CreationContext& context,
                                                       const std::shared_ptr<ov::Node>& node,
                                                       std::vector<TensorID>&& inIds,
-                                                      std::vector<TensorID>&& outIds) {
-    auto& opBuilder = registered_operations_.at(node->get_type_info().name);
-    return opBuilder(context, node, move(inIds), move(outIds));
+                                                      std::vector<TensorID>&& outIds,
+                                                      Selection* selection) {
+    const std::string opName = node->get_type_info().name;
+    if (selection) {
+        *selection = {};
+    }
+    const auto implementations = registered_implementations_.find(opName);
+    if (implementations == registered_implementations_.end()) {
+        auto& opBuilder = registered_operations_.at(opName);
+        return opBuilder(context, node, move(inIds), move(outIds));
+    }
+
+    // Candidates are taken in the order of registration or ranked by the cost model if it is enabled;
+    // an implementation requested by configuration goes first
+    const bool useCostModel = context.operationCostModel();
+    std::vector<std::pair<double, const ImplementationEntry*>> candidates;
+    for (const auto& impl : implementations->second) {
+        candidates.emplace_back(useCostModel ? impl.cost(*node) : 0.0, &impl);
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+    std::stringstream costs;
+    for (const auto& [cost, impl] : candidates) {
+        costs << (costs.tellp() > 0 ? ", " : "")
+              << (useCostModel ? fmt::format("{}={:.0f}", impl->name, cost) : impl->name);
+    }
+    std::string reason = useCostModel ? fmt::format("cost model ({})", costs.str()) : "registration order";
+    const auto& requested = context.operationImplementations();
+    if (const auto found = requested.find(opName); found != requested.end()) {
+        const auto candidate = std::find_if(candidates.begin(), candidates.end(), [&](const auto& c) {
+            return c.second->name == found->second;
+        });
+        if (candidate == candidates.end()) {
+            throwIEException(fmt::format("Implementation '{}' of operation {} is not registered, available: {}",
+                                         found->second,
+                                         opName,
+                                         costs.str()));
+        }
+        std::rotate(candidates.begin(), candidate, candidate + 1);
+        reason = "configuration";
+    }
+
+    std::stringstream exception_msg;
+    for (const auto& [cost, impl] : candidates) {
+        try {
+            auto operation = impl->builder(context, node, IndexCollection{inIds}, IndexCollection{outIds});
+            if (selection) {
+                selection->implementation = impl->name;
+                selection->reason = exception_msg.tellp() > 0 ? reason + ", preferred implementations failed" : reason;
+            }
+            return operation;
+        } catch (const std::exception& e) {
+            exception_msg << fmt::format("\nFailed to create {} implementation: {}", impl->name, e.what());
+        }
+    }
+    throwIEException(fmt::format("{} node is not supported:{}", opName, exception_msg.str()));
 }
 
 OperationBase::Ptr OperationRegistry::createOperation(const CreationContext& context,
                                                       const std::shared_ptr<ov::Node>& node,
                                                       gsl::span<const TensorID> inIds,
-                                                      gsl::span<const TensorID> outIds) {
+                                                      gsl::span<const TensorID> outIds,
+                                                      Selection* selection) {
     auto toVector = [](gsl::span<const TensorID> s) { return std::vector<TensorID>(s.begin(), s.end()); };
-    return createOperation(context, node, toVector(inIds), toVector(outIds));
+    return createOperation(context, node, toVector(inIds), toVector(outIds), selection);
 }
 
 }  // namespace nvidia_gpu
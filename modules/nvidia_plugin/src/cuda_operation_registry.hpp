@@ -5,9 +5,12 @@
 #pragma once
 
 #include <functional>
+#include <string>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "cuda_operation_base.hpp"
 
@@ -42,6 +45,21 @@ template <typename TOperation>
 inline constexpr bool isConstructibleWithNodeOpRef =
     std::conditional_t<hasNodeOp<TOperation>, IsConstructibleWithNodeOpRef<TOperation>, std::false_type>::value;
 
+template <typename TOperation>
+OperationBase::Ptr buildOperation(const CreationContext& context,
+                                  const std::shared_ptr<ov::Node>& node,
+                                  OperationBase::IndexCollection&& inputs,
+                                  OperationBase::IndexCollection&& outputs) {
+    if constexpr (isConstructibleWithNodeOpRef<TOperation>) {
+        return std::make_shared<TOperation>(
+            context, downcast<const typename TOperation::NodeOp>(node), std::move(inputs), std::move(outputs));
+    } else if constexpr (isConstructibleWithNodeRef<TOperation>) {
+        return std::make_shared<TOperation>(context, *node, std::move(inputs), std::move(outputs));
+    } else {
+        return std::make_shared<TOperation>(context, node, std::move(inputs), std::move(outputs));
+    }
+}
+
 }  // namespace details
 
 class OperationRegistry final {
@@ -54,45 +72,87 @@ public:
     public:
         static_assert(std::is_base_of_v<OperationBase, TOperation>, "TOperation should derive from OperationBase");
         explicit Register(const std::string& opName) {
-            getInstance().registerOp(
-                opName,
-                [](const CreationContext& context,
-                   const std::shared_ptr<ov::Node>& node,
-                   IndexCollection&& inputs,
-                   IndexCollection&& outputs) {
-                    if constexpr (details::isConstructibleWithNodeOpRef<TOperation>) {
-                        return std::make_shared<TOperation>(
-                            context, downcast<const typename TOperation::NodeOp>(node), move(inputs), move(outputs));
-                    } else {
-                        if constexpr (details::isConstructibleWithNodeRef<TOperation>) {
-                            return std::make_shared<TOperation>(context, *node, move(inputs), move(outputs));
-                        } else {
-                            return std::make_shared<TOperation>(context, node, move(inputs), move(outputs));
-                        }
-                    }
-                });
+            getInstance().registerOp(opName, &details::buildOperation<TOperation>);
             getInstance().registerOpType<TOperation>(opName);
         }
     };
 
+    /**
+     * Host-side estimate of execution time of an operation implementation for the given node
+     */
+    using CostEstimator = std::function<double(const ov::Node&)>;
+
+    /**
+     * Registers one of several implementations of the named operation. When an operation has
+     * implementations, createOperation tries them in the order of registration, or of increasing
+     * estimated cost if CreationContext::operationCostModel is set, and takes the first one which
+     * can be created for the node. Configuration may request a particular implementation per
+     * operation type, see CreationContext::operationImplementations
+     */
+    template <typename TOperation>
+    class Implementation {
+    public:
+        static_assert(std::is_base_of_v<OperationBase, TOperation>, "TOperation should derive from OperationBase");
+        Implementation(const std::string& opName, const std::string& implName, CostEstimator&& cost) {
+            getInstance().registerImplementation(
+                opName, implName, &details::buildOperation<TOperation>, std::move(cost));
+        }
+    };
+
+    /**
+     * Describes which implementation createOperation has chosen for a node and why
+     */
+    struct Selection {
+        std::string implementation;
+        std::string reason;
+    };
+
+    /**
+     * Declares the named operation as in-place capable: it may write its output into
+     * the buffer of an input of the same shape and element type
+     */
+    class InPlace {
+    public:
+        explicit InPlace(const std::string& opName) { getInstance().registerInPlaceOp(opName); }
+    };
+
     static OperationRegistry& getInstance();
 
     bool hasOperation(const std::shared_ptr<ov::Node>& node);
 
     std::optional<std::type_index> getOperationType(const std::shared_ptr<ov::Node>& node) const;
 
+    bool isInPlaceCapable(const ov::Node& node) const;
+
+    /**
+     * @param selection If not null, receives the chosen implementation for operations registered
+     * with several implementations and is left empty otherwise
+     */
     OperationBase::Ptr createOperation(const CreationContext& context,
                                        const std::shared_ptr<ov::Node>& node,
                                        IndexCollection&& inIds,
-                                       IndexCollection&& outIds);
+                                       IndexCollection&& outIds,
+                                       Selection* selection = nullptr);
 
     OperationBase::Ptr createOperation(const CreationContext& context,
                                        const std::shared_ptr<ov::Node>& node,
                                        gsl::span<const TensorID> inIds,
-                                       gsl::span<const TensorID> outIds);
+                                       gsl::span<const TensorID> outIds,
+                                       Selection* selection = nullptr);
 
 private:
+    struct ImplementationEntry {
+        std::string name;
+        OperationBuilder builder;
+        CostEstimator cost;
+    };
+
     void registerOp(const std::string& opName, OperationBuilder&& builder);
+    void registerImplementation(const std::string& opName,
+                                const std::string& implName,
+                                OperationBuilder&& builder,
+                                CostEstimator&& cost);
+    void registerInPlaceOp(const std::string& opName);
     template <typename TOperation>
     void registerOpType(const std::string& opName) {
         if (!registered_type_operations_.try_emplace(opName, std::type_index(typeid(TOperation))).second) {
@@ -104,7 +164,9 @@ private:
 
     std::unordered_map<std::type_index, std::unordered_set<std::string>> type_registered_operations_;
     std::unordered_map<std::string, OperationBuilder> registered_operations_;
+    std::unordered_map<std::string, std::vector<ImplementationEntry>> registered_implementations_;
     std::unordered_map<std::string, std::type_index> registered_type_operations_;
+    std::unordered_set<std::string> in_place_operations_;
 };
 
 template <>
@@ -139,3 +201,30 @@ public:
     [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Register<OperationBase> openvino_cuda_op_register_##name{ \
         #name, factory};                                                                                              \
     }
+
+/**
+ * @macro OPERATION_REGISTER_IMPLEMENTATION
+ * @brief Registers one of several implementations of an operator, see OperationRegistry::Implementation.
+ * Implementations of an operator are registered in one translation unit, the first one is the default
+ *
+ * @param type - a class derived from OperationBase and having one of the constructors listed for OPERATION_REGISTER
+ * @param cost - a function estimating execution time of the implementation for a node
+ * @param name - a textual operator's name
+ * @param impl - a textual implementation's name which is unique for the operator
+ */
+#define OPERATION_REGISTER_IMPLEMENTATION(type, cost, name, impl)                                               \
+    extern "C" {                                                                                                \
+    [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Implementation<type>                            \
+        openvino_cuda_op_implementation_##name##_##impl{#name, #impl, cost};                                    \
+    }
+
+/**
+ * @macro OPERATION_REGISTER_IN_PLACE
+ * @brief Marks registered operator as in-place capable, see OperationRegistry::InPlace
+ *
+ * @param name - a textual operator's name
+ */
+#define OPERATION_REGISTER_IN_PLACE(name)                                                                   \
+    extern "C" {                                                                                            \
+    [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::InPlace openvino_cuda_op_in_place_##name{#name}; \
+    }
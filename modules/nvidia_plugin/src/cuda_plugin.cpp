@@ -94,6 +94,14 @@ InferenceEngine::ITaskExecutor::Ptr Plugin::GetStreamExecutor(const Configuratio
     }
 }
 
+std::shared_ptr<DeviceMemoryArena> Plugin::GetMemoryArena(const Configuration& cfg) {
+    std::string deviceId = cfg.Get(CONFIG_KEY(DEVICE_ID));
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto& arena = device_memory_arena_[deviceId];
+    if (!arena) arena = std::make_shared<DeviceMemoryArena>();
+    return arena;
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(
     std::istream& model, const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "ov::nvidia_gpu::ImportNetworkImpl");
@@ -198,7 +206,7 @@ bool Plugin::isOperationSupported(const std::shared_ptr<ov::Node>& node) const {
     bool isOpSupported = false;
     if (OperationRegistry::getInstance().hasOperation(node)) {
         const TensorID dummyTensorID{0};
-        const CreationContext context{CUDA::Device{_cfg.deviceId}, false};
+        const CreationContext context{CUDA::Device{_cfg.deviceId}, false, _cfg.operation_implementations};
         const std::vector<TensorID> inIds(node->get_input_size(), dummyTensorID);
         const std::vector<TensorID> outIds(node->get_output_size(), dummyTensorID);
         try {
@@ -228,11 +236,14 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name,
                                                      METRIC_KEY(IMPORT_EXPORT_SUPPORT),
                                                      METRIC_KEY(DEVICE_ARCHITECTURE),
                                                      METRIC_KEY(OPTIMIZATION_CAPABILITIES),
-                                                     METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS)};
+                                                     METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+                                                     NVIDIA_METRIC_KEY(MEMORY_ARENA_ALLOCATED_SIZE),
+                                                     NVIDIA_METRIC_KEY(MEMORY_ARENA_HIGH_WATER_MARK)};
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, supportedMetrics);
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {
-            CONFIG_KEY(DEVICE_ID), CONFIG_KEY(PERF_COUNT), NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS)};
+            CONFIG_KEY(DEVICE_ID), CONFIG_KEY(PERF_COUNT), NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS),
+            NVIDIA_CONFIG_KEY(MEMORY_POLICY)};
         auto streamExecutorConfigKeys = InferenceEngine::IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
             if (configKey != InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
@@ -290,6 +301,19 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name,
         // TODO: fill with actual values
         using uint = unsigned int;
         IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(uint{1}, uint{1}, uint{1}));
+    } else if (NVIDIA_METRIC_KEY(MEMORY_ARENA_ALLOCATED_SIZE) == name ||
+               NVIDIA_METRIC_KEY(MEMORY_ARENA_HIGH_WATER_MARK) == name) {
+        // Arena exists only after a network with shared memory policy has been loaded on the device
+        std::uint64_t value = 0;
+        const auto deviceId = options.count(CONFIG_KEY(DEVICE_ID))
+                                  ? options.at(CONFIG_KEY(DEVICE_ID)).as<std::string>()
+                                  : std::to_string(_cfg.deviceId);
+        std::lock_guard<std::mutex> lock{mtx_};
+        if (auto arena = device_memory_arena_.find(deviceId); arena != device_memory_arena_.end()) {
+            value = NVIDIA_METRIC_KEY(MEMORY_ARENA_HIGH_WATER_MARK) == name ? arena->second->HighWaterMark()
+                                                                            : arena->second->AllocatedSize();
+        }
+        return InferenceEngine::Parameter{value};
     } else {
         IE_THROW(NotFound) << "Unsupported device metric: " << name;
     }
@@ -9,6 +9,7 @@
 #include "cuda_config.hpp"
 #include "cuda_executable_network.hpp"
 #include "cuda_thread_pool.hpp"
+#include "memory_manager/cuda_device_memory_arena.hpp"
 #include "transformer/cuda_graph_transformer.hpp"
 
 namespace ov {
@@ -47,6 +48,14 @@ private:
      */
     InferenceEngine::ITaskExecutor::Ptr GetStreamExecutor(const Configuration& cfg);
 
+    /**
+     * Gets DeviceMemoryArena if it was already created,
+     * creates otherwise one for device specified in cfg
+     * @param cfg Configuration which specifies device
+     * @return DeviceMemoryArena shared by all networks loaded on the device
+     */
+    std::shared_ptr<DeviceMemoryArena> GetMemoryArena(const Configuration& cfg);
+
     template <cuda_attribute ID, class Result>
     Result getCudaAttribute() const;
 
@@ -54,11 +63,12 @@ private:
 
     bool isOperationSupported(const std::shared_ptr<ov::Node>& node) const;
 
-    std::mutex mtx_;
+    mutable std::mutex mtx_;
     GraphTransformer transformer_{};
     Configuration _cfg;
     std::unordered_map<std::string, InferenceEngine::ITaskExecutor::Ptr> _waitExecutors;
     std::unordered_map<std::string, std::shared_ptr<CudaThreadPool>> device_thread_pool_;
+    std::unordered_map<std::string, std::shared_ptr<DeviceMemoryArena>> device_memory_arena_;
 };
 
 template <>
@@ -29,6 +29,21 @@ InferenceEngine::InferenceEngineProfileInfo makeProfileInfo(const std::string& l
     return result;
 }
 
+const char* stageName(const Profiler::Stages stage) {
+    switch (stage) {
+        case Profiler::Preprocess:
+            return "Preprocess";
+        case Profiler::Postprocess:
+            return "Postprocess";
+        case Profiler::StartPipeline:
+            return "StartPipeline";
+        case Profiler::WaitPipeline:
+            return "WaitPipeline";
+        default:
+            return "Unknown";
+    }
+}
+
 constexpr InferenceEngine::InferenceEngineProfileInfo makeProfileInfo(long long realTime_uSec,
                                                                       long long cpuTime_uSec = 0) noexcept {
     return InferenceEngine::InferenceEngineProfileInfo{
@@ -37,9 +52,12 @@ constexpr InferenceEngine::InferenceEngineProfileInfo makeProfileInfo(long long
 
 }  // namespace
 
-Profiler::Profiler(bool perfCount, const SubGraph& graph) : perf_count_{perfCount} {
+Profiler::Profiler(bool perfCount, const SubGraph& graph, Sampling sampling)
+    : perf_count_{perfCount}, sampling_{sampling} {
+    Expects(sampling_.interval > 0);
     std::vector<OperationBase::Ptr> execSequence;
     CollectSubGraphs(graph, execSequence);
+    num_steps_ = execSequence.size();
 
     if (perf_count_) {
         for (int i = 0; i < execSequence.size(); ++i) {
@@ -57,23 +75,72 @@ Profiler::Profiler(bool perfCount, const SubGraph& graph) : perf_count_{perfCoun
                     perf->second.exec_type[0] = 0;
             }
         }
+        for (auto& [subGraph, steps] : subgraph_perf_steps_map_) {
+            for (auto& step : steps) {
+                step.histogram_ = &(*histograms_)[step.GetOpName()];
+            }
+        }
     }
 }
 
+void Profiler::StopStage(const Stages stage) {
+    const auto end = Time::now();
+    durations_[stage] = end - start_;
+    if (trace_writer_) {
+        trace_writer_->WriteHostSpan(stageName(stage), "stage", start_, end, request_name_);
+    }
+}
+
+bool Profiler::IsTimed(const std::size_t stepIndex) const noexcept {
+    if (!timed_inference_) {
+        return false;
+    }
+    if (sampling_.opsPerInference == 0 || sampling_.opsPerInference >= num_steps_) {
+        return true;
+    }
+    return (stepIndex + num_steps_ - first_timed_step_) % num_steps_ < sampling_.opsPerInference;
+}
+
 void Profiler::ProcessEvents() {
     if (!perf_count_ || infer_count_ == 0) return;
+    const bool wasTimed = timed_inference_;
+    ++inference_index_;
+    timed_inference_ = inference_index_ % sampling_.interval == 0;
+    if (!wasTimed) return;
+    ++timed_inferences_;
+    if (sampling_.opsPerInference > 0 && num_steps_ > 0) {
+        first_timed_step_ = (first_timed_step_ + sampling_.opsPerInference) % num_steps_;
+    }
+
     constexpr float ms2us = 1000.0;
     std::map<std::string, float> layer_timing{};
     for (auto& timing_map : subgraph_perf_steps_map_) {
         auto& timings = timing_map.second;
         for (auto& timing : timings) {
-            timing.Measure();
+            std::optional<float> traceOffset;
+            if (trace_origin_ && timing.timed_) {
+                traceOffset = timing.timing_.startOffset(*trace_origin_);
+            }
+            if (const auto last = timing.MeasureLast()) {
+                timing.histogram_->record(last.value() * ms2us);
+                if (traceOffset && trace_writer_) {
+                    const auto start = trace_origin_host_ + std::chrono::duration_cast<Time::duration>(
+                                                                Duration{traceOffset.value() * ms2us});
+                    trace_writer_->WriteDeviceSpan(
+                        timing.GetOpName(), "op", start, Duration{last.value() * ms2us}, request_name_);
+                }
+            }
+            if (timing.Samples() == 0) {
+                continue;
+            }
             const auto perf = perf_counters_.find(timing.GetOpName());
             if (perf != perf_counters_.cend()) {
-                perf->second.realTime_uSec = timing.Duration() * ms2us / infer_count_;
+                // Average over the inferences in which the step was timed
+                const float average = timing.Duration() / timing.Samples();
+                perf->second.realTime_uSec = average * ms2us;
                 perf->second.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
                 if (perf->second.layer_type[0]) {
-                    layer_timing[perf->second.layer_type] += timing.Duration();
+                    layer_timing[perf->second.layer_type] += average;
                 }
             }
         }
@@ -81,7 +148,7 @@ void Profiler::ProcessEvents() {
     for (auto const& timing : layer_timing) {
         const auto summary = perf_counters_.find(timing.first);
         if (summary != perf_counters_.cend()) {
-            summary->second.realTime_uSec = timing.second * ms2us / infer_count_;
+            summary->second.realTime_uSec = timing.second * ms2us;
             summary->second.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
         }
     }
@@ -91,19 +158,24 @@ void Profiler::ProcessEvents() {
     // Adding some overall performance counters
     perf_counters_["1. input preprocessing"] = makeProfileInfo(0, durations_[Preprocess].count());
     perf_counters_["2. input transfer to a device"] = makeProfileInfo(
-        // Sum of all Parameters divided by count of infer requests
-        param_timing == layer_timing.cend() ? 0 : param_timing->second * ms2us / infer_count_);
+        // Sum of averages of all Parameters
+        param_timing == layer_timing.cend() ? 0 : param_timing->second * ms2us);
     perf_counters_["3. execution time"] =
-        makeProfileInfo(exec_timing_.measure() * ms2us / infer_count_, durations_[StartPipeline].count());
+        makeProfileInfo(exec_timing_.measure() * ms2us / timed_inferences_, durations_[StartPipeline].count());
     perf_counters_["4. output transfer from a device"] = makeProfileInfo(
-        // Sum of all Results divided by count of infer requests
-        result_timing == layer_timing.cend() ? 0 : result_timing->second * ms2us / infer_count_);
+        // Sum of averages of all Results
+        result_timing == layer_timing.cend() ? 0 : result_timing->second * ms2us);
     perf_counters_["5. output postprocessing"] = makeProfileInfo(0, durations_[Postprocess].count());
 }
 
 Profiler::ProfilerSequence Profiler::CreateExecSequence(const SubGraph* subGraphPtr) {
     Expects(active_stream_);
     ++infer_count_;
+    if (trace_writer_ && perf_count_ && timed_inference_ && !trace_origin_) {
+        // Device time of operations is mapped to host time from the moment this event is recorded
+        trace_origin_.emplace(CUDA::Event{}.record(*active_stream_));
+        trace_origin_host_ = Time::now();
+    }
     auto foundPerfStepsIter = std::find_if(subgraph_perf_steps_map_.begin(),
                                            subgraph_perf_steps_map_.end(),
                                            [subGraphPtr](const auto& ps) { return ps.first == subGraphPtr; });
@@ -135,9 +207,9 @@ void Profiler::CollectSubGraphs(const TensorIteratorOp& graph, std::vector<Opera
 void Profiler::CollectNodeVisitor(const OperationBase::Ptr& execStep,
                                   std::vector<ProfileExecStep>& perfSteps,
                                   std::vector<OperationBase::Ptr>& allExecSequence) {
-    allExecSequence.push_back(execStep);
     const auto& op = *execStep;
-    perfSteps.emplace_back(*this, op);
+    perfSteps.emplace_back(*this, op, allExecSequence.size());
+    allExecSequence.push_back(execStep);
     if (const auto tensorIteratorPtr = dynamic_cast<const TensorIteratorOp*>(&op)) {
         CollectSubGraphs(*tensorIteratorPtr, allExecSequence);
     }
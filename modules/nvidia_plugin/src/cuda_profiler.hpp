@@ -6,12 +6,16 @@
 
 #include <chrono>
 #include <map>
+#include <memory>
 #include <ops/tensor_iterator.hpp>
+#include <optional>
+#include <utils/latency_histogram.hpp>
 #include <utils/perf_timing.hpp>
 #include <vector>
 
 #include "cuda_graph.hpp"
 #include "cuda_operation_base.hpp"
+#include "cuda_trace_writer.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -26,15 +30,29 @@ public:
     using PerformaceCounters = std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>;
     using Duration = std::chrono::duration<float, std::micro>;
     using Time = std::chrono::steady_clock;
+    // Operation name to histogram of its execution times
+    using LatencyHistograms = std::map<std::string, utils::LatencyHistogram>;
 
     class ProfilerSequence;
     class ProfileExecStep;
 
+    /**
+     * Defines which inferences and operations are timed when performance counters are enabled
+     */
+    struct Sampling {
+        // Every interval-th inference is timed
+        std::size_t interval = 1;
+        // Number of operations timed in an inference, the next ones are timed in the next
+        // timed inference and so on. 0 - all operations are timed
+        std::size_t opsPerInference = 0;
+    };
+
     /**
      * Constructor of Profiler class
      * @param perfCount Option that indicates if performance counters are enabled
+     * @param sampling Inferences and operations to time
      */
-    explicit Profiler(bool perfCount, const SubGraph& graph);
+    explicit Profiler(bool perfCount, const SubGraph& graph, Sampling sampling = {});
 
     /**
      * Start time measurement of stage
@@ -50,7 +68,21 @@ public:
      * Stop time measurement of stage
      * @param stage Stage for which time measurement was performed
      */
-    void StopStage(Stages stage) { durations_[stage] = Time::now() - start_; }
+    void StopStage(Stages stage);
+
+    /**
+     * Sets the name of the infer request which identifies its spans in traces
+     */
+    void SetRequestName(std::string name) { request_name_ = std::move(name); }
+
+    /**
+     * Sets trace writer at the start of an inference, nullptr disables tracing.
+     * Spans of operations are written only for timed operations, see Sampling
+     */
+    void SetTraceWriter(std::shared_ptr<TraceWriter> writer) {
+        trace_writer_ = std::move(writer);
+        trace_origin_.reset();
+    }
 
     /**
      * Creates profiler sequence and increase infer request counter
@@ -65,11 +97,20 @@ public:
     [[nodiscard]] const PerformaceCounters& GetPerformanceCounts() const { return perf_counters_; }
 
     /**
-     * Processes performance events into performance counters
+     * Returns histograms of execution times of operations in timed inferences, which may be
+     * read while inferences are running
+     */
+    [[nodiscard]] std::shared_ptr<const LatencyHistograms> GetLatencyHistograms() const { return histograms_; }
+
+    /**
+     * Processes performance events of the last inference into performance counters
+     * and decides whether the next inference is timed
      */
     void ProcessEvents();
 
 private:
+    bool IsTimed(std::size_t stepIndex) const noexcept;
+
     void CollectSubGraphs(const SubGraph& graph, std::vector<OperationBase::Ptr>& vector);
     void CollectSubGraphs(const TensorIteratorOp& graph, std::vector<OperationBase::Ptr>& allExecSequence);
     void CollectNodeVisitor(const OperationBase::Ptr& execStep,
@@ -78,13 +119,27 @@ private:
 
     const CUDA::Stream* active_stream_ = nullptr;
     const bool perf_count_;
+    const Sampling sampling_;
     std::vector<std::pair<const void*, std::vector<ProfileExecStep>>> subgraph_perf_steps_map_;
+    std::size_t num_steps_ = 0;
     PerformaceCounters perf_counters_{};
+    std::shared_ptr<LatencyHistograms> histograms_ = std::make_shared<LatencyHistograms>();
     utils::PerformaceTiming exec_timing_{};
     // for performance counters
     std::array<Duration, NumOfStages> durations_;
     Time::time_point start_{};
     size_t infer_count_{};
+    // Whether the current inference is timed
+    bool timed_inference_ = true;
+    std::size_t inference_index_ = 0;
+    std::size_t timed_inferences_ = 0;
+    // Index of the first operation timed in the current inference
+    std::size_t first_timed_step_ = 0;
+    std::string request_name_;
+    std::shared_ptr<TraceWriter> trace_writer_;
+    // Event recorded before the first operation of a traced inference and its host time
+    std::optional<CUDA::Event> trace_origin_;
+    Time::time_point trace_origin_host_{};
 };
 
 class Profiler::ProfileExecStep {
@@ -93,8 +148,10 @@ public:
      * Constructor for profiler execution step
      * @param profiler Profiler class
      * @param execStep Executable step
+     * @param index Index of the step among steps of all subgraphs
      */
-    ProfileExecStep(Profiler& profiler, const OperationBase& execStep) : profiler_{profiler}, exec_step_{execStep} {}
+    ProfileExecStep(Profiler& profiler, const OperationBase& execStep, std::size_t index)
+        : profiler_{profiler}, exec_step_{execStep}, index_{index} {}
 
     /**
      * Execute method wrapper that wrap each element with time measurement
@@ -103,10 +160,11 @@ public:
      */
     template <typename... TArgs>
     void Execute(TArgs&&... args) const {
-        if (this->profiler_.perf_count_) {
+        if (this->profiler_.perf_count_ && this->profiler_.IsTimed(index_)) {
             timing_.setStart(*this->profiler_.active_stream_);
             exec_step_.Execute(std::forward<TArgs>(args)...);
             timing_.setStop(*this->profiler_.active_stream_);
+            timed_ = true;
         } else {
             exec_step_.Execute(std::forward<TArgs>(args)...);
         }
@@ -136,6 +194,25 @@ public:
      */
     float Measure() { return timing_.measure(); }
 
+    /**
+     * Measures time of this execution step in the last inference if it was timed
+     * @return Time in milliseconds or std::nullopt if the step was not timed
+     */
+    std::optional<float> MeasureLast() {
+        if (!timed_) {
+            return std::nullopt;
+        }
+        timed_ = false;
+        ++samples_;
+        const auto before = timing_.duration();
+        return timing_.measure() - before;
+    }
+
+    /**
+     * Get number of inferences in which this step was timed
+     */
+    [[nodiscard]] std::size_t Samples() const noexcept { return samples_; }
+
     /**
      * Get time for this execution step
      * @return Time for this step
@@ -151,7 +228,13 @@ public:
 private:
     Profiler& profiler_;
     const OperationBase& exec_step_;
+    std::size_t index_;
+    utils::LatencyHistogram* histogram_ = nullptr;
     mutable utils::PerformaceTiming timing_;
+    mutable bool timed_ = false;
+    std::size_t samples_ = 0;
+
+    friend class Profiler;
 };
 
 class Profiler::ProfilerSequence {
@@ -162,7 +245,7 @@ public:
      * @param stream CUDA stream
      */
     ProfilerSequence(Profiler& profiler, size_t index) : profiler_{profiler}, index_{index} {
-        if (profiler_.perf_count_) {
+        if (profiler_.perf_count_ && profiler_.timed_inference_) {
             profiler_.exec_timing_.setStart(*profiler_.active_stream_);
         }
     }
@@ -172,7 +255,7 @@ public:
      * Stops time measurement
      */
     ~ProfilerSequence() {
-        if (profiler_.perf_count_) {
+        if (profiler_.perf_count_ && profiler_.timed_inference_) {
             profiler_.exec_timing_.setStop(*profiler_.active_stream_);
         }
     }
@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_stream_schedule.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+bool overlaps(const StreamSchedule::Access& first, const StreamSchedule::Access& second) {
+    return first.offset < second.offset + second.size && second.offset < first.offset + first.size;
+}
+
+}  // namespace
+
+StreamSchedule::StreamSchedule(const std::vector<StepAccesses>& steps, const std::size_t maxLanes)
+    : steps_(steps.size()) {
+    assignLanes(findDependencies(steps), std::max<std::size_t>(maxLanes, 1));
+}
+
+std::vector<std::vector<std::size_t>> StreamSchedule::findDependencies(const std::vector<StepAccesses>& steps) {
+    struct Record {
+        std::size_t step;
+        Access access;
+        bool write;
+    };
+    std::unordered_map<Buffer, std::vector<Record>> history;
+    std::vector<std::vector<std::size_t>> dependencies(steps.size());
+    for (std::size_t step = 0; step < steps.size(); ++step) {
+        auto& stepDependencies = dependencies[step];
+        // Reads depend on writes of the same memory, writes depend on any earlier use of it
+        for (const auto& read : steps[step].reads) {
+            for (const auto& record : history[read.buffer]) {
+                if (record.write && overlaps(record.access, read)) {
+                    stepDependencies.push_back(record.step);
+                }
+            }
+        }
+        for (const auto& write : steps[step].writes) {
+            for (const auto& record : history[write.buffer]) {
+                if (overlaps(record.access, write)) {
+                    stepDependencies.push_back(record.step);
+                }
+            }
+        }
+        std::sort(stepDependencies.begin(), stepDependencies.end(), std::greater<>{});
+        stepDependencies.erase(std::unique(stepDependencies.begin(), stepDependencies.end()), stepDependencies.end());
+
+        const auto addUse = [&](const Access& access, const bool write) {
+            history[access.buffer].push_back({step, access, write});
+            auto& users = users_[access.buffer];
+            if (users.empty() || users.back() != step) {
+                users.push_back(step);
+            }
+        };
+        for (const auto& read : steps[step].reads) {
+            addUse(read, false);
+        }
+        for (const auto& write : steps[step].writes) {
+            addUse(write, true);
+        }
+    }
+    return dependencies;
+}
+
+void StreamSchedule::join(Clock& clock, const Clock& other) {
+    if (clock.size() < other.size()) {
+        clock.resize(other.size());
+    }
+    std::transform(other.begin(), other.end(), clock.begin(), clock.begin(), [](auto l, auto r) {
+        return std::max(l, r);
+    });
+}
+
+void StreamSchedule::join(Clock& clock, const std::size_t step) const {
+    join(clock, clocks_[step]);
+    const auto lane = steps_[step].lane;
+    if (clock.size() <= lane) {
+        clock.resize(lane + 1);
+    }
+    clock[lane] = std::max(clock[lane], step + 1);
+}
+
+void StreamSchedule::assignLanes(const std::vector<std::vector<std::size_t>>& dependencies,
+                                 const std::size_t maxLanes) {
+    clocks_.assign(steps_.size(), Clock{});
+    // Last step of every lane
+    std::vector<std::optional<std::size_t>> tails(1);
+    for (std::size_t step = 0; step < steps_.size(); ++step) {
+        // Predecessors go in descending order, so the latest one is preferred
+        const auto& predecessors = dependencies[step];
+        std::optional<std::size_t> lane;
+        for (const auto predecessor : predecessors) {
+            if (tails[steps_[predecessor].lane] == predecessor) {
+                lane = steps_[predecessor].lane;
+                break;
+            }
+        }
+        if (!lane && predecessors.empty()) {
+            lane = 0;
+        } else if (!lane && tails.size() < maxLanes) {
+            lane = tails.size();
+            tails.emplace_back();
+        } else if (!lane) {
+            // Prefer a lane which is already ordered before the step, otherwise the one
+            // which is likely to complete first
+            Clock required;
+            for (const auto predecessor : predecessors) {
+                join(required, predecessor);
+            }
+            for (std::size_t candidate = 0; candidate < tails.size(); ++candidate) {
+                const auto& tail = tails[candidate];
+                if (!tail || ordered(required, *tail)) {
+                    lane = candidate;
+                    break;
+                }
+                if (!lane || *tail < *tails[*lane]) {
+                    lane = candidate;
+                }
+            }
+        }
+
+        auto& clock = clocks_[step];
+        if (const auto tail = tails[*lane]) {
+            join(clock, *tail);
+        }
+        for (const auto predecessor : predecessors) {
+            if (ordered(clock, predecessor)) {
+                continue;
+            }
+            steps_[step].waits.push_back(predecessor);
+            join(clock, predecessor);
+            if (steps_[predecessor].signal == Step::kNoSignal) {
+                steps_[predecessor].signal = num_signals_++;
+            }
+        }
+        steps_[step].lane = *lane;
+        tails[*lane] = step;
+    }
+    num_lanes_ = tails.size();
+    lane_steps_.assign(num_lanes_, {});
+    for (std::size_t step = 0; step < steps_.size(); ++step) {
+        lane_steps_[steps_[step].lane].push_back(step);
+    }
+}
+
+bool StreamSchedule::HappensBefore(const std::size_t first, const std::size_t second) const {
+    return first < second && ordered(clocks_.at(second), first);
+}
+
+std::optional<std::size_t> StreamSchedule::LifespanStart(const Buffer buffer) const {
+    const auto users = users_.find(buffer);
+    if (users == users_.end()) {
+        return std::nullopt;
+    }
+    return users->second.front();
+}
+
+std::optional<std::size_t> StreamSchedule::LifespanEnd(const Buffer buffer) const {
+    const auto users = users_.find(buffer);
+    if (users == users_.end()) {
+        return std::nullopt;
+    }
+    // Clock a step should reach to start after all users complete
+    Clock required(num_lanes_);
+    for (const auto user : users->second) {
+        auto& latest = required[steps_[user].lane];
+        latest = std::max(latest, user + 1);
+    }
+    const auto completed = [&](const std::size_t step) {
+        for (std::size_t lane = 0; lane < required.size(); ++lane) {
+            if (at(clocks_[step], lane) < required[lane]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Clocks only grow along a lane, so steps of a lane which start after all users are its suffix.
+    // A user is never its own ancestor, so the last user of a lane is before the suffix at the latest
+    std::size_t end = 0;
+    for (const auto& laneSteps : lane_steps_) {
+        const auto firstCompleted =
+            std::partition_point(laneSteps.begin(), laneSteps.end(), [&](auto step) { return !completed(step); });
+        if (firstCompleted != laneSteps.begin()) {
+            end = std::max(end, *std::prev(firstCompleted));
+        }
+    }
+    return end;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
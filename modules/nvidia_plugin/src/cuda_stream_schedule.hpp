@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief StreamSchedule distributes steps of an execution sequence over several
+ * CUDA streams (lanes), so independent branches of a graph run concurrently.
+ *
+ * Dependencies between steps are derived from the memory regions they read and
+ * write. Every step goes to the lane of one of its predecessors if it can continue
+ * that lane, otherwise a new lane is opened until the limit is reached. Steps of
+ * different lanes are synchronized with events: a step waits only for the
+ * predecessors which aren't already ordered before it by its lane and earlier waits.
+ *
+ * Lanes break the assumption of serial execution, under which buffers which aren't
+ * used at the same step may share memory. LifespanEnd() gives buffer lifespans for
+ * which disjoint lifespans still mean that buffers are never used concurrently.
+ *
+ * Steps of a lane are ordered by the lane itself, so ordering between steps is kept as
+ * a vector clock of every step: the latest step of each lane which completes before it.
+ * This takes O(steps * lanes) memory instead of reachability between all pairs of steps.
+ */
+class StreamSchedule {
+public:
+    using Buffer = unsigned;
+
+    /**
+     * Region of a buffer which a step reads or writes
+     */
+    struct Access {
+        Buffer buffer;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    struct StepAccesses {
+        std::vector<Access> reads;
+        std::vector<Access> writes;
+    };
+
+    struct Step {
+        static constexpr std::size_t kNoSignal = SIZE_MAX;
+
+        std::size_t lane = 0;
+        // Steps of other lanes which should complete before the step starts
+        std::vector<std::size_t> waits;
+        // Index of the event which is recorded after the step, kNoSignal if no step waits for it
+        std::size_t signal = kNoSignal;
+    };
+
+    /**
+     * @param steps Memory accesses of every step in the order of serial execution
+     * @param maxLanes Maximal number of lanes, 1 means serial execution
+     */
+    StreamSchedule(const std::vector<StepAccesses>& steps, std::size_t maxLanes);
+
+    const std::vector<Step>& Steps() const noexcept { return steps_; }
+    std::size_t NumLanes() const noexcept { return num_lanes_; }
+    std::size_t NumSignals() const noexcept { return num_signals_; }
+
+    /**
+     * @returns true if the first step always completes before the second one starts
+     */
+    bool HappensBefore(std::size_t first, std::size_t second) const;
+
+    /**
+     * @returns Index of the first step which uses the buffer or std::nullopt if no step uses it
+     */
+    std::optional<std::size_t> LifespanStart(Buffer buffer) const;
+
+    /**
+     * @returns Index of the last step which may run concurrently with any step using the buffer
+     * or std::nullopt if no step uses it. Every following step starts after all users of the
+     * buffer complete, so it's safe for buffers used from there on to reuse the memory
+     */
+    std::optional<std::size_t> LifespanEnd(Buffer buffer) const;
+
+private:
+    // Per lane, 1 + index of the latest step of the lane which completes before a step, 0 if there is none.
+    // Lanes opened after the step are missing
+    using Clock = std::vector<std::size_t>;
+
+    static std::size_t at(const Clock& clock, std::size_t lane) { return lane < clock.size() ? clock[lane] : 0; }
+    static void join(Clock& clock, const Clock& other);
+    // Adds the step and the steps which complete before it to the clock
+    void join(Clock& clock, std::size_t step) const;
+    bool ordered(const Clock& clock, std::size_t step) const { return at(clock, steps_[step].lane) > step; }
+
+    std::vector<std::vector<std::size_t>> findDependencies(const std::vector<StepAccesses>& steps);
+    void assignLanes(const std::vector<std::vector<std::size_t>>& dependencies, std::size_t maxLanes);
+
+    std::vector<Step> steps_;
+    std::size_t num_lanes_ = 1;
+    std::size_t num_signals_ = 0;
+    // Steps which complete before every step, including ones ordered by lanes
+    std::vector<Clock> clocks_;
+    // Steps of every lane in ascending order
+    std::vector<std::vector<std::size_t>> lane_steps_;
+    // Steps which use every buffer, in ascending order
+    std::unordered_map<Buffer, std::vector<std::size_t>> users_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
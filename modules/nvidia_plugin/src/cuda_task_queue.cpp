@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_task_queue.hpp"
+
+#include <cstdint>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace
+
+CudaTaskQueue::CudaTaskQueue(const std::size_t capacity)
+    : mask_{roundUpToPowerOfTwo(capacity) - 1}, cells_{std::make_unique<Cell[]>(mask_ + 1)} {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool CudaTaskQueue::TryPush(CudaUniqueTask& task) noexcept {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+        auto& cell = cells_[pos & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.task = std::move(task);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The cell is still occupied by a task of the previous lap
+            return false;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool CudaTaskQueue::TryPop(CudaUniqueTask& task) noexcept {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+        auto& cell = cells_[pos & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                task = std::move(cell.task);
+                cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The cell has not been written in this lap yet
+            return false;
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
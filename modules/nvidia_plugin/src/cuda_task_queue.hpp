@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "cuda_unique_task.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief CudaTaskQueue is a bounded lock-free FIFO queue of tasks for any number of
+ * producers and consumers (D. Vyukov's array based MPMC queue).
+ *
+ * Every cell has a sequence number which tells whether the cell is ready to be
+ * written or read in the current lap, so producers and consumers only compete
+ * for the enqueue and dequeue positions with compare-and-swap.
+ */
+class CudaTaskQueue final {
+public:
+    /**
+     * @param capacity Maximal number of queued tasks, rounded up to a power of two
+     */
+    explicit CudaTaskQueue(std::size_t capacity);
+
+    CudaTaskQueue(const CudaTaskQueue&) = delete;
+    CudaTaskQueue& operator=(const CudaTaskQueue&) = delete;
+
+    /**
+     * @return false if the queue is full, @task is left untouched in this case
+     */
+    bool TryPush(CudaUniqueTask& task) noexcept;
+
+    /**
+     * @return false if the queue is empty
+     */
+    bool TryPop(CudaUniqueTask& task) noexcept;
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        CudaUniqueTask task;
+    };
+
+    // Positions are modified by different threads, so they are kept in different cache lines
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(kCacheLineSize) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> dequeue_pos_{0};
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
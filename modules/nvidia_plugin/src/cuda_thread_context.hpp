@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
+#include "cuda/event.hpp"
 #include "cuda/tensor.hpp"
 
 namespace ov {
@@ -17,6 +22,9 @@ class ThreadContext {
     CUDA::DnnHandle dnnHandle_;
     CUDA::CuBlasHandle cuBlasHandle_;
     CUDA::CuTensorHandle cuTensorHandle_;
+    // Created on demand by graphs which run independent operations concurrently
+    mutable std::vector<std::unique_ptr<ThreadContext>> lanes_;
+    mutable std::deque<CUDA::Event> events_;
 
 public:
     explicit ThreadContext(CUDA::Device d) : device_{d.setCurrent()} {
@@ -28,6 +36,29 @@ public:
     const CUDA::DnnHandle& dnnHandle() const noexcept { return dnnHandle_; }
     const CUDA::CuBlasHandle& cuBlasHandle() const noexcept { return cuBlasHandle_; }
     const CUDA::CuTensorHandle& cuTensorHandle() const noexcept { return cuTensorHandle_; }
+
+    /**
+     * @returns Context of an additional stream of the thread, lane 0 is this context itself
+     */
+    const ThreadContext& lane(std::size_t index) const {
+        if (index == 0) {
+            return *this;
+        }
+        while (lanes_.size() < index) {
+            lanes_.push_back(std::make_unique<ThreadContext>(device_));
+        }
+        return *lanes_[index - 1];
+    }
+
+    /**
+     * @returns Event which synchronizes streams of the thread
+     */
+    CUDA::Event& event(std::size_t index) const {
+        while (events_.size() <= index) {
+            events_.emplace_back();
+        }
+        return events_[index];
+    }
 };
 
 }  // namespace nvidia_gpu
@@ -14,32 +14,24 @@ namespace ov {
 namespace nvidia_gpu {
 
 static thread_local ThreadContext* contextPtr = nullptr;
+// Pool which owns the current thread and index of the thread in it
+static thread_local const CudaThreadPool* currentPool = nullptr;
+static thread_local std::size_t currentThreadIndex = 0;
 
 CudaThreadPool::CudaThreadPool(CUDA::Device d, unsigned _numThreads) {
+    for (unsigned i = 0; i < _numThreads; ++i) {
+        queues_.push_back(std::make_unique<CudaTaskQueue>(kQueueCapacity));
+    }
     try {
         CudaLatch latch{_numThreads};
-        for (int i = 0; i < _numThreads; ++i) {
-            threads_.emplace_back([this, d, &latch] {
+        for (unsigned i = 0; i < _numThreads; ++i) {
+            threads_.emplace_back([this, d, i, &latch] {
                 ThreadContext context{d};
                 contextPtr = &context;
+                currentPool = this;
+                currentThreadIndex = i;
                 latch.count_down();
-                while (true) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(mtx_);
-                        queue_cond_var_.wait(lock, [&] { return !task_queue_.empty() || is_stopped_; });
-                        if (is_stopped_) {
-                            break;
-                        }
-                        if (!task_queue_.empty()) {
-                            task = std::move(task_queue_.front());
-                            task_queue_.pop_front();
-                        }
-                    }
-                    if (task) {
-                        task();
-                    }
-                }
+                threadLoop(i);
             });
         }
         latch.wait();
@@ -60,6 +52,55 @@ void CudaThreadPool::stopThreadPool() noexcept {
     threads_.clear();
 }
 
+void CudaThreadPool::threadLoop(const std::size_t index) {
+    CudaUniqueTask task;
+    unsigned attempts = 0;
+    while (!is_stopped_) {
+        if (tryTake(index, task)) {
+            task();
+            task.reset();
+            attempts = 0;
+            continue;
+        }
+        // Tasks of infer requests usually come in bursts, so the thread yields a few times before sleeping
+        if (++attempts < kSpinAttempts) {
+            std::this_thread::yield();
+            continue;
+        }
+        attempts = 0;
+        std::unique_lock<std::mutex> lock(mtx_);
+        // Together with the check of sleeping threads in run() it guarantees that either
+        // this thread sees a new task or run() sees this thread sleeping and wakes it up
+        ++sleeping_threads_;
+        queue_cond_var_.wait(lock, [&] { return pending_ > 0 || is_stopped_; });
+        --sleeping_threads_;
+    }
+}
+
+bool CudaThreadPool::tryTake(const std::size_t index, CudaUniqueTask& task) {
+    if (queues_[index]->TryPop(task)) {
+        --pending_;
+        return true;
+    }
+    if (overflow_size_.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!overflow_queue_.empty()) {
+            task = std::move(overflow_queue_.front());
+            overflow_queue_.pop_front();
+            --overflow_size_;
+            --pending_;
+            return true;
+        }
+    }
+    for (std::size_t i = 1; i < queues_.size(); ++i) {
+        if (queues_[(index + i) % queues_.size()]->TryPop(task)) {
+            --pending_;
+            return true;
+        }
+    }
+    return false;
+}
+
 const ThreadContext& CudaThreadPool::GetThreadContext() {
     if (!contextPtr) {
         throwIEException(
@@ -70,11 +111,20 @@ const ThreadContext& CudaThreadPool::GetThreadContext() {
 }
 
 void CudaThreadPool::run(Task task) {
-    {
+    CudaUniqueTask uniqueTask{std::move(task)};
+    const auto index = currentPool == this ? currentThreadIndex
+                                           : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    if (!queues_[index]->TryPush(uniqueTask)) {
         std::lock_guard<std::mutex> lock(mtx_);
-        task_queue_.push_back(task);
+        overflow_queue_.push_back(std::move(uniqueTask));
+        ++overflow_size_;
+    }
+    ++pending_;
+    if (sleeping_threads_ > 0) {
+        // Taking the mutex ensures the sleeping thread is either waiting already or will see the task
+        { std::lock_guard<std::mutex> lock(mtx_); }
+        queue_cond_var_.notify_one();
     }
-    queue_cond_var_.notify_one();
 }
 
 }  // namespace nvidia_gpu
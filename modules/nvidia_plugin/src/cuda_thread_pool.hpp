@@ -8,16 +8,27 @@
 #include <condition_variable>
 #include <cuda_thread_context.hpp>
 #include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <threading/ie_itask_executor.hpp>
+#include <vector>
 
 #include "cuda_jthread.hpp"
+#include "cuda_task_queue.hpp"
+#include "cuda_unique_task.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
+/**
+ * Every thread of the pool has a lock-free queue of its own. Tasks are distributed
+ * over the queues round-robin, or put into the queue of the calling thread if it
+ * belongs to the pool. A thread takes tasks from its own queue first and steals
+ * from queues of other threads when its own queue is empty. The mutex is taken
+ * only when a thread goes to sleep, when a sleeping thread has to be woken up,
+ * or when a queue overflows.
+ */
 class CudaThreadPool : public InferenceEngine::ITaskExecutor {
 public:
     using Task = std::function<void()>;
@@ -28,12 +39,25 @@ public:
     void run(Task task) override;
 
 private:
+    // Capacity of a queue of a single thread, further tasks go to the overflow queue
+    static constexpr std::size_t kQueueCapacity = 1024;
+    // Number of failed attempts to take a task after which a thread goes to sleep
+    static constexpr unsigned kSpinAttempts = 16;
+
     void stopThreadPool() noexcept;
+    void threadLoop(std::size_t index);
+    bool tryTake(std::size_t index, CudaUniqueTask& task);
 
+    std::vector<std::unique_ptr<CudaTaskQueue>> queues_;
+    std::atomic<std::size_t> next_queue_{0};
+    // Number of tasks in queues, which are not taken by threads yet
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::size_t> sleeping_threads_{0};
+    std::atomic<std::size_t> overflow_size_{0};
+    std::atomic<bool> is_stopped_{false};
     std::mutex mtx_;
-    bool is_stopped_ = false;
     std::condition_variable queue_cond_var_;
-    std::deque<Task> task_queue_;
+    std::deque<CudaUniqueTask> overflow_queue_;
     std::vector<CudaJThread> threads_;
 };
 
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_trace_writer.hpp"
+
+#include <fmt/format.h>
+
+#include <error.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr unsigned kProcessId = 1;
+
+std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        switch (c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+TraceWriter::TraceWriter(const std::string& path) : path_{path}, origin_{Time::now()}, file_{path, std::ios::trunc} {
+    if (!file_) {
+        throwIEException(fmt::format("Can't open trace file {}", path));
+    }
+    file_ << '[';
+}
+
+TraceWriter::~TraceWriter() { file_ << "\n]\n"; }
+
+void TraceWriter::WriteHostSpan(std::string_view name,
+                                std::string_view category,
+                                Time::time_point start,
+                                Time::time_point end,
+                                std::string_view request) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    const auto threadId = std::this_thread::get_id();
+    auto lane = thread_lanes_.find(threadId);
+    if (lane == thread_lanes_.end()) {
+        lane = thread_lanes_.emplace(threadId, Lane(fmt::format("Host thread {}", thread_lanes_.size()))).first;
+    }
+    WriteSpan(name, category, start, end - start, lane->second, request);
+}
+
+void TraceWriter::WriteDeviceSpan(std::string_view name,
+                                  std::string_view category,
+                                  Time::time_point start,
+                                  Duration duration,
+                                  std::string_view request) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    WriteSpan(name, category, start, duration, Lane(fmt::format("{} device", request)), request);
+}
+
+unsigned TraceWriter::Lane(const std::string& laneName) {
+    const auto [lane, inserted] = lanes_.emplace(laneName, static_cast<unsigned>(lanes_.size()));
+    if (inserted) {
+        WriteEvent(fmt::format(R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"{}"}}}})",
+                               kProcessId,
+                               lane->second,
+                               escapeJson(laneName)));
+    }
+    return lane->second;
+}
+
+void TraceWriter::WriteSpan(std::string_view name,
+                            std::string_view category,
+                            Time::time_point start,
+                            Duration duration,
+                            unsigned lane,
+                            std::string_view request) {
+    WriteEvent(fmt::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},)"
+                           R"("pid":{},"tid":{},"args":{{"request":"{}"}}}})",
+                           escapeJson(name),
+                           escapeJson(category),
+                           Duration{start - origin_}.count(),
+                           duration.count(),
+                           kProcessId,
+                           lane,
+                           escapeJson(request)));
+}
+
+void TraceWriter::WriteEvent(const std::string& event) {
+    file_ << (has_events_ ? ",\n" : "\n") << event;
+    has_events_ = true;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief TraceWriter writes spans of infer request stages and operations into a file
+ * in Chrome trace event format, which chrome://tracing and Perfetto UI open.
+ *
+ * Host spans are placed on a lane of the thread which calls the writer, so stages
+ * executed by CPU executor and CudaThreadPool threads show up side by side.
+ * Device spans are placed on a lane of the infer request they belong to.
+ * The writer is thread safe.
+ */
+class TraceWriter {
+public:
+    using Time = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::micro>;
+
+    /**
+     * @param path Trace file path, the file is overwritten
+     */
+    explicit TraceWriter(const std::string& path);
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    const std::string& Path() const { return path_; }
+
+    /**
+     * Writes a span executed by the calling thread
+     */
+    void WriteHostSpan(std::string_view name,
+                       std::string_view category,
+                       Time::time_point start,
+                       Time::time_point end,
+                       std::string_view request);
+
+    /**
+     * Writes a span executed on device for the given infer request
+     */
+    void WriteDeviceSpan(std::string_view name,
+                         std::string_view category,
+                         Time::time_point start,
+                         Duration duration,
+                         std::string_view request);
+
+private:
+    unsigned Lane(const std::string& laneName);
+    void WriteSpan(std::string_view name,
+                   std::string_view category,
+                   Time::time_point start,
+                   Duration duration,
+                   unsigned lane,
+                   std::string_view request);
+    void WriteEvent(const std::string& event);
+
+    const std::string path_;
+    const Time::time_point origin_;
+    std::mutex mtx_;
+    std::ofstream file_;
+    bool has_events_ = false;
+    std::map<std::thread::id, unsigned> thread_lanes_;
+    std::map<std::string, unsigned> lanes_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
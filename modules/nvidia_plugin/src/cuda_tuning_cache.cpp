@@ -0,0 +1,195 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_tuning_cache.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/op/constant.hpp>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+// Serializes read-modify-write of cache files by networks loaded at the same time
+std::mutex& cacheMutex() {
+    static std::mutex mtx;
+    return mtx;
+}
+
+std::map<std::string, unsigned> readEntries(const std::string& path) {
+    std::map<std::string, unsigned> entries;
+    std::ifstream file{path};
+    std::string key;
+    unsigned value = 0;
+    while (file >> key >> value) {
+        entries[key] = value;
+    }
+    return entries;
+}
+
+/**
+ * 64-bit FNV-1a digest, unlike std::hash it is the same in every build and process
+ */
+class Fnv1a {
+public:
+    void Update(const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash_ = (hash_ ^ bytes[i]) * kPrime;
+        }
+    }
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    void Update(T value) {
+        Update(&value, sizeof(value));
+    }
+    void Update(const std::string& value) {
+        Update(static_cast<std::uint64_t>(value.size()));
+        Update(value.data(), value.size());
+    }
+    template <typename T>
+    void Update(const std::vector<T>& values) {
+        Update(static_cast<std::uint64_t>(values.size()));
+        for (const auto& value : values) {
+            Update(value);
+        }
+    }
+    std::uint64_t Digest() const { return hash_; }
+
+private:
+    static constexpr std::uint64_t kPrime = 0x100000001b3ull;
+    std::uint64_t hash_ = 0xcbf29ce484222325ull;
+};
+
+/**
+ * Adds names and values of node attributes to the digest, attributes of other types are added by name only
+ */
+class DigestVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit DigestVisitor(Fnv1a& digest) : digest_{digest} {}
+
+    using ngraph::AttributeVisitor::on_adapter;
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>&) override { digest_.Update(name); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { add(name, adapter.get()); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        add(name, adapter.get());
+    }
+
+private:
+    template <typename T>
+    void add(const std::string& name, const T& value) {
+        digest_.Update(name);
+        digest_.Update(value);
+    }
+
+    Fnv1a& digest_;
+};
+
+}  // namespace
+
+TuningCache::TuningCache(std::string path) : path_{std::move(path)} {}
+
+std::optional<unsigned> TuningCache::Get(const std::string& key) const {
+    if (!Enabled()) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock{cacheMutex()};
+    const auto entries = readEntries(path_);
+    if (auto entry = entries.find(key); entry != entries.end()) {
+        return entry->second;
+    }
+    return std::nullopt;
+}
+
+void TuningCache::Set(const std::string& key, const unsigned value) const {
+    if (!Enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{cacheMutex()};
+    auto entries = readEntries(path_);
+    entries[key] = value;
+    // Cache is replaced at once, so other processes never read a partially written file
+    const auto tmpPath = path_ + ".tmp";
+    {
+        std::ofstream file{tmpPath, std::ios::trunc};
+        for (const auto& [entryKey, entryValue] : entries) {
+            file << entryKey << ' ' << entryValue << '\n';
+        }
+        if (!file) {
+            return;
+        }
+    }
+    std::rename(tmpPath.c_str(), path_.c_str());
+}
+
+std::uint64_t TuningCache::NetworkDigest(const ngraph::Function& function) {
+    Fnv1a digest;
+    DigestVisitor visitor{digest};
+    std::unordered_map<const ngraph::Node*, std::uint64_t> indices;
+    for (const auto& node : function.get_ordered_ops()) {
+        indices.emplace(node.get(), indices.size());
+        digest.Update(std::string{node->get_type_info().name});
+        digest.Update(node->get_type_info().get_version());
+        for (const auto& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            digest.Update(indices.at(source.get_node()));
+            digest.Update(static_cast<std::uint64_t>(source.get_index()));
+        }
+        for (const auto& output : node->outputs()) {
+            digest.Update(output.get_element_type().get_type_name());
+            digest.Update(output.get_partial_shape().to_string());
+        }
+        node->visit_attributes(visitor);
+        if (const auto constant = std::dynamic_pointer_cast<ngraph::op::v0::Constant>(node)) {
+            digest.Update(constant->get_data_ptr(), constant->get_byte_size());
+        }
+    }
+    return digest.Digest();
+}
+
+std::string TuningCache::MakeKey(const ngraph::Function& function, const CUDA::Device& device) {
+    const auto modelHash = NetworkDigest(function);
+    const auto props = device.props();
+    std::string deviceName{props.name};
+    std::replace_if(
+        deviceName.begin(), deviceName.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }, '_');
+    return fmt::format("{:016x}_{}_sm{}{}_{}sm_{}mb",
+                       modelHash,
+                       deviceName,
+                       props.major,
+                       props.minor,
+                       props.multiProcessorCount,
+                       props.totalGlobalMem >> 20);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
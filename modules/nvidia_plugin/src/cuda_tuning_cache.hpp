@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cuda/runtime.hpp>
+#include <ngraph/function.hpp>
+#include <optional>
+#include <string>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief TuningCache persists tuned values, e.g. optimal number of infer requests,
+ * between network loads in a text file of "<key> <value>" lines.
+ *
+ * Cache is an optimization only, so I/O errors are not reported: a value which
+ * can not be read is tuned again, and a value which can not be written is lost.
+ */
+class TuningCache {
+public:
+    /**
+     * @param path Cache file path, empty path disables the cache
+     */
+    explicit TuningCache(std::string path);
+
+    bool Enabled() const { return !path_.empty(); }
+
+    std::optional<unsigned> Get(const std::string& key) const;
+    void Set(const std::string& key, unsigned value) const;
+
+    /**
+     * Creates a key which identifies the network and the device it is tuned for
+     * @param function Network which is exported by ExecutableNetwork
+     * @param device Device the network is loaded on
+     */
+    static std::string MakeKey(const ngraph::Function& function, const CUDA::Device& device);
+
+    /**
+     * Creates a stable digest of the network topology, node types and attributes, types and shapes of outputs
+     * and data of constants. Names of nodes are not included, so renamed networks share tuned values.
+     */
+    static std::uint64_t NetworkDigest(const ngraph::Function& function);
+
+private:
+    std::string path_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
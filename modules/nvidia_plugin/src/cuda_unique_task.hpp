@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief CudaUniqueTask is a move-only void() callable. Callables which fit into
+ * kBufferSize bytes and are nothrow movable, e.g. std::function or small lambdas,
+ * are stored inline, so creating and moving a task does not allocate memory.
+ */
+class CudaUniqueTask final {
+public:
+    static constexpr std::size_t kBufferSize = 48;
+
+    CudaUniqueTask() noexcept = default;
+
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, CudaUniqueTask> &&
+                                          std::is_invocable_r_v<void, std::decay_t<F>&>>>
+    CudaUniqueTask(F&& f) {  // NOLINT(google-explicit-constructor)
+        using Callable = std::decay_t<F>;
+        if constexpr (isInline<Callable>()) {
+            new (&buffer_) Callable(std::forward<F>(f));
+            ops_ = &kInlineOps<Callable>;
+        } else {
+            new (&buffer_) Callable*(new Callable(std::forward<F>(f)));
+            ops_ = &kHeapOps<Callable>;
+        }
+    }
+
+    CudaUniqueTask(CudaUniqueTask&& other) noexcept { moveFrom(other); }
+
+    CudaUniqueTask& operator=(CudaUniqueTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    CudaUniqueTask(const CudaUniqueTask&) = delete;
+    CudaUniqueTask& operator=(const CudaUniqueTask&) = delete;
+
+    ~CudaUniqueTask() { reset(); }
+
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    void operator()() { ops_->invoke(&buffer_); }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(&buffer_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    using Buffer = std::aligned_storage_t<kBufferSize, alignof(std::max_align_t)>;
+
+    struct Ops {
+        void (*invoke)(void* buffer);
+        // Move-constructs callable in dst from src and destroys src
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* buffer) noexcept;
+    };
+
+    template <typename Callable>
+    static constexpr bool isInline() {
+        return sizeof(Callable) <= kBufferSize && alignof(Callable) <= alignof(Buffer) &&
+               std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+    template <typename Callable>
+    static constexpr Ops kInlineOps{
+        [](void* buffer) { (*static_cast<Callable*>(buffer))(); },
+        [](void* dst, void* src) noexcept {
+            new (dst) Callable(std::move(*static_cast<Callable*>(src)));
+            static_cast<Callable*>(src)->~Callable();
+        },
+        [](void* buffer) noexcept { static_cast<Callable*>(buffer)->~Callable(); }};
+
+    template <typename Callable>
+    static constexpr Ops kHeapOps{
+        [](void* buffer) { (**static_cast<Callable**>(buffer))(); },
+        [](void* dst, void* src) noexcept { new (dst) Callable*(*static_cast<Callable**>(src)); },
+        [](void* buffer) noexcept { delete *static_cast<Callable**>(buffer); }};
+
+    void moveFrom(CudaUniqueTask& other) noexcept {
+        if (other.ops_) {
+            other.ops_->relocate(&buffer_, &other.buffer_);
+            ops_ = std::exchange(other.ops_, nullptr);
+        }
+    }
+
+    Buffer buffer_;
+    const Ops* ops_ = nullptr;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
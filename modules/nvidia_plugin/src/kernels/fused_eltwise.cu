@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+#include <tuple>
+
+#include "error.hpp"
+#include "fused_eltwise.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+__device__ inline float evaluate(const FusedEltwise::Opcode opcode, const float a, const float b) {
+    switch (opcode) {
+        case FusedEltwise::Opcode::Add:
+            return a + b;
+        case FusedEltwise::Opcode::Subtract:
+            return a - b;
+        case FusedEltwise::Opcode::Multiply:
+            return a * b;
+        case FusedEltwise::Opcode::Divide:
+            return a / b;
+        case FusedEltwise::Opcode::Maximum:
+            return ::fmaxf(a, b);
+        case FusedEltwise::Opcode::Minimum:
+            return ::fminf(a, b);
+        case FusedEltwise::Opcode::SquaredDifference:
+            return (a - b) * (a - b);
+        case FusedEltwise::Opcode::Power:
+            return ::powf(a, b);
+        case FusedEltwise::Opcode::Sigmoid:
+            return 1.0f / (1.0f + ::expf(-a));
+        case FusedEltwise::Opcode::Relu:
+            return ::fmaxf(a, 0.0f);
+        case FusedEltwise::Opcode::Tanh:
+            return ::tanhf(a);
+        case FusedEltwise::Opcode::Exp:
+            return ::expf(a);
+        case FusedEltwise::Opcode::Abs:
+            return ::fabsf(a);
+        case FusedEltwise::Opcode::Negative:
+            return -a;
+        case FusedEltwise::Opcode::Sqrt:
+            return ::sqrtf(a);
+        case FusedEltwise::Opcode::Swish:
+            return a / (1.0f + ::expf(-a));
+    }
+    return 0.0f;
+}
+
+template <typename T>
+__global__ void fused_eltwise(FusedEltwise::Program program,
+                              FusedEltwise::Inputs inputs,
+                              T* out,
+                              size_t num_elements) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= num_elements) {
+        return;
+    }
+    float registers[FusedEltwise::kMaxInputs + FusedEltwise::kMaxInstructions];
+    for (unsigned k = 0; k < program.num_inputs; ++k) {
+        const T* in = static_cast<const T*>(inputs.data[k]);
+        registers[k] = static_cast<float>(in[inputs.mappers[k].srcIndex(i)]);
+    }
+    for (unsigned k = 0; k < program.num_instructions; ++k) {
+        const auto& instruction = program.instructions[k];
+        registers[program.num_inputs + k] =
+            evaluate(instruction.opcode, registers[instruction.lhs], registers[instruction.rhs]);
+    }
+    out[i] = static_cast<T>(registers[program.num_inputs + program.num_instructions - 1]);
+}
+
+}  // namespace
+
+FusedEltwise::FusedEltwise(Type_t element_type,
+                           const Program& program,
+                           size_t num_elements,
+                           size_t max_threads_per_block)
+    : element_type_{element_type}, program_{program}, num_elements_{num_elements} {
+    std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(num_elements_, max_threads_per_block);
+}
+
+void FusedEltwise::operator()(cudaStream_t stream, const Inputs& inputs, void* out) const {
+    SupportedElementTypes::switch_(element_type_, *this, stream, inputs, out);
+}
+
+template <typename T>
+void FusedEltwise::case_(cudaStream_t stream, const Inputs& inputs, void* out) const noexcept {
+    fused_eltwise<T>
+        <<<num_blocks_, threads_per_block_, 0, stream>>>(program_, inputs, static_cast<T*>(out), num_elements_);
+}
+
+template <typename T>
+void FusedEltwise::default_(T t, cudaStream_t, const Inputs&, void*) const noexcept {
+    throwIEException(fmt::format("Element type = {} is not supported by FusedEltwise.", t));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cuda_type_traits.hpp"
+#include "elementtypeswitch.hpp"
+#include "numpy_broadcast_mapper.cuh"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Evaluates a program of elementwise operations for every output element in a single kernel.
+ * Inputs are broadcast to the output shape with numpy rules. Operations are computed in float.
+ */
+class FusedEltwise {
+public:
+    static constexpr std::size_t kMaxInputs = 8;
+    static constexpr std::size_t kMaxInstructions = 16;
+
+    enum class Opcode : std::uint8_t {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Maximum,
+        Minimum,
+        SquaredDifference,
+        Power,
+        Sigmoid,
+        Relu,
+        Tanh,
+        Exp,
+        Abs,
+        Negative,
+        Sqrt,
+        Swish
+    };
+
+    /**
+     * Operands are indices of registers: first registers hold inputs, instruction i writes
+     * register (number of inputs + i), the last written register is the output.
+     */
+    struct Instruction {
+        Opcode opcode;
+        std::uint8_t lhs;
+        std::uint8_t rhs;
+    };
+
+    struct Program {
+        Instruction instructions[kMaxInstructions];
+        unsigned num_instructions;
+        unsigned num_inputs;
+    };
+
+    struct Inputs {
+        const void* data[kMaxInputs];
+        NumpyBroadcastMapper mappers[kMaxInputs];
+    };
+
+    FusedEltwise(Type_t element_type, const Program& program, size_t num_elements, size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const Inputs& inputs, void* out) const;
+
+    template <typename T>
+    void case_(cudaStream_t stream, const Inputs& inputs, void* out) const noexcept;
+
+    template <typename T>
+    void default_(T t, cudaStream_t stream, const Inputs& inputs, void* out) const noexcept;
+
+private:
+    using SupportedElementTypes = ElementTypesSwitch<Type_t::f16, Type_t::f32>;
+
+    Type_t element_type_;
+    Program program_;
+    size_t num_elements_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
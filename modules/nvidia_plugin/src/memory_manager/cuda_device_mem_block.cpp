@@ -15,6 +15,13 @@ namespace nvidia_gpu {
 
 DeviceMemBlock::DeviceMemBlock(MemoryModel::Ptr model) : model_{move(model)} {}
 
+DeviceMemBlock::DeviceMemBlock(MemoryModel::Ptr model, DeviceMemoryArena::Slab&& slab)
+    : model_{move(model)}, slab_{std::move(slab)} {
+    IE_ASSERT(slab_->size() >= model_->deviceMemoryBlockSize())
+        << "Slab of " << slab_->size() << " bytes is too small for memory block of "
+        << model_->deviceMemoryBlockSize() << " bytes";
+}
+
 void* DeviceMemBlock::deviceBufferPtr(const BufferID& id) const {
     if (ptrdiff_t offset = 0; model_->offsetForBuffer(id, offset))
         return reinterpret_cast<uint8_t*>(device_mem_ptr_.get()) + offset;
@@ -6,7 +6,9 @@
 
 #include <cuda/runtime.hpp>
 #include <gsl/pointers>
+#include <optional>
 
+#include "memory_manager/cuda_device_memory_arena.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 
 namespace ov {
@@ -27,6 +29,13 @@ public:
      */
     DeviceMemBlock(MemoryModel::Ptr model);
 
+    /**
+     * Places the memory blob into a slab leased from DeviceMemoryArena,
+     * the slab is returned to the arena when the block is destroyed.
+     * @throws InferenceEngineException if the slab is smaller than the blob.
+     */
+    DeviceMemBlock(MemoryModel::Ptr model, DeviceMemoryArena::Slab&& slab);
+
     /**
      * Provides buffer memory address if any.
      *
@@ -55,7 +64,9 @@ public:
 
 private:
     MemoryModel::Ptr model_;
-    CUDA::DefaultAllocation device_mem_ptr_ = CUDA::DefaultStream::stream().malloc(model_->deviceMemoryBlockSize());
+    std::optional<DeviceMemoryArena::Slab> slab_;
+    CUDA::DefaultAllocation device_mem_ptr_ =
+        slab_ ? slab_->allocation() : CUDA::DefaultStream::stream().malloc(model_->deviceMemoryBlockSize());
 };
 
 }  // namespace nvidia_gpu
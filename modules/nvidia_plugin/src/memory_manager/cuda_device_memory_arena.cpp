@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_device_memory_arena.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <error.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+DeviceMemoryArena::Slab::~Slab() {
+    if (arena_) arena_->Release(std::move(allocation_), size_);
+}
+
+DeviceMemoryArena::Slab& DeviceMemoryArena::Slab::operator=(Slab&& other) noexcept {
+    if (this != &other) {
+        if (arena_) arena_->Release(std::move(allocation_), size_);
+        arena_ = std::move(other.arena_);
+        allocation_ = std::move(other.allocation_);
+        size_ = other.size_;
+    }
+    return *this;
+}
+
+DeviceMemoryArena::DeviceMemoryArena(const std::size_t capacity) : capacity_{capacity} {}
+
+DeviceMemoryArena::Slab DeviceMemoryArena::Lease(const std::size_t size, CancellationToken& cancellationToken) {
+    if (size > capacity_) {
+        throwIEException(fmt::format("Cannot lease {} bytes from device memory arena of {} bytes", size, capacity_));
+    }
+    std::unique_lock<std::mutex> lock{mtx_};
+    for (;;) {
+        cancellationToken.Check();
+        const auto fit = idle_slabs_.lower_bound(size);
+        if (fit != idle_slabs_.end() && fit->first - size <= size * (kMaxSlabOversize - 1)) {
+            return LeaseIdleSlab(fit);
+        }
+        if (allocated_size_ + size > capacity_) {
+            // There is no room for a new slab, so a larger idle one is better than waiting
+            if (fit != idle_slabs_.end()) {
+                return LeaseIdleSlab(fit);
+            }
+            // All idle slabs are smaller than requested, so they are only worth keeping while there is room
+            while (!idle_slabs_.empty() && allocated_size_ + size > capacity_) {
+                EvictIdleSlab();
+            }
+        }
+        if (allocated_size_ + size <= capacity_) {
+            try {
+                auto allocation = CUDA::DefaultStream::stream().malloc(size);
+                allocated_size_ += size;
+                leased_size_ += size;
+                high_water_mark_ = std::max(high_water_mark_, allocated_size_);
+                return Slab{shared_from_this(), std::move(allocation), size};
+            } catch (const std::exception&) {
+                /**
+                 * NOTE: Device memory is also consumed by constants of networks and other
+                 *       applications, so out of memory is handled as a temporary condition
+                 *       while there are slabs which can be freed or released
+                 */
+                if (fit != idle_slabs_.end()) {
+                    return LeaseIdleSlab(fit);
+                }
+                if (!idle_slabs_.empty()) {
+                    while (!idle_slabs_.empty()) {
+                        EvictIdleSlab();
+                    }
+                    continue;
+                }
+                if (leased_size_ == 0) {
+                    throw;
+                }
+            }
+        }
+        cond_var_.wait(lock);
+    }
+}
+
+void DeviceMemoryArena::Interrupt() { cond_var_.notify_all(); }
+
+std::size_t DeviceMemoryArena::AllocatedSize() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return allocated_size_;
+}
+
+std::size_t DeviceMemoryArena::LeasedSize() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return leased_size_;
+}
+
+std::size_t DeviceMemoryArena::HighWaterMark() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return high_water_mark_;
+}
+
+DeviceMemoryArena::Slab DeviceMemoryArena::LeaseIdleSlab(const IdleSlabs::iterator it) {
+    const auto slabSize = it->first;
+    auto allocation = std::move(it->second);
+    idle_slabs_.erase(it);
+    leased_size_ += slabSize;
+    return Slab{shared_from_this(), std::move(allocation), slabSize};
+}
+
+void DeviceMemoryArena::Release(CUDA::DefaultAllocation&& allocation, const std::size_t size) {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        leased_size_ -= size;
+        idle_slabs_.emplace(size, std::move(allocation));
+    }
+    // Waiters may need slabs of different sizes, so all of them should check
+    cond_var_.notify_all();
+}
+
+void DeviceMemoryArena::EvictIdleSlab() {
+    auto smallest = idle_slabs_.begin();
+    allocated_size_ -= smallest->first;
+    idle_slabs_.erase(smallest);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
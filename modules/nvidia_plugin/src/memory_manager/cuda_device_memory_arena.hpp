@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cancellation_token.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cuda/runtime.hpp>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief DeviceMemoryArena owns mutable memory slabs of a single CUDA device
+ * and leases them to infer requests of any ExecutableNetwork loaded on it.
+ *
+ * Slabs are allocated lazily and are kept after release, so networks which
+ * never run at the same time reuse the same device memory instead of
+ * reserving a block for their own peak each.
+ */
+class DeviceMemoryArena : public std::enable_shared_from_this<DeviceMemoryArena> {
+public:
+    /**
+     * @brief Slab is a leased continuous device memory region.
+     * It is returned to the arena on destruction.
+     */
+    class Slab {
+    public:
+        Slab(Slab&&) = default;
+        /**
+         * Returns the currently held region to the arena before taking the one of @other
+         */
+        Slab& operator=(Slab&& other) noexcept;
+        ~Slab();
+
+        const CUDA::DefaultAllocation& allocation() const { return allocation_; }
+        std::size_t size() const { return size_; }
+
+    private:
+        friend class DeviceMemoryArena;
+
+        Slab(std::shared_ptr<DeviceMemoryArena> arena, CUDA::DefaultAllocation allocation, std::size_t size)
+            : arena_{std::move(arena)}, allocation_{std::move(allocation)}, size_{size} {}
+
+        std::shared_ptr<DeviceMemoryArena> arena_;
+        CUDA::DefaultAllocation allocation_;
+        std::size_t size_;
+    };
+
+    /**
+     * @param capacity Maximum number of bytes the arena may hold allocated on device.
+     * By default the arena is limited by available device memory only.
+     */
+    explicit DeviceMemoryArena(std::size_t capacity = std::numeric_limits<std::size_t>::max());
+
+    /**
+     * Leases the smallest idle slab which fits @size bytes and is at most kMaxSlabOversize
+     * times larger. If there is no such slab, allocates a new one, evicting idle slabs
+     * which are too small when it is needed to stay within capacity. A larger idle slab
+     * is leased only when there is no room for a new one. Waits for other slabs to be
+     * released if the memory is still exhausted.
+     * @param size Number of bytes required
+     * @param cancellationToken Token which is checked while waiting
+     * @throws InferenceEngineException if @size can never be satisfied
+     */
+    Slab Lease(std::size_t size, CancellationToken& cancellationToken);
+
+    /**
+     * Interrupts waiting in Lease, so waiters check their cancellation tokens
+     */
+    void Interrupt();
+
+    std::size_t Capacity() const { return capacity_; }
+    /**
+     * @returns Number of bytes currently allocated on device, leased or idle
+     */
+    std::size_t AllocatedSize() const;
+    /**
+     * @returns Number of bytes currently leased to infer requests
+     */
+    std::size_t LeasedSize() const;
+    /**
+     * @returns Maximum number of bytes that have been allocated on device at once
+     */
+    std::size_t HighWaterMark() const;
+
+    /**
+     * Idle slabs larger than this factor of the requested size are kept for larger
+     * requests, so a small request doesn't force a new allocation for the next big one
+     */
+    static constexpr std::size_t kMaxSlabOversize = 2;
+
+private:
+    using IdleSlabs = std::multimap<std::size_t, CUDA::DefaultAllocation>;
+
+    Slab LeaseIdleSlab(IdleSlabs::iterator it);
+    void Release(CUDA::DefaultAllocation&& allocation, std::size_t size);
+    void EvictIdleSlab();
+
+    const std::size_t capacity_;
+    mutable std::mutex mtx_;
+    std::condition_variable cond_var_;
+    IdleSlabs idle_slabs_;
+    std::size_t allocated_size_ = 0;
+    std::size_t leased_size_ = 0;
+    std::size_t high_water_mark_ = 0;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_execution_plan.hpp"
+
+#include <algorithm>
+#include <details/ie_exception.hpp>
+
+#include "cuda_memory_manager.hpp"
+#include "cuda_operation_base.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::uint8_t* blockBase(const DeviceMemBlock& block) { return block.view().data(); }
+
+}  // namespace
+
+ExecutionPlan::ExecutionPlan(const MemoryManager& memoryManager) : memory_manager_{memoryManager} {}
+
+std::size_t ExecutionPlan::append(const OperationBase& operation) {
+    return append(operation, operation.GetWorkbufferIds());
+}
+
+std::size_t ExecutionPlan::append(const IOperationMeta& operation, const WorkbufferIds& workbufferIds) {
+    const auto& immutableTensorsModel = *memory_manager_.immutableTensors().memoryModel();
+    const auto& mutableTensorsModel = *memory_manager_.mutableTensorsMemoryModel();
+    Step step{};
+
+    const auto inputIds = operation.GetInputIds();
+    step.inputs = {inputs_.size(), inputIds.size()};
+    for (const auto& id : inputIds) {
+        const auto bufferId = id.GetBuffer().GetId();
+        ptrdiff_t offset = 0;
+        Block block = ImmutableTensors;
+        if (!immutableTensorsModel.offsetForBuffer(bufferId, offset)) {
+            block = MutableTensors;
+            const bool found = mutableTensorsModel.offsetForBuffer(bufferId, offset);
+            IE_ASSERT(found) << "Tensor not found. ID is " << id;
+        }
+        inputs_.push_back({block, offset + id.GetOffset()});
+    }
+
+    const auto outputIds = operation.GetOutputIds();
+    step.outputs = {outputs_.size(), outputIds.size()};
+    for (const auto& id : outputIds) {
+        ptrdiff_t offset = 0;
+        const bool found = mutableTensorsModel.offsetForBuffer(id.GetBuffer().GetId(), offset);
+        IE_ASSERT(found) << "Tensor not found. ID is " << id;
+        outputs_.push_back({MutableTensors, offset + id.GetOffset()});
+    }
+
+    step.immutableWorkbuffers = {workbuffers_.size(), workbufferIds.immutableIds.size()};
+    for (const auto id : workbufferIds.immutableIds) {
+        ptrdiff_t offset = 0;
+        const bool found = memory_manager_.immutableWorkbuffers().memoryModel()->offsetForBuffer(id, offset);
+        IE_ASSERT(found) << "Workbuffer not found. ID is " << id;
+        workbuffers_.push_back({ImmutableWorkbuffers, offset});
+    }
+    step.mutableWorkbuffers = {workbuffers_.size(), workbufferIds.mutableIds.size()};
+    for (const auto id : workbufferIds.mutableIds) {
+        ptrdiff_t offset = 0;
+        const bool found = mutableTensorsModel.offsetForBuffer(id, offset);
+        IE_ASSERT(found) << "Workbuffer not found. ID is " << id;
+        workbuffers_.push_back({MutableTensors, offset});
+    }
+
+    max_immutable_workbuffers_ = std::max(max_immutable_workbuffers_, step.immutableWorkbuffers.count);
+    steps_.push_back(step);
+    {
+        // Frames bound before don't have pointers of the new step
+        std::lock_guard<std::mutex> lock{frames_mtx_};
+        frames_.clear();
+    }
+    return steps_.size() - 1;
+}
+
+std::shared_ptr<const ExecutionPlan::Frame> ExecutionPlan::bind(CUDA::DevicePointer<void*> mutableBuffer) const {
+    std::lock_guard<std::mutex> lock{frames_mtx_};
+    if (auto it = frames_.find(mutableBuffer.get()); it != frames_.end()) {
+        return it->second;
+    }
+    if (frames_.size() >= kMaxCachedFrames) {
+        // Frames which are still in use are kept alive by their owners
+        frames_.clear();
+    }
+    std::shared_ptr<const Frame> frame{new Frame{*this, mutableBuffer}};
+    frames_.emplace(mutableBuffer.get(), frame);
+    return frame;
+}
+
+ExecutionPlan::Frame::Frame(const ExecutionPlan& plan, CUDA::DevicePointer<void*> mutableBuffer) : plan_{plan} {
+    bases_[ImmutableTensors] = blockBase(plan.memory_manager_.immutableTensors());
+    bases_[ImmutableWorkbuffers] =
+        plan.max_immutable_workbuffers_ > 0 ? blockBase(plan.memory_manager_.immutableWorkbuffers()) : nullptr;
+    bases_[MutableTensors] = mutableBuffer.cast<std::uint8_t*>().get();
+
+    inputs_.reserve(plan.inputs_.size());
+    for (const auto& location : plan.inputs_) inputs_.emplace_back(pointer(location));
+    outputs_.reserve(plan.outputs_.size());
+    for (const auto& location : plan.outputs_) outputs_.emplace_back(pointer(location));
+    workbuffers_.resize(plan.steps_.size());
+    for (std::size_t step = 0; step < plan.steps_.size(); ++step) {
+        const auto& immutableRange = plan.steps_[step].immutableWorkbuffers;
+        const auto& mutableRange = plan.steps_[step].mutableWorkbuffers;
+        auto& workbuffers = workbuffers_[step];
+        workbuffers.immutable_buffers.reserve(immutableRange.count);
+        for (std::size_t i = 0; i < immutableRange.count; ++i) {
+            workbuffers.immutable_buffers.emplace_back(pointer(plan.workbuffers_[immutableRange.begin + i]));
+        }
+        workbuffers.mutable_buffers.reserve(mutableRange.count);
+        for (std::size_t i = 0; i < mutableRange.count; ++i) {
+            workbuffers.mutable_buffers.emplace_back(pointer(plan.workbuffers_[mutableRange.begin + i]));
+        }
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gsl/span>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cuda/device_pointers.hpp"
+#include "cuda_workbuffers.hpp"
+#include "memory_manager/tensor_types.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class MemoryManager;
+class IOperationMeta;
+class OperationBase;
+
+/**
+ * @brief ExecutionPlan keeps device memory locations of input/output tensors
+ * and workbuffers of every operation of an execution sequence.
+ *
+ * Locations are resolved by means of MemoryManager once, when a graph is built,
+ * and stored in flat arrays as offsets within one of the memory blocks. So, during
+ * inference device pointers are computed as base + offset, without any lookups
+ * in memory models and heap allocations per operation.
+ */
+class ExecutionPlan {
+public:
+    class Frame;
+
+    /**
+     * @param [in] memoryManager Memory manager which tensor locations are resolved with.
+     * Immutable memory blocks of the manager should outlive the plan.
+     */
+    explicit ExecutionPlan(const MemoryManager& memoryManager);
+
+    /**
+     * Resolves tensors and workbuffers of an operation and appends them to the plan
+     * @returns Index of the operation step within the plan
+     * @throws InferenceEngineException if any of tensors or workbuffers is not found
+     */
+    std::size_t append(const IOperationMeta& operation, const WorkbufferIds& workbufferIds);
+    std::size_t append(const OperationBase& operation);
+
+    /**
+     * @returns Number of operation steps in the plan
+     */
+    std::size_t size() const { return steps_.size(); }
+
+    /**
+     * Returns device pointers of all steps for the given infer request specific memory block.
+     * Pointers are computed on the first call for a memory block and are reused afterwards,
+     * so inference with the same memory block doesn't resolve them again
+     * @param [in] mutableBuffer Mutable memory block of MemoryManager::mutableTensorsMemoryModel()
+     */
+    std::shared_ptr<const Frame> bind(CUDA::DevicePointer<void*> mutableBuffer) const;
+
+private:
+    enum Block : std::uint8_t { ImmutableTensors, ImmutableWorkbuffers, MutableTensors, NumOfBlocks };
+
+    struct Location {
+        Block block;
+        std::ptrdiff_t offset;
+    };
+
+    struct Range {
+        std::size_t begin;
+        std::size_t count;
+    };
+
+    struct Step {
+        Range inputs;
+        Range outputs;
+        Range immutableWorkbuffers;
+        Range mutableWorkbuffers;
+    };
+
+    const MemoryManager& memory_manager_;
+    std::vector<Step> steps_;
+    std::vector<Location> inputs_;
+    std::vector<Location> outputs_;
+    std::vector<Location> workbuffers_;
+    std::size_t max_immutable_workbuffers_ = 0;
+
+    /**
+     * Mutable memory blocks are kept by infer requests, so there are usually as many frames as
+     * infer requests. The limit only matters if memory blocks are reallocated at new addresses.
+     */
+    static constexpr std::size_t kMaxCachedFrames = 64;
+    mutable std::mutex frames_mtx_;
+    mutable std::unordered_map<const void*, std::shared_ptr<const Frame>> frames_;
+};
+
+/**
+ * @brief Frame holds device pointers of every step of ExecutionPlan bound to
+ * a single mutable memory block. It is immutable, so it is shared by all Execute
+ * calls which use the same memory block.
+ */
+class ExecutionPlan::Frame {
+public:
+    using Inputs = gsl::span<const CUDA::DevicePointer<const void*>>;
+    using Outputs = gsl::span<const CUDA::DevicePointer<void*>>;
+
+    /**
+     * @returns Input tensor pointers of the step
+     */
+    Inputs inputs(std::size_t step) const {
+        const auto& range = plan_.steps_[step].inputs;
+        return Inputs{inputs_}.subspan(range.begin, range.count);
+    }
+
+    /**
+     * @returns Output tensor pointers of the step
+     */
+    Outputs outputs(std::size_t step) const {
+        const auto& range = plan_.steps_[step].outputs;
+        return Outputs{outputs_}.subspan(range.begin, range.count);
+    }
+
+    /**
+     * @returns Workbuffer pointers of the step
+     */
+    const Workbuffers& workbuffers(std::size_t step) const { return workbuffers_[step]; }
+
+private:
+    friend class ExecutionPlan;
+
+    Frame(const ExecutionPlan& plan, CUDA::DevicePointer<void*> mutableBuffer);
+
+    std::uint8_t* pointer(const Location& location) const { return bases_[location.block] + location.offset; }
+
+    const ExecutionPlan& plan_;
+    std::array<std::uint8_t*, NumOfBlocks> bases_;
+    std::vector<CUDA::DevicePointer<const void*>> inputs_;
+    std::vector<CUDA::DevicePointer<void*>> outputs_;
+    std::vector<Workbuffers> workbuffers_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
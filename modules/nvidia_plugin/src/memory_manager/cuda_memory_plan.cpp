@@ -0,0 +1,260 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_plan.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <error.hpp>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <type_traits>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr std::array<char, 8> kMagic{'C', 'U', 'D', 'A', 'P', 'L', 'A', 'N'};
+
+// Values are written field by field as fixed-width integers, so the format doesn't depend on padding of structs
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    static_assert((std::is_integral_v<T> && sizeof(T) == 4) || std::is_same_v<T, std::uint64_t> ||
+                  std::is_same_v<T, std::int64_t>);
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    static_assert((std::is_integral_v<T> && sizeof(T) == 4) || std::is_same_v<T, std::uint64_t> ||
+                  std::is_same_v<T, std::int64_t>);
+    T value{};
+    if (!stream.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+        throwIEException("Unexpected end of memory plan");
+    }
+    return value;
+}
+
+// Returns the number of bytes left in the stream or the maximal value if the stream isn't seekable
+std::uint64_t remainingSize(std::istream& stream) {
+    const auto position = stream.tellg();
+    if (position == std::istream::pos_type{-1}) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(position);
+    return static_cast<std::uint64_t>(end - position);
+}
+
+// Reads a number of items taking at least itemSize bytes each, so a corrupted plan fails before allocation
+std::uint64_t readSize(std::istream& stream, std::uint64_t itemSize) {
+    const auto size = readValue<std::uint64_t>(stream);
+    if (size > remainingSize(stream) / itemSize) {
+        throwIEException(fmt::format("Memory plan size {} exceeds the rest of the stream", size));
+    }
+    return size;
+}
+
+void writeString(std::ostream& stream, const std::string& value) {
+    writeValue(stream, static_cast<std::uint64_t>(value.size()));
+    stream.write(value.data(), value.size());
+}
+
+std::string readString(std::istream& stream) {
+    // Read by chunks, so sizes are also limited by the data really stored in not seekable streams
+    constexpr std::uint64_t kChunkSize = 1 << 16;
+    const auto size = readSize(stream, 1);
+    std::string value;
+    while (value.size() < size) {
+        const auto offset = value.size();
+        value.resize(offset + std::min(kChunkSize, size - offset));
+        if (!stream.read(value.data() + offset, value.size() - offset)) {
+            throwIEException("Unexpected end of memory plan");
+        }
+    }
+    return value;
+}
+
+template <typename T, typename Writer>
+void writeVector(std::ostream& stream, const std::vector<T>& values, Writer&& writer) {
+    writeValue(stream, static_cast<std::uint64_t>(values.size()));
+    for (const auto& value : values) writer(stream, value);
+}
+
+template <typename T, typename Reader>
+std::vector<T> readVector(std::istream& stream, Reader&& reader) {
+    // Every item has at least one 32-bit field
+    const auto size = readSize(stream, sizeof(std::uint32_t));
+    std::vector<T> values;
+    for (std::uint64_t i = 0; i < size; ++i) values.push_back(reader(stream));
+    return values;
+}
+
+void writeId(std::ostream& stream, BufferID id) { writeValue(stream, static_cast<std::uint32_t>(id)); }
+
+BufferID readId(std::istream& stream) { return static_cast<BufferID>(readValue<std::uint32_t>(stream)); }
+
+void writeIds(std::ostream& stream, const std::vector<BufferID>& ids) { writeVector(stream, ids, &writeId); }
+
+std::vector<BufferID> readIds(std::istream& stream) { return readVector<BufferID>(stream, &readId); }
+
+void writeSizes(std::ostream& stream, const std::vector<WorkbufferRequest::size_in_bytes_t>& sizes) {
+    writeVector(stream, sizes, [](std::ostream& s, auto size) { writeValue(s, static_cast<std::uint64_t>(size)); });
+}
+
+std::vector<WorkbufferRequest::size_in_bytes_t> readSizes(std::istream& stream) {
+    return readVector<WorkbufferRequest::size_in_bytes_t>(stream, [](std::istream& s) {
+        return static_cast<WorkbufferRequest::size_in_bytes_t>(readValue<std::uint64_t>(s));
+    });
+}
+
+void writeTensors(std::ostream& stream, const std::vector<MemoryPlan::Tensor>& tensors) {
+    writeVector(stream, tensors, [](std::ostream& s, const MemoryPlan::Tensor& tensor) {
+        writeId(s, tensor.id);
+        writeId(s, tensor.buffer);
+        writeValue(s, static_cast<std::uint32_t>(tensor.offset));
+    });
+}
+
+std::vector<MemoryPlan::Tensor> readTensors(std::istream& stream) {
+    return readVector<MemoryPlan::Tensor>(stream, [](std::istream& s) {
+        MemoryPlan::Tensor tensor{};
+        tensor.id = readId(s);
+        tensor.buffer = readId(s);
+        tensor.offset = static_cast<unsigned>(readValue<std::uint32_t>(s));
+        return tensor;
+    });
+}
+
+void writeModel(std::ostream& stream, const MemoryPlan::Model& model) {
+    writeValue(stream, static_cast<std::uint64_t>(model.size));
+    writeVector(stream, model.offsets, [](std::ostream& s, const auto& offset) {
+        writeId(s, offset.first);
+        writeValue(s, static_cast<std::int64_t>(offset.second));
+    });
+}
+
+MemoryPlan::Model readModel(std::istream& stream) {
+    MemoryPlan::Model model;
+    model.size = readValue<std::uint64_t>(stream);
+    model.offsets = readVector<std::pair<BufferID, ptrdiff_t>>(stream, [](std::istream& s) {
+        const auto id = readId(s);
+        return std::make_pair(id, static_cast<ptrdiff_t>(readValue<std::int64_t>(s)));
+    });
+    return model;
+}
+
+void writeNode(std::ostream& stream, const MemoryPlan::Node& node) {
+    writeString(stream, node.name);
+    writeTensors(stream, node.inputs);
+    writeTensors(stream, node.outputs);
+    writeSizes(stream, node.workbufferRequest.immutable_sizes);
+    writeSizes(stream, node.workbufferRequest.mutable_sizes);
+    writeIds(stream, node.workbufferIds.immutableIds);
+    writeIds(stream, node.workbufferIds.mutableIds);
+}
+
+MemoryPlan::Node readNode(std::istream& stream) {
+    MemoryPlan::Node node;
+    node.name = readString(stream);
+    node.inputs = readTensors(stream);
+    node.outputs = readTensors(stream);
+    node.workbufferRequest.immutable_sizes = readSizes(stream);
+    node.workbufferRequest.mutable_sizes = readSizes(stream);
+    node.workbufferIds.immutableIds = readIds(stream);
+    node.workbufferIds.mutableIds = readIds(stream);
+    return node;
+}
+
+}  // namespace
+
+MemoryPlan::Tensor MemoryPlan::toTensor(const TensorID& tensorId) {
+    return {tensorId.GetId(), tensorId.GetBuffer().GetId(), tensorId.GetOffset()};
+}
+
+std::vector<MemoryPlan::Tensor> MemoryPlan::toTensors(gsl::span<const TensorID> tensorIds) {
+    std::vector<Tensor> result;
+    result.reserve(tensorIds.size());
+    std::transform(tensorIds.begin(), tensorIds.end(), std::back_inserter(result), &MemoryPlan::toTensor);
+    return result;
+}
+
+std::vector<TensorID> MemoryPlan::toTensorIds(const std::vector<Tensor>& tensors) {
+    std::vector<TensorID> result;
+    result.reserve(tensors.size());
+    for (const auto& tensor : tensors) {
+        auto& tensorId = result.emplace_back(tensor.id);
+        if (tensor.buffer != tensor.id) {
+            tensorId.SetParent(std::make_shared<TensorID>(tensor.buffer), tensor.offset);
+        }
+    }
+    return result;
+}
+
+MemoryPlan::Model MemoryPlan::toModel(const MemoryModel& model) {
+    Model result;
+    result.size = model.deviceMemoryBlockSize();
+    for (auto id : model.bufferIds()) {
+        ptrdiff_t offset = 0;
+        model.offsetForBuffer(id, offset);
+        result.offsets.emplace_back(id, offset);
+    }
+    return result;
+}
+
+MemoryModel::Ptr MemoryPlan::toMemoryModel(const Model& model) {
+    const std::unordered_map<BufferID, ptrdiff_t> offsets{model.offsets.begin(), model.offsets.end()};
+    return std::make_shared<MemoryModel>(model.size, offsets);
+}
+
+void MemoryPlan::write(std::ostream& stream) const {
+    std::stringstream payload;
+    writeVector(payload, nodes, &writeNode);
+    writeModel(payload, constants);
+    writeModel(payload, mutableBuffers);
+    writeModel(payload, immutableWorkbuffers);
+    writeValue(payload, static_cast<std::uint32_t>(streams));
+
+    const auto data = payload.str();
+    stream.write(kMagic.data(), kMagic.size());
+    writeValue(stream, kVersion);
+    writeValue(stream, static_cast<std::uint64_t>(data.size()));
+    stream.write(data.data(), data.size());
+}
+
+std::optional<MemoryPlan> MemoryPlan::read(std::istream& stream) {
+    // Whatever follows the network in the stream is left unread if it isn't a plan
+    const auto start = stream.tellg();
+    std::array<char, kMagic.size()> magic{};
+    if (!stream.read(magic.data(), magic.size()) || magic != kMagic) {
+        stream.clear();
+        if (start != std::istream::pos_type{-1}) {
+            stream.seekg(start);
+        }
+        return std::nullopt;
+    }
+    const auto version = readValue<std::uint32_t>(stream);
+    const auto size = readValue<std::uint64_t>(stream);
+    if (version != kVersion) {
+        stream.ignore(size);
+        return std::nullopt;
+    }
+
+    MemoryPlan plan;
+    plan.nodes = readVector<Node>(stream, &readNode);
+    plan.constants = readModel(stream);
+    plan.mutableBuffers = readModel(stream);
+    plan.immutableWorkbuffers = readModel(stream);
+    plan.streams = readValue<std::uint32_t>(stream);
+    return plan;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <gsl/span>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "memory_manager/cuda_workbuffers.hpp"
+#include "memory_manager/model/cuda_memory_model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief MemoryPlan is a serializable result of OperationBuffersExtractor and
+ * memory planning for a graph.
+ *
+ * It keeps tensor and workbuffer identifiers of every node and all memory
+ * models of the graph, so the graph can be rebuilt without extracting buffers
+ * and solving memory placement again (e.g. on ImportNetwork).
+ * The plan doesn't contain the executable function. It is stored after the exported
+ * function, which common passes have already been applied to, so on import only
+ * device passes are run before the plan is applied (see GraphTransformer::transform_exported).
+ */
+class MemoryPlan {
+public:
+    /**
+     * Version of the binary format, plans of other versions are ignored on read
+     */
+    static constexpr std::uint32_t kVersion = 3;
+
+    /**
+     * Flattened TensorID: tensor identifier, identifier of the root buffer and offset within it
+     */
+    struct Tensor {
+        BufferID id;
+        BufferID buffer;
+        unsigned offset;
+    };
+
+    /**
+     * Buffers of a single node. Nodes go in the order of ov::Model::get_ordered_ops()
+     */
+    struct Node {
+        std::string name;
+        std::vector<Tensor> inputs;
+        std::vector<Tensor> outputs;
+        /** Request the ids were allocated for, used to check the plan still fits the operation */
+        WorkbufferRequest workbufferRequest;
+        WorkbufferIds workbufferIds;
+    };
+
+    /**
+     * Serializable MemoryModel
+     */
+    struct Model {
+        std::size_t size = 0;
+        std::vector<std::pair<BufferID, ptrdiff_t>> offsets;
+    };
+
+    static Tensor toTensor(const TensorID& tensorId);
+    static std::vector<Tensor> toTensors(gsl::span<const TensorID> tensorIds);
+    static std::vector<TensorID> toTensorIds(const std::vector<Tensor>& tensors);
+    static Model toModel(const MemoryModel& model);
+    static MemoryModel::Ptr toMemoryModel(const Model& model);
+
+    /**
+     * Writes plan in the versioned binary format
+     */
+    void write(std::ostream& stream) const;
+
+    /**
+     * Reads plan written by write()
+     * @returns Plan or std::nullopt if stream doesn't contain a plan of the current version.
+     * If the stream doesn't start with a plan at all, its read position is restored.
+     */
+    static std::optional<MemoryPlan> read(std::istream& stream);
+
+    std::vector<Node> nodes;
+    Model constants;
+    Model mutableBuffers;
+    Model immutableWorkbuffers;
+    /** Streams per infer request lifespans of mutable buffers were computed for */
+    std::uint32_t streams = 1;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
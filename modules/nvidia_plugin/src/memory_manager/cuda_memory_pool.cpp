@@ -6,16 +6,29 @@
 
 #include <fmt/printf.h>
 
+#include <algorithm>
+
 #include "model/cuda_memory_model.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
-MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel) {
-    memory_blocks_.reserve(num);
+MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel)
+    : MemoryPool{num, num, std::chrono::milliseconds{0}, move(memoryModel)} {}
+
+MemoryPool::MemoryPool(const size_t minNum,
+                       const size_t maxNum,
+                       const std::chrono::milliseconds idleTimeout,
+                       std::shared_ptr<MemoryModel> memoryModel)
+    : memory_model_{move(memoryModel)}, min_size_{minNum}, max_size_{maxNum}, idle_timeout_{idleTimeout} {
+    if (minNum > maxNum) {
+        throwIEException(fmt::format("MemoryPool minimal size {} is greater than maximal size {}", minNum, maxNum));
+    }
+    memory_blocks_.reserve(minNum);
     try {
-        for (int i = 0; i < num; ++i) {
-            memory_blocks_.push_back(std::make_unique<DeviceMemBlock>(memoryModel));
+        for (int i = 0; i < minNum; ++i) {
+            CancellationToken cancellationToken{};
+            memory_blocks_.push_back({CreateBlock(cancellationToken), Time::now()});
         }
     } catch (const std::exception& ex) {
         // TODO: Added log message when logging mechanism will be supported
@@ -26,40 +39,147 @@ MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryMode
         if (memory_blocks_.empty()) {
             throw;
         }
+        min_size_ = max_size_ = memory_blocks_.size();
     }
+    num_allocated_ = memory_blocks_.size();
 }
 
-void MemoryPool::Interrupt() { cond_var_.notify_all(); }
+MemoryPool::MemoryPool(const size_t num,
+                       std::shared_ptr<MemoryModel> memoryModel,
+                       std::shared_ptr<DeviceMemoryArena> arena)
+    : memory_model_{move(memoryModel)}, arena_{move(arena)}, max_size_{num} {}
+
+void MemoryPool::Interrupt() {
+    cond_var_.notify_all();
+    if (arena_) arena_->Interrupt();
+}
 
 MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken) {
-    std::unique_lock<std::mutex> lock{mtx_};
-    cond_var_.wait(lock, [this, &cancellationToken] {
-        cancellationToken.Check();
-        return !memory_blocks_.empty();
-    });
-    Proxy memoryManagerProxy{shared_from_this(), move(memory_blocks_.back())};
-    memory_blocks_.pop_back();
-    return memoryManagerProxy;
+    const auto start = Time::now();
+    bool waited = false;
+    std::unique_ptr<DeviceMemBlock> memoryBlock;
+    {
+        std::unique_lock<std::mutex> lock{mtx_};
+        ReleaseIdleBlocks(start);
+        cond_var_.wait(lock, [this, &cancellationToken, &waited] {
+            cancellationToken.Check();
+            if (!memory_blocks_.empty() || num_allocated_ < max_size_) {
+                return true;
+            }
+            waited = true;
+            return false;
+        });
+        if (!memory_blocks_.empty()) {
+            memoryBlock = move(memory_blocks_.back().block);
+            memory_blocks_.pop_back();
+        } else {
+            // Reserves a place for a new DeviceMemBlock, it is allocated without holding the lock
+            ++num_allocated_;
+        }
+        ++num_in_use_;
+    }
+    if (!memoryBlock) {
+        try {
+            memoryBlock = CreateBlock(cancellationToken);
+        } catch (const std::exception&) {
+            bool retry = false;
+            {
+                std::lock_guard<std::mutex> lock{mtx_};
+                --num_allocated_;
+                --num_in_use_;
+                if (!arena_ && num_allocated_ > 0) {
+                    // Device is out of memory, so requests should wait for already allocated blocks
+                    max_size_ = num_allocated_;
+                    retry = true;
+                }
+            }
+            cond_var_.notify_one();
+            if (!retry) {
+                throw;
+            }
+            return WaitAndGet(cancellationToken);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        const auto waitTime = Time::now() - start;
+        ++num_requests_;
+        num_waits_ += waited;
+        total_wait_time_ += waitTime;
+        max_wait_time_ = std::max(max_wait_time_, waitTime);
+        peak_in_use_ = std::max(peak_in_use_, num_in_use_);
+    }
+    return Proxy{shared_from_this(), move(memoryBlock)};
 }
 
-size_t MemoryPool::Size() const { return memory_blocks_.size(); }
+size_t MemoryPool::Size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return max_size_;
+}
 
 void MemoryPool::Resize(size_t count) {
-    const auto memoryManagersCount = memory_blocks_.size();
-    if (count > memoryManagersCount) {
-        throwIEException(
-            fmt::format("Cannot resize MemoryPool with {} value > than it was {}", count, memoryManagersCount));
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        max_size_ = count;
+        min_size_ = std::min(min_size_, count);
+        while (num_allocated_ > max_size_ && !memory_blocks_.empty()) {
+            memory_blocks_.erase(memory_blocks_.begin());
+            --num_allocated_;
+        }
     }
-    memory_blocks_.resize(count);
+    // Waiters may allocate new DeviceMemBlock-s if the maximum has grown
+    cond_var_.notify_all();
+}
+
+MemoryPool::Statistics MemoryPool::GetStatistics() const {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    std::lock_guard<std::mutex> lock{mtx_};
+    return {num_allocated_,
+            num_in_use_,
+            peak_in_use_,
+            num_requests_,
+            num_waits_,
+            duration_cast<microseconds>(total_wait_time_),
+            duration_cast<microseconds>(max_wait_time_)};
 }
 
 void MemoryPool::PushBack(std::unique_ptr<DeviceMemBlock> memManager) {
     {
         std::lock_guard<std::mutex> lock{mtx_};
-        memory_blocks_.push_back(std::move(memManager));
+        --num_in_use_;
+        if (arena_ || num_allocated_ > max_size_) {
+            // Returns the slab to arena, so infer requests of other networks can use it
+            memManager.reset();
+            --num_allocated_;
+        } else {
+            const auto now = Time::now();
+            memory_blocks_.push_back({std::move(memManager), now});
+            ReleaseIdleBlocks(now);
+        }
     }
     cond_var_.notify_one();
 }
 
+std::unique_ptr<DeviceMemBlock> MemoryPool::CreateBlock(CancellationToken& cancellationToken) const {
+    if (arena_) {
+        return std::make_unique<DeviceMemBlock>(
+            memory_model_, arena_->Lease(memory_model_->deviceMemoryBlockSize(), cancellationToken));
+    }
+    return std::make_unique<DeviceMemBlock>(memory_model_);
+}
+
+void MemoryPool::ReleaseIdleBlocks(const Time::time_point now) {
+    if (idle_timeout_.count() == 0) {
+        return;
+    }
+    // Blocks are taken from the back, so the front one has been available for the longest time
+    while (num_allocated_ > min_size_ && !memory_blocks_.empty() &&
+           now - memory_blocks_.front().since > idle_timeout_) {
+        memory_blocks_.erase(memory_blocks_.begin());
+        --num_allocated_;
+    }
+}
+
 }  // namespace nvidia_gpu
 }  // namespace ov
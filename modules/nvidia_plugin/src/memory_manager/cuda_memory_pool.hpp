@@ -5,9 +5,11 @@
 #pragma once
 
 #include <cancellation_token.hpp>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 
+#include "memory_manager/cuda_device_memory_arena.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 
@@ -20,10 +22,29 @@ namespace nvidia_gpu {
  * @brief MemoryPool provides currently available DeviceMemBlock.
  *
  * This class is an owner of bunch of DeviceMemBlock-s and provides on request
- * WaitAndGet currently available DeviceMemBlock from pool
+ * WaitAndGet currently available DeviceMemBlock from pool.
+ * Elastic pool keeps only a minimal number of DeviceMemBlock-s allocated, allocates
+ * more of them up to a maximal number when there is no available one, and releases
+ * DeviceMemBlock-s which have not been used for an idle timeout.
+ * Releasing is lazy: idle DeviceMemBlock-s are checked only when the pool is used
+ * (WaitAndGet or returning of a DeviceMemBlock), so a pool which is not used at all
+ * keeps its DeviceMemBlock-s until the next inference.
  */
 class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
 public:
+    /**
+     * @brief Statistics of DeviceMemBlock-s usage
+     */
+    struct Statistics {
+        size_t numAllocated;  // DeviceMemBlock-s allocated on device, available or in use
+        size_t numInUse;
+        size_t peakInUse;
+        size_t numRequests;  // WaitAndGet calls
+        size_t numWaits;     // WaitAndGet calls which did not find available DeviceMemBlock
+        std::chrono::microseconds totalWaitTime;
+        std::chrono::microseconds maxWaitTime;
+    };
+
     /**
      * @brief Proxy provides currently available DeviceMemBlock.
      *
@@ -72,6 +93,30 @@ public:
      */
     MemoryPool(size_t num, std::shared_ptr<MemoryModel> memoryModel);
 
+    /**
+     * Creates elastic MemoryPool
+     * @param minNum Number of DeviceMemBlock-s that are allocated at once and kept when idle
+     * @param maxNum Maximum number of DeviceMemBlock-s
+     * @param idleTimeout Time after which unused DeviceMemBlock above @minNum is released on the next
+     *                    use of the pool, zero value means DeviceMemBlock-s are never released
+     * @param memoryModel MemoryModel that is used by each DeviceMemBlock as a layout of memory blob
+     * @throws InferenceEngineException if @minNum is greater than @maxNum
+     */
+    MemoryPool(size_t minNum,
+               size_t maxNum,
+               std::chrono::milliseconds idleTimeout,
+               std::shared_ptr<MemoryModel> memoryModel);
+
+    /**
+     * Creates MemoryPool that allows @num DeviceMemBlock-s at once, but does not
+     * own device memory. Each DeviceMemBlock is placed into a slab leased from @arena
+     * on WaitAndGet and the slab is returned back together with DeviceMemBlock
+     * @param num Maximum number of DeviceMemBlock-s in use
+     * @param memoryModel MemoryModel that is used by each DeviceMemBlock as a layout of memory blob
+     * @param arena Device memory arena shared with other networks loaded on the same device
+     */
+    MemoryPool(size_t num, std::shared_ptr<MemoryModel> memoryModel, std::shared_ptr<DeviceMemoryArena> arena);
+
     /**
      * Interrupt waiting of DeviceMemBlock Proxy object
      */
@@ -82,21 +127,55 @@ public:
      */
     Proxy WaitAndGet(CancellationToken& cancellationToken);
 
+    /**
+     * @return Maximum number of DeviceMemBlock-s
+     */
     size_t Size() const;
+    /**
+     * Changes maximum number of DeviceMemBlock-s, available DeviceMemBlock-s
+     * above the new maximum are released at once and waiters are woken up
+     * if the maximum has grown
+     * @param count New maximum number of DeviceMemBlock-s
+     */
     void Resize(size_t count);
 
+    Statistics GetStatistics() const;
+
 private:
     friend class ::MemoryPoolTest;
 
+    using Time = std::chrono::steady_clock;
+
+    struct AvailableBlock {
+        std::unique_ptr<DeviceMemBlock> block;
+        Time::time_point since;
+    };
+
     /**
      * Move DeviceMemBlock back to pool
      * @param memManager DeviceMemBlock
      */
     void PushBack(std::unique_ptr<DeviceMemBlock> memManager);
 
-    std::mutex mtx_;
+    std::unique_ptr<DeviceMemBlock> CreateBlock(CancellationToken& cancellationToken) const;
+    void ReleaseIdleBlocks(Time::time_point now);
+
+    mutable std::mutex mtx_;
     std::condition_variable cond_var_;
-    std::vector<std::unique_ptr<DeviceMemBlock>> memory_blocks_;
+    // Available DeviceMemBlock-s, the most recently used one is at the back
+    std::vector<AvailableBlock> memory_blocks_;
+    std::shared_ptr<MemoryModel> memory_model_;
+    std::shared_ptr<DeviceMemoryArena> arena_;
+    size_t min_size_ = 0;
+    size_t max_size_ = 0;
+    std::chrono::milliseconds idle_timeout_{0};
+    size_t num_allocated_ = 0;
+    size_t num_in_use_ = 0;
+    size_t peak_in_use_ = 0;
+    size_t num_requests_ = 0;
+    size_t num_waits_ = 0;
+    Time::duration total_wait_time_{0};
+    Time::duration max_wait_time_{0};
 };
 
 }  // namespace nvidia_gpu
@@ -11,6 +11,12 @@
 namespace ov {
 namespace nvidia_gpu {
 
+MemoryModelBuilder::MemoryModelBuilder() : MemoryModelBuilder{defaultMemoryPlanners()} {}
+
+MemoryModelBuilder::MemoryModelBuilder(std::vector<MemoryPlanner::Ptr> planners) : planners_{std::move(planners)} {
+    IE_ASSERT(!planners_.empty());
+}
+
 void MemoryModelBuilder::addAllocation(BufferID id, int producerIndex, int lastConsumerIndex, size_t bsize) {
     IE_ASSERT(bsize > 0);  // Verify that allocation size isn't zero.
     auto res = offsets_.emplace(id, 0);
@@ -20,11 +26,28 @@ void MemoryModelBuilder::addAllocation(BufferID id, int producerIndex, int lastC
 }
 
 MemoryModel::Ptr MemoryModelBuilder::build() {
-    MemorySolver solver{boxes_};
-    const size_t blob_size = solver.solve();
-    for (auto& pair : offsets_) pair.second = solver.getOffset(pair.first);
-
-    return std::make_shared<MemoryModel>(blob_size, offsets_);
+    const int64_t lower_bound = MemorySolver{boxes_}.maxDepth();
+
+    int64_t best_size = -1;
+    MemoryPlanner::Offsets best_offsets;
+    MemoryPlanner::Offsets offsets;
+    report_ = {};
+    for (const auto& planner : planners_) {
+        offsets.clear();
+        const int64_t size = planner->plan(boxes_, offsets);
+        if (size < 0 || (best_size >= 0 && size >= best_size)) continue;
+        best_size = size;
+        best_offsets.swap(offsets);
+        report_.planner = planner->name();
+        if (best_size == lower_bound) break;
+    }
+    IE_ASSERT(best_size >= 0);  // Verify that at least one planner succeeded.
+
+    for (auto& pair : offsets_) pair.second = best_offsets.at(pair.first);
+    report_.blobSize = static_cast<size_t>(best_size);
+    report_.lowerBound = static_cast<size_t>(std::max<int64_t>(lower_bound, 0));
+
+    return std::make_shared<MemoryModel>(report_.blobSize, offsets_);
 }
 
 }  // namespace nvidia_gpu
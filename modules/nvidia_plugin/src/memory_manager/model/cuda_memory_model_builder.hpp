@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "memory_manager/model/cuda_memory_model.hpp"
+#include "memory_manager/model/details/cuda_memory_planner.hpp"
 #include "memory_manager/model/details/cuda_memory_solver.hpp"
 
 namespace ov {
@@ -16,6 +20,32 @@ namespace nvidia_gpu {
  */
 class MemoryModelBuilder {
 public:
+    /**
+     * Describes the outcome of the last build() call.
+     */
+    struct PlanningReport {
+        /** Name of the planner which produced the smallest memory blob */
+        std::string planner;
+        /** Size of the planned memory blob in bytes */
+        size_t blobSize = 0;
+        /**
+         * Max sum of allocation sizes alive at the same time (MemorySolver::maxDepth()).
+         * No planner can do better than this value.
+         */
+        size_t lowerBound = 0;
+    };
+
+    /**
+     * Uses defaultMemoryPlanners()
+     */
+    MemoryModelBuilder();
+
+    /**
+     * @param [in] planners Planning strategies to try. The smallest memory blob wins.
+     * @throws InferenceEngineException if no planners are provided
+     */
+    explicit MemoryModelBuilder(std::vector<MemoryPlanner::Ptr> planners);
+
     /**
      * Defines a single tensor allocation.
      *
@@ -33,12 +63,20 @@ public:
 
     /**
      * Creates and initializes MemoryModel object.
+     * Runs the planners and keeps the smallest memory blob.
      */
     MemoryModel::Ptr build();
 
+    /**
+     * @returns Planning result of the last build() call, exposed as NVIDIA_MEMORY_PLAN_* metrics
+     */
+    const PlanningReport& planningReport() const { return report_; }
+
 private:
+    std::vector<MemoryPlanner::Ptr> planners_;
     std::vector<MemorySolver::Box> boxes_;
     std::unordered_map<BufferID, ptrdiff_t> offsets_;
+    PlanningReport report_;
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_interval_tree.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace ov {
+namespace nvidia_gpu {
+
+TimeIntervalTree::TimeIntervalTree(const std::vector<Interval>& intervals)
+    : intervals_{intervals}, order_(intervals.size()), position_(intervals.size()) {
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(order_.begin(), order_.end(), [this](std::size_t l, std::size_t r) {
+        return intervals_[l].start < intervals_[r].start;
+    });
+    sorted_starts_.reserve(order_.size());
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+        position_[order_[i]] = i;
+        sorted_starts_.push_back(intervals_[order_[i]].start);
+    }
+    while (leaves_ < order_.size()) leaves_ <<= 1;
+    max_finish_.assign(2 * leaves_, kNotInserted);
+}
+
+void TimeIntervalTree::insert(std::size_t index) { update(index, intervals_.at(index).finish); }
+
+void TimeIntervalTree::erase(std::size_t index) { update(index, kNotInserted); }
+
+void TimeIntervalTree::update(std::size_t index, int finish) {
+    std::size_t node = leaves_ + position_.at(index);
+    max_finish_[node] = finish;
+    for (node >>= 1; node > 0; node >>= 1) {
+        max_finish_[node] = std::max(max_finish_[2 * node], max_finish_[2 * node + 1]);
+    }
+}
+
+void TimeIntervalTree::query(int start, int finish, std::vector<std::size_t>& result) const {
+    // Only intervals which start not later than the given finish can intersect it
+    const auto end = static_cast<std::size_t>(
+        std::upper_bound(sorted_starts_.begin(), sorted_starts_.end(), finish) - sorted_starts_.begin());
+    if (end == 0) return;
+    query(1, 0, leaves_, end, start, result);
+}
+
+void TimeIntervalTree::query(std::size_t node, std::size_t lo, std::size_t hi, std::size_t end, int start,
+                             std::vector<std::size_t>& result) const {
+    if (lo >= end || max_finish_[node] < start) return;
+    if (node >= leaves_) {
+        result.push_back(order_[lo]);
+        return;
+    }
+    const std::size_t mid = (lo + hi) / 2;
+    query(2 * node, lo, mid, end, start, result);
+    query(2 * node + 1, mid, hi, end, start, result);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Static interval tree over execution order time slots.
+ *
+ * All intervals are known in advance (one per MemorySolver::Box), but they
+ * become visible for queries only after they are inserted. This matches the
+ * way memory planners work: boxes are placed one by one and every new box
+ * has to be checked against the boxes already placed that are alive at the
+ * same time.
+ *
+ * Intervals are closed: [start, finish]. Both insertion and query cost
+ * O(log N) plus O(log N) per reported interval.
+ */
+class TimeIntervalTree {
+public:
+    struct Interval {
+        int start;
+        int finish;
+    };
+
+    explicit TimeIntervalTree(const std::vector<Interval>& intervals);
+
+    /**
+     * Makes interval with the given index (position in c-tor argument) visible for queries
+     */
+    void insert(std::size_t index);
+
+    /**
+     * Hides interval with the given index from queries
+     */
+    void erase(std::size_t index);
+
+    /**
+     * Collects indices of all inserted intervals which intersect [start, finish]
+     * @param [out] result Indices are appended to this vector
+     */
+    void query(int start, int finish, std::vector<std::size_t>& result) const;
+
+    std::size_t size() const { return order_.size(); }
+
+private:
+    static constexpr int kNotInserted = INT32_MIN;
+
+    void update(std::size_t index, int finish);
+    void query(std::size_t node, std::size_t lo, std::size_t hi, std::size_t end, int start,
+               std::vector<std::size_t>& result) const;
+
+    std::vector<Interval> intervals_;
+    /** Interval indices sorted by interval start */
+    std::vector<std::size_t> order_;
+    /** Position of every interval inside order_ */
+    std::vector<std::size_t> position_;
+    /** Starts of intervals in order_, used for binary search */
+    std::vector<int> sorted_starts_;
+    /** Segment tree over order_ which keeps max finish of inserted intervals */
+    std::vector<int> max_finish_;
+    std::size_t leaves_ = 1;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
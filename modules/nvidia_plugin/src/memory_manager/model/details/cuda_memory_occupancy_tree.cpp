@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_occupancy_tree.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace ov {
+namespace nvidia_gpu {
+
+OccupancyTree::OccupancyTree(int timeDuration) : time_duration_{std::max(timeDuration, 1)} {
+    std::size_t leaves = 1;
+    while (leaves < static_cast<std::size_t>(time_duration_)) leaves <<= 1;
+    nodes_.resize(2 * leaves);
+}
+
+void OccupancyTree::insert(int start, int finish, int64_t offset, int64_t size) {
+    if (size <= 0) return;
+    insert(1, 0, time_duration_, start, finish + 1, offset, size);
+}
+
+int64_t OccupancyTree::lowestFreeOffset(int start, int finish, int64_t size) const {
+    if (size <= 0) return 0;
+    std::vector<const RangeMap*> maps;
+    collect(1, 0, time_duration_, start, finish + 1, maps);
+
+    // Jump over occupied ranges until every map agrees that memory is free.
+    // Jumps never skip a free position, so the result is the lowest one.
+    int64_t offset = 0;
+    std::size_t agreed = 0;
+    std::size_t i = 0;
+    while (agreed < maps.size()) {
+        int64_t conflictEnd = 0;
+        if (findConflict(*maps[i], offset, size, conflictEnd)) {
+            offset = conflictEnd;
+            agreed = 0;
+            continue;
+        }
+        agreed++;
+        i = (i + 1) % maps.size();
+    }
+    return offset;
+}
+
+void OccupancyTree::insertRange(RangeMap& map, int64_t begin, int64_t end) {
+    auto it = map.upper_bound(begin);
+    if (it != map.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second >= begin) {
+            begin = prev->first;
+            end = std::max(end, prev->second);
+            it = map.erase(prev);
+        }
+    }
+    while (it != map.end() && it->first <= end) {
+        end = std::max(end, it->second);
+        it = map.erase(it);
+    }
+    map.emplace_hint(it, begin, end);
+}
+
+bool OccupancyTree::findConflict(const RangeMap& map, int64_t offset, int64_t size, int64_t& conflictEnd) {
+    auto it = map.upper_bound(offset);
+    if (it != map.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second > offset) {
+            conflictEnd = prev->second;
+            return true;
+        }
+    }
+    if (it != map.end() && it->first < offset + size) {
+        conflictEnd = it->second;
+        return true;
+    }
+    return false;
+}
+
+void OccupancyTree::insert(std::size_t node, int lo, int hi, int start, int finish, int64_t offset, int64_t size) {
+    if (finish <= lo || hi <= start) return;
+    insertRange(nodes_[node].subtree, offset, offset + size);
+    if (start <= lo && hi <= finish) {
+        insertRange(nodes_[node].own, offset, offset + size);
+        return;
+    }
+    const int mid = lo + (hi - lo + 1) / 2;
+    insert(2 * node, lo, mid, start, finish, offset, size);
+    insert(2 * node + 1, mid, hi, start, finish, offset, size);
+}
+
+void OccupancyTree::collect(
+    std::size_t node, int lo, int hi, int start, int finish, std::vector<const RangeMap*>& maps) const {
+    if (finish <= lo || hi <= start) return;
+    if (start <= lo && hi <= finish) {
+        if (!nodes_[node].subtree.empty()) maps.push_back(&nodes_[node].subtree);
+        return;
+    }
+    if (!nodes_[node].own.empty()) maps.push_back(&nodes_[node].own);
+    const int mid = lo + (hi - lo + 1) / 2;
+    collect(2 * node, lo, mid, start, finish, maps);
+    collect(2 * node + 1, mid, hi, start, finish, maps);
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
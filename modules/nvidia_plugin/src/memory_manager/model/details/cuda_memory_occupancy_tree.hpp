@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Keeps track of memory occupied by placed boxes over execution order time.
+ *
+ * It is a segment tree over time slots. Every tree node holds two maps of
+ * occupied memory keyed by offset, where touching and overlapping ranges are
+ * merged together:
+ * - "own" map has boxes which lifespan covers the whole node range
+ *   (canonical decomposition of the box lifespan);
+ * - "subtree" map has all boxes stored in the node and in its descendants.
+ *
+ * Boxes which are alive at any time slot of [start, finish] are exactly boxes
+ * from "subtree" maps of the canonical nodes of [start, finish] and from "own"
+ * maps of their ancestors. So a query has to deal with O(log T) maps only,
+ * no matter how many boxes are alive at the same time.
+ */
+class OccupancyTree {
+public:
+    /**
+     * @param [in] timeDuration Number of time slots
+     */
+    explicit OccupancyTree(int timeDuration);
+
+    /**
+     * Marks memory [offset, offset + size) as occupied for time slots [start, finish]
+     */
+    void insert(int start, int finish, int64_t offset, int64_t size);
+
+    /**
+     * @returns The lowest offset where memory of the given size is free for all
+     * time slots [start, finish]
+     */
+    int64_t lowestFreeOffset(int start, int finish, int64_t size) const;
+
+private:
+    using RangeMap = std::map<int64_t, int64_t>;
+
+    struct Node {
+        RangeMap own;
+        RangeMap subtree;
+    };
+
+    static void insertRange(RangeMap& map, int64_t begin, int64_t end);
+    static bool findConflict(const RangeMap& map, int64_t offset, int64_t size, int64_t& conflictEnd);
+
+    void insert(std::size_t node, int lo, int hi, int start, int finish, int64_t offset, int64_t size);
+    void collect(std::size_t node, int lo, int hi, int start, int finish, std::vector<const RangeMap*>& maps) const;
+
+    int time_duration_;
+    std::vector<Node> nodes_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
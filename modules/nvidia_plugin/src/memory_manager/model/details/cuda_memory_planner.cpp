@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_planner.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "cuda_memory_interval_tree.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+using Box = MemoryPlanner::Box;
+
+/**
+ * Replaces "till to end" finish (-1) with the last time slot
+ */
+std::vector<Box> normalizeBoxes(const std::vector<Box>& boxes) {
+    int max_ts = 0;
+    for (const Box& box : boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
+    std::vector<Box> result{boxes};
+    for (Box& box : result)
+        if (box.finish == -1) box.finish = max_ts;
+    return result;
+}
+
+std::vector<TimeIntervalTree::Interval> lifespans(const std::vector<Box>& boxes) {
+    std::vector<TimeIntervalTree::Interval> result;
+    result.reserve(boxes.size());
+    for (const Box& box : boxes) result.push_back({box.start, box.finish});
+    return result;
+}
+
+/**
+ * Places boxes one by one and keeps track of already placed ones
+ */
+class BoxPlacer {
+public:
+    explicit BoxPlacer(const std::vector<Box>& boxes)
+        : boxes_{boxes}, offsets_(boxes.size(), -1), placed_{lifespans(boxes)} {}
+
+    /**
+     * Places box into the smallest (best-fit) or the lowest (first-fit) gap
+     * between boxes which are alive at the same time.
+     * @returns Offset of the box
+     */
+    int64_t place(std::size_t index, bool bestFit) {
+        const Box& box = boxes_[index];
+        alive_.clear();
+        placed_.query(box.start, box.finish, alive_);
+
+        occupied_.clear();
+        for (auto i : alive_) occupied_.emplace_back(offsets_[i], offsets_[i] + boxes_[i].size);
+        std::sort(occupied_.begin(), occupied_.end());
+
+        int64_t offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& [begin, end] : occupied_) {
+            const int64_t gap = begin - top;
+            if (gap >= box.size && gap < best_gap) {
+                offset = top;
+                best_gap = gap;
+                if (!bestFit) break;
+            }
+            top = std::max(top, end);
+        }
+        if (offset == -1) offset = top;
+
+        offsets_[index] = offset;
+        placed_.insert(index);
+        blob_size_ = std::max(blob_size_, offset + box.size);
+        return offset;
+    }
+
+    int64_t blobSize() const { return blob_size_; }
+
+    void exportOffsets(MemoryPlanner::Offsets& offsets) const {
+        for (std::size_t i = 0; i < boxes_.size(); ++i) offsets[boxes_[i].id] = offsets_[i];
+    }
+
+private:
+    const std::vector<Box>& boxes_;
+    std::vector<int64_t> offsets_;
+    TimeIntervalTree placed_;
+    int64_t blob_size_ = 0;
+    std::vector<std::size_t> alive_;
+    std::vector<std::pair<int64_t, int64_t>> occupied_;
+};
+
+/**
+ * @returns Total size of boxes alive at each time slot
+ */
+std::vector<int64_t> breadthPerTimeSlot(const std::vector<Box>& boxes) {
+    int max_ts = 0;
+    for (const Box& box : boxes) max_ts = std::max(max_ts, box.finish);
+    std::vector<int64_t> breadth(max_ts + 2, 0);
+    for (const Box& box : boxes) {
+        breadth[box.start] += box.size;
+        breadth[box.finish + 1] -= box.size;
+    }
+    std::partial_sum(breadth.begin(), breadth.end(), breadth.begin());
+    breadth.pop_back();
+    return breadth;
+}
+
+/**
+ * Simple recursive search used by BranchAndBoundPlanner
+ */
+class BranchAndBoundSearch {
+public:
+    BranchAndBoundSearch(const std::vector<Box>& boxes, int64_t lowerBound, std::size_t maxSteps)
+        : boxes_{boxes}, offsets_(boxes.size(), -1), lower_bound_{lowerBound}, steps_left_{maxSteps} {}
+
+    /**
+     * @param [in] bestSize Size of a known placement, the search looks for a better one only
+     * @returns true if a placement better than bestSize was found
+     */
+    bool run(int64_t bestSize) {
+        best_size_ = bestSize;
+        search(0, 0);
+        return !best_offsets_.empty();
+    }
+
+    int64_t bestSize() const { return best_size_; }
+
+    void exportOffsets(MemoryPlanner::Offsets& offsets) const {
+        for (std::size_t i = 0; i < boxes_.size(); ++i) offsets[boxes_[i].id] = best_offsets_[i];
+    }
+
+private:
+    bool overlapInTime(const Box& l, const Box& r) const { return l.start <= r.finish && r.start <= l.finish; }
+
+    int64_t firstFitOffset(std::size_t index) const {
+        const Box& box = boxes_[index];
+        std::vector<std::pair<int64_t, int64_t>> occupied;
+        for (std::size_t i = 0; i < boxes_.size(); ++i) {
+            if (offsets_[i] != -1 && overlapInTime(box, boxes_[i])) {
+                occupied.emplace_back(offsets_[i], offsets_[i] + boxes_[i].size);
+            }
+        }
+        std::sort(occupied.begin(), occupied.end());
+        int64_t top = 0;
+        for (const auto& [begin, end] : occupied) {
+            if (begin - top >= box.size) break;
+            top = std::max(top, end);
+        }
+        return top;
+    }
+
+    void search(std::size_t numPlaced, int64_t blobSize) {
+        if (best_size_ == lower_bound_ || steps_left_ == 0) return;
+        --steps_left_;
+        if (numPlaced == boxes_.size()) {
+            best_size_ = blobSize;
+            best_offsets_ = offsets_;
+            return;
+        }
+        for (std::size_t i = 0; i < boxes_.size(); ++i) {
+            if (offsets_[i] != -1) continue;
+            const int64_t offset = firstFitOffset(i);
+            const int64_t newBlobSize = std::max(blobSize, offset + boxes_[i].size);
+            if (std::max(newBlobSize, lower_bound_) >= best_size_) continue;
+            offsets_[i] = offset;
+            search(numPlaced + 1, newBlobSize);
+            offsets_[i] = -1;
+        }
+    }
+
+    const std::vector<Box>& boxes_;
+    std::vector<int64_t> offsets_;
+    std::vector<int64_t> best_offsets_;
+    const int64_t lower_bound_;
+    int64_t best_size_ = 0;
+    std::size_t steps_left_;
+};
+
+}  // namespace
+
+int64_t GreedyBySizePlanner::plan(const std::vector<Box>& boxes, Offsets& offsets) const {
+    MemorySolver solver{boxes};
+    const int64_t blobSize = solver.solve();
+    for (const Box& box : boxes) offsets[box.id] = solver.getOffset(box.id);
+    return blobSize;
+}
+
+int64_t GreedyByBreadthPlanner::plan(const std::vector<Box>& boxes, Offsets& offsets) const {
+    const auto normalized = normalizeBoxes(boxes);
+    const auto breadth = breadthPerTimeSlot(normalized);
+
+    std::vector<int> slots(breadth.size());
+    std::iota(slots.begin(), slots.end(), 0);
+    std::stable_sort(slots.begin(), slots.end(), [&breadth](int l, int r) { return breadth[l] > breadth[r]; });
+
+    // Keeps boxes which are not placed yet
+    TimeIntervalTree unplaced{lifespans(normalized)};
+    for (std::size_t i = 0; i < normalized.size(); ++i) unplaced.insert(i);
+
+    BoxPlacer placer{normalized};
+    std::vector<std::size_t> alive;
+    for (int slot : slots) {
+        alive.clear();
+        unplaced.query(slot, slot, alive);
+        std::stable_sort(alive.begin(), alive.end(), [&normalized](std::size_t l, std::size_t r) {
+            return normalized[l].size > normalized[r].size;
+        });
+        for (auto i : alive) {
+            unplaced.erase(i);
+            placer.place(i, true);
+        }
+    }
+    placer.exportOffsets(offsets);
+    return placer.blobSize();
+}
+
+int64_t BestFitPlanner::plan(const std::vector<Box>& boxes, Offsets& offsets) const {
+    const auto normalized = normalizeBoxes(boxes);
+    std::vector<std::size_t> order(normalized.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&normalized](std::size_t l, std::size_t r) {
+        const Box& lb = normalized[l];
+        const Box& rb = normalized[r];
+        if (lb.size != rb.size) return lb.size > rb.size;
+        return (lb.finish - lb.start) > (rb.finish - rb.start);
+    });
+
+    BoxPlacer placer{normalized};
+    for (auto i : order) placer.place(i, true);
+    placer.exportOffsets(offsets);
+    return placer.blobSize();
+}
+
+int64_t BranchAndBoundPlanner::plan(const std::vector<Box>& boxes, Offsets& offsets) const {
+    if (boxes.size() > max_boxes_) return -1;
+    const auto normalized = normalizeBoxes(boxes);
+
+    // Start from a heuristic solution, so the search has a bound from the very beginning
+    const int64_t initialSize = BestFitPlanner{}.plan(boxes, offsets);
+    const auto breadth = breadthPerTimeSlot(normalized);
+    const int64_t lowerBound = breadth.empty() ? 0 : *std::max_element(breadth.begin(), breadth.end());
+
+    BranchAndBoundSearch search{normalized, lowerBound, max_steps_};
+    if (!search.run(initialSize)) return initialSize;
+    search.exportOffsets(offsets);
+    return search.bestSize();
+}
+
+std::vector<MemoryPlanner::Ptr> defaultMemoryPlanners() { return {std::make_shared<GreedyBySizePlanner>()}; }
+
+std::vector<MemoryPlanner::Ptr> allMemoryPlanners() {
+    return {std::make_shared<GreedyBySizePlanner>(),
+            std::make_shared<GreedyByBreadthPlanner>(),
+            std::make_shared<BestFitPlanner>(),
+            std::make_shared<BranchAndBoundPlanner>()};
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
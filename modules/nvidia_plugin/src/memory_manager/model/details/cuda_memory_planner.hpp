@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides declarations of memory planning strategies
+ * used by MemoryModelBuilder
+ * @file
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cuda_memory_solver.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Interface of a memory planning strategy.
+ *
+ * Planner receives the same abstract boxes as MemorySolver and places
+ * them on the Mem axis so that boxes alive at the same time do not intersect.
+ * Different planners use different heuristics, none of them is optimal for
+ * every graph, so MemoryModelBuilder may run several of them and keep the best.
+ */
+class MemoryPlanner {
+public:
+    using Box = MemorySolver::Box;
+    using Offsets = std::unordered_map<int64_t, int64_t>;
+    using Ptr = std::shared_ptr<const MemoryPlanner>;
+
+    virtual ~MemoryPlanner() = default;
+
+    /**
+     * @returns Human readable name of the strategy
+     */
+    virtual std::string name() const = 0;
+
+    /**
+     * Places the given boxes.
+     * @param [in] boxes Boxes to place. Box::finish == -1 means "till to end".
+     * @param [out] offsets Calculated offsets keyed by Box::id
+     * @returns Size of common memory blob required for storing all boxes,
+     * or -1 if planner gave up (e.g. graph is too big for it)
+     */
+    virtual int64_t plan(const std::vector<Box>& boxes, Offsets& offsets) const = 0;
+};
+
+/**
+ * Original MemorySolver heuristic: boxes are placed from the biggest one to
+ * the smallest one at the lowest offset which doesn't intersect already
+ * placed boxes.
+ */
+class GreedyBySizePlanner final : public MemoryPlanner {
+public:
+    std::string name() const override { return "GreedyBySize"; }
+    int64_t plan(const std::vector<Box>& boxes, Offsets& offsets) const override;
+};
+
+/**
+ * Boxes are processed time slot by time slot, starting from the slot with
+ * the largest total size of alive boxes (breadth). Within a slot the biggest
+ * boxes go first. Each box is placed into the smallest gap it fits in.
+ */
+class GreedyByBreadthPlanner final : public MemoryPlanner {
+public:
+    std::string name() const override { return "GreedyByBreadth"; }
+    int64_t plan(const std::vector<Box>& boxes, Offsets& offsets) const override;
+};
+
+/**
+ * Boxes are processed from the biggest one to the smallest one (the longest
+ * one first for equal sizes). Each box is placed into the smallest gap it
+ * fits in among the boxes alive at the same time, which are found with
+ * TimeIntervalTree.
+ */
+class BestFitPlanner final : public MemoryPlanner {
+public:
+    std::string name() const override { return "BestFit"; }
+    int64_t plan(const std::vector<Box>& boxes, Offsets& offsets) const override;
+};
+
+/**
+ * Exhaustive search over placement orders with first-fit placement, pruned by
+ * the best blob size found so far. Any placement can be pushed down to a
+ * first-fit placement for some order, so the search is exact if it is not
+ * interrupted. The search is bounded both by the number of boxes and by the
+ * number of visited search nodes, the planner gives up on bigger graphs.
+ */
+class BranchAndBoundPlanner final : public MemoryPlanner {
+public:
+    static constexpr std::size_t kDefaultMaxBoxes = 12;
+    static constexpr std::size_t kDefaultMaxSteps = 200000;
+
+    explicit BranchAndBoundPlanner(std::size_t maxBoxes = kDefaultMaxBoxes, std::size_t maxSteps = kDefaultMaxSteps)
+        : max_boxes_{maxBoxes}, max_steps_{maxSteps} {}
+
+    std::string name() const override { return "BranchAndBound"; }
+    int64_t plan(const std::vector<Box>& boxes, Offsets& offsets) const override;
+
+private:
+    std::size_t max_boxes_;
+    std::size_t max_steps_;
+};
+
+/**
+ * @returns Planners used by MemoryModelBuilder by default, GreedyBySizePlanner only.
+ * The other planners take several times longer on big graphs, so they are opt-in.
+ */
+std::vector<MemoryPlanner::Ptr> defaultMemoryPlanners();
+
+/**
+ * @returns All planners, used with NVIDIA_MEMORY_PLANNING_BEST
+ */
+std::vector<MemoryPlanner::Ptr> allMemoryPlanners();
+
+}  // namespace nvidia_gpu
+}  // namespace ov
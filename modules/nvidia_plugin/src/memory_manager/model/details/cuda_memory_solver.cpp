@@ -10,6 +10,8 @@
 #include <map>
 #include <vector>
 
+#include "cuda_memory_occupancy_tree.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -63,7 +65,17 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+int64_t MemorySolver::solve(Backend backend) {
+    switch (backend) {
+        case Backend::TimeSlots:
+            return solveWithTimeSlots();
+        case Backend::OccupancyTree:
+            return solveWithOccupancyTree();
+    }
+    throwIEException("Unknown MemorySolver backend");
+}
+
+int64_t MemorySolver::solveWithTimeSlots() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box *>> time_slots(_time_duration);
     for (auto &slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
@@ -101,6 +113,26 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveWithOccupancyTree() {
+    maxTopDepth();  // depth is calculated for boxes sorted by box.start, so do it before sorting by size
+
+    // The same order of box putting as in solveWithTimeSlots()
+    std::sort(_boxes.begin(), _boxes.end(), [](const Box &l, const Box &r) { return l.size > r.size; });
+
+    // Lifting the box up in solveWithTimeSlots() stops at the lowest position where it
+    // doesn't intersect anything, so it is enough to find the lowest free offset
+    OccupancyTree occupancy{_time_duration};
+    int64_t _min_required = 0;
+    for (const Box &box : _boxes) {
+        const int64_t offset = occupancy.lowestFreeOffset(box.start, box.finish, box.size);
+        occupancy.insert(box.start, box.finish, offset, box.size);
+        _min_required = std::max(_min_required, offset + box.size);
+        _offsets[box.id] = offset;
+    }
+
+    return _min_required;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
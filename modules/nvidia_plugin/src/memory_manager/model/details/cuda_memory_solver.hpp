@@ -66,13 +66,31 @@ public:
         int64_t id;
     };
 
+    /**
+     * @brief Algorithm used to find intersections with already placed boxes.
+     * Both backends produce exactly the same offsets.
+     */
+    enum class Backend {
+        /**
+         * Keeps placed boxes in per time slot lists and lifts the new box up
+         * while it intersects anything. O(N^2 * lifespan) in the worst case.
+         */
+        TimeSlots,
+        /**
+         * Keeps placed boxes in OccupancyTree and looks for the lowest free
+         * offset in O(log T) merged offset maps.
+         */
+        OccupancyTree,
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param [in] backend Algorithm to use
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Backend backend = Backend::OccupancyTree);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
@@ -90,6 +108,8 @@ private:
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveWithTimeSlots();
+    int64_t solveWithOccupancyTree();
 };
 
 }  // namespace nvidia_gpu
@@ -7,6 +7,7 @@
 
 #include <cuda_operation_registry.hpp>
 #include <openvino/op/util/attr_types.hpp>
+#include <utility>
 
 #include "converters.hpp"
 #include "cuda/constant_factory.hpp"
@@ -147,8 +148,16 @@ void CuDnnTensorOpBase::Execute(const InferenceRequestContext& context,
                                 const Workbuffers&) const {
     Expects(inputTensors.size() == 2);
     Expects(outputTensors.size() == 1);
-    const auto& bias_input = bias_index_ == 0 ? in0 : in1;
-    const auto& dest_input = bias_index_ == 0 ? in1 : in0;
+    auto bias_index = bias_index_;
+    auto dest_index = dest_index_;
+    // cudnnOpTensor supports in-place operation only if C is A. An in-place capable operation may share
+    // the output buffer with any input of the output shape, so the operands are swapped if C is B.
+    // B is never broadcast then, and the operations are commutative.
+    if (inputTensors[bias_index].get() == outputTensors[0].get()) {
+        std::swap(bias_index, dest_index);
+    }
+    const auto& bias_input = bias_index == 0 ? in0 : in1;
+    const auto& dest_input = bias_index == 0 ? in1 : in0;
 
     const void* alpha1 = &CUDA::NumericConst<CUDA::constants::one>(out.type_);
     const void* alpha2 = &CUDA::NumericConst<CUDA::constants::one>(out.type_);
@@ -157,10 +166,10 @@ void CuDnnTensorOpBase::Execute(const InferenceRequestContext& context,
     context.getThreadContext().dnnHandle().opTensor(op_desc_,
                                                     alpha1,
                                                     dest_input.desc_,
-                                                    inputTensors[dest_index_].get(),
+                                                    inputTensors[dest_index].get(),
                                                     alpha2,
                                                     bias_input.desc_,
-                                                    inputTensors[bias_index_].get(),
+                                                    inputTensors[bias_index].get(),
                                                     beta,
                                                     out.desc_,
                                                     outputTensors[0].get());
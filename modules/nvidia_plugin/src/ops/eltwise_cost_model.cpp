@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "eltwise_cost_model.hpp"
+
+#include <openvino/core/shape.hpp>
+
+namespace ov::nvidia_gpu::EltwiseCostModel {
+
+namespace {
+
+// Nominal values, they are not measured on any particular device:
+// - launch overheads are of the order of microseconds which host API calls take, cuDNN calls are
+//   assumed slower as they set up descriptors and may launch more than one kernel;
+// - 400 bytes/ns is device memory bandwidth of a mid-range data center GPU, of which simple
+//   kernels achieve most;
+// - index mapping is a few integer divisions per output element and broadcasted dimension.
+// The model is used only if NVIDIA_OPERATION_COST_MODEL is enabled until it is calibrated.
+constexpr double kCudaLaunchNs = 4000.0;
+constexpr double kCuDnnLaunchNs = 7000.0;
+constexpr double kBytesPerNs = 400.0;
+constexpr double kCudaBandwidthEfficiency = 0.8;
+constexpr double kCuDnnBandwidthEfficiency = 0.9;
+constexpr double kIndexMappingNs = 0.004;
+
+double transferredBytes(const ov::Node& node) {
+    double bytes = 0.0;
+    for (const auto& input : node.inputs()) {
+        bytes += static_cast<double>(ov::shape_size(input.get_shape()) * input.get_element_type().size());
+    }
+    for (const auto& output : node.outputs()) {
+        bytes += static_cast<double>(ov::shape_size(output.get_shape()) * output.get_element_type().size());
+    }
+    return bytes;
+}
+
+}  // namespace
+
+double cudaKernel(const ov::Node& node) {
+    const auto& outShape = node.get_output_shape(0);
+    std::size_t mappedDims = 0;
+    for (const auto& input : node.inputs()) {
+        if (input.get_shape() != outShape) {
+            mappedDims += outShape.size();
+        }
+    }
+    const auto outElements = static_cast<double>(ov::shape_size(outShape));
+    return kCudaLaunchNs + transferredBytes(node) / (kBytesPerNs * kCudaBandwidthEfficiency) +
+           outElements * mappedDims * kIndexMappingNs;
+}
+
+double cudnn(const ov::Node& node) {
+    return kCuDnnLaunchNs + transferredBytes(node) / (kBytesPerNs * kCuDnnBandwidthEfficiency);
+}
+
+}  // namespace ov::nvidia_gpu::EltwiseCostModel
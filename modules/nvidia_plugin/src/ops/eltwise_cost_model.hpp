@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+
+namespace ov::nvidia_gpu::EltwiseCostModel {
+
+/**
+ * @brief Host-side estimates of execution time of elementwise operations in nanoseconds, which
+ * OperationRegistry uses to rank implementations of an operation.
+ *
+ * An estimate is a fixed launch overhead plus time of moving inputs and outputs through device
+ * memory at the bandwidth an implementation achieves. Plugin CUDA kernels launch faster than
+ * cuDNN calls, but map output indices to indices of every broadcasted input, which cuDNN does
+ * with zero strides. So CUDA kernels win for small tensors and cuDNN for large or broadcasted ones.
+ * Constants are nominal and not calibrated, so the model is used only if NVIDIA_OPERATION_COST_MODEL
+ * is enabled: only the ratio of estimates matters.
+ */
+double cudaKernel(const ov::Node& node);
+
+/**
+ * @brief Estimate for implementations based on cudnnOpTensor and cudnnActivationForward
+ */
+double cudnn(const ov::Node& node);
+
+}  // namespace ov::nvidia_gpu::EltwiseCostModel
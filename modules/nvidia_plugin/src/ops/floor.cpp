@@ -43,6 +43,7 @@ void FloorOp::Execute(const InferenceRequestContext& context,
 }
 
 OPERATION_REGISTER(FloorOp, Floor);
+OPERATION_REGISTER_IN_PLACE(Floor);
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -0,0 +1,119 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_eltwise.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+kernel::FusedEltwise::Opcode convertOpcode(const nodes::EltwiseOpcode opcode) {
+    using Opcode = kernel::FusedEltwise::Opcode;
+    switch (opcode) {
+        case nodes::EltwiseOpcode::ADD:
+            return Opcode::Add;
+        case nodes::EltwiseOpcode::SUBTRACT:
+            return Opcode::Subtract;
+        case nodes::EltwiseOpcode::MULTIPLY:
+            return Opcode::Multiply;
+        case nodes::EltwiseOpcode::DIVIDE:
+            return Opcode::Divide;
+        case nodes::EltwiseOpcode::MAXIMUM:
+            return Opcode::Maximum;
+        case nodes::EltwiseOpcode::MINIMUM:
+            return Opcode::Minimum;
+        case nodes::EltwiseOpcode::SQUARED_DIFFERENCE:
+            return Opcode::SquaredDifference;
+        case nodes::EltwiseOpcode::POWER:
+            return Opcode::Power;
+        case nodes::EltwiseOpcode::SIGMOID:
+            return Opcode::Sigmoid;
+        case nodes::EltwiseOpcode::RELU:
+            return Opcode::Relu;
+        case nodes::EltwiseOpcode::TANH:
+            return Opcode::Tanh;
+        case nodes::EltwiseOpcode::EXP:
+            return Opcode::Exp;
+        case nodes::EltwiseOpcode::ABS:
+            return Opcode::Abs;
+        case nodes::EltwiseOpcode::NEGATIVE:
+            return Opcode::Negative;
+        case nodes::EltwiseOpcode::SQRT:
+            return Opcode::Sqrt;
+        case nodes::EltwiseOpcode::SWISH:
+            return Opcode::Swish;
+    }
+    throwIEException(fmt::format("FusedEltwiseOp: unsupported opcode {}", static_cast<int>(opcode)));
+}
+
+}  // namespace
+
+FusedEltwiseOp::FusedEltwiseOp(const CreationContext& context,
+                               const NodeOp& node,
+                               IndexCollection&& inputIds,
+                               IndexCollection&& outputIds)
+    : OperationBase{context, node, std::move(inputIds), std::move(outputIds)} {
+    Expects(node.get_output_size() == 1);
+    const auto& program = node.get_program();
+    if (node.get_input_size() > kernel::FusedEltwise::kMaxInputs ||
+        program.size() > kernel::FusedEltwise::kMaxInstructions) {
+        throwIEException(fmt::format("FusedEltwiseOp: {} inputs and {} instructions exceed the limits",
+                                     node.get_input_size(),
+                                     program.size()));
+    }
+    const auto& output_shape = node.get_output_shape(0);
+    for (std::size_t i = 0; i < node.get_input_size(); ++i) {
+        broadcast_params_.push_back(NumpyBroadcastParams::create(node.get_input_shape(i), output_shape));
+        broadcast_params_.back()->addWorkbufferRequests(immutable_buffer_sizes_);
+    }
+
+    kernel::FusedEltwise::Program kernel_program{};
+    kernel_program.num_inputs = node.get_input_size();
+    kernel_program.num_instructions = program.size();
+    for (std::size_t i = 0; i < program.size(); ++i) {
+        kernel_program.instructions[i] = {convertOpcode(program[i].opcode),
+                                          static_cast<std::uint8_t>(program[i].lhs),
+                                          static_cast<std::uint8_t>(program[i].rhs)};
+    }
+    const size_t max_threads_per_block = context.device().props().maxThreadsPerBlock;
+    kernel_ = kernel::FusedEltwise{convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_output_element_type(0)),
+                                   kernel_program,
+                                   ov::shape_size(output_shape),
+                                   max_threads_per_block};
+}
+
+void FusedEltwiseOp::Execute(const InferenceRequestContext& context,
+                             Inputs inputTensors,
+                             Outputs outputTensors,
+                             const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputTensors.size() == broadcast_params_.size());
+    Expects(outputTensors.size() == 1);
+    kernel::FusedEltwise::Inputs inputs{};
+    for (std::size_t i = 0; i < inputTensors.size(); ++i) {
+        inputs.data[i] = inputTensors[i].get();
+        inputs.mappers[i] = broadcast_params_[i]->mapper(workbuffers.immutable_buffers);
+    }
+    (*kernel_)(context.getThreadContext().stream().get(), inputs, outputTensors[0].get());
+}
+
+void FusedEltwiseOp::InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) {
+    for (const auto& params : broadcast_params_) {
+        params->initWorkbuffers(buffers);
+    }
+}
+
+WorkbufferRequest FusedEltwiseOp::GetWorkBufferRequest() const { return {immutable_buffer_sizes_, {}}; }
+
+OPERATION_REGISTER(FusedEltwiseOp, FusedEltwise);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,42 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <memory>
+#include <optional>
+#include <transformer/nodes/fused_eltwise.hpp>
+#include <vector>
+
+#include "components/numpy_broadcast_params.h"
+#include "kernels/fused_eltwise.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class FusedEltwiseOp : public OperationBase {
+public:
+    using NodeOp = nodes::FusedEltwise;
+    FusedEltwiseOp(const CreationContext& context,
+                   const NodeOp& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    void InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::vector<WorkbufferRequest::size_in_bytes_t> immutable_buffer_sizes_;
+    std::vector<std::unique_ptr<NumpyBroadcastParams>> broadcast_params_;
+    std::optional<kernel::FusedEltwise> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -14,6 +14,9 @@ OPERATION_REGISTER(NopOp, Reshape);
 OPERATION_REGISTER(NopOp, Squeeze);
 OPERATION_REGISTER(NopOp, Unsqueeze);
 OPERATION_REGISTER(NopOp, ConcatOptimized);
+OPERATION_REGISTER(NopOp, SplitOptimized);
+OPERATION_REGISTER(NopOp, VariadicSplitOptimized);
+OPERATION_REGISTER(NopOp, StridedSliceOptimized);
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -17,5 +17,6 @@ ReluOp::ReluOp(const CreationContext& context,
           std::make_unique<CUDA::ReluDescriptor>(), context, *node, move(inputIds), move(outputIds)} {}
 
 OPERATION_REGISTER(ReluOp, Relu);
+OPERATION_REGISTER_IN_PLACE(Relu);
 }  // namespace nvidia_gpu
 }  // namespace ov
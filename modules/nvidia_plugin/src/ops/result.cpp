@@ -76,15 +76,15 @@ std::optional<std::string> ResultOp::GetFusedOutputTensorName(const ov::Node::RT
 std::optional<std::size_t> ResultOp::GetOutputTensorSubIndex(const ov::Output<ov::Node>& node) {
     const auto& opRegistry = OperationRegistry::getInstance();
     const auto& opType = opRegistry.getOperationType(node.get_node()->shared_from_this());
-    if (opType && std::type_index(typeid(NopOp)) == opType.value()) {
+    if (node.get_node()->get_output_size() > 1) {
+        return node.get_index();
+    } else if (opType && std::type_index(typeid(NopOp)) == opType.value()) {
         for (const auto& in : node.get_node()->input_values()) {
             const auto& idx = GetOutputTensorSubIndex(in);
             if (idx) {
                 return idx;
             }
         }
-    } else if (node.get_node()->get_output_size() > 1) {
-        return node.get_index();
     }
 
     return std::nullopt;
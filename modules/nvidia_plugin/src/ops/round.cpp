@@ -49,6 +49,7 @@ void RoundOp::Execute(const InferenceRequestContext& context,
 }
 
 OPERATION_REGISTER(RoundOp, Round);
+OPERATION_REGISTER_IN_PLACE(Round);
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -17,5 +17,6 @@ SigmoidOp::SigmoidOp(const CreationContext& context,
           std::make_unique<CUDA::SigmoidDescriptor>(), context, *node, move(inputIds), move(outputIds)} {}
 
 OPERATION_REGISTER(SigmoidOp, Sigmoid);
+OPERATION_REGISTER_IN_PLACE(Sigmoid);
 }  // namespace nvidia_gpu
 }  // namespace ov
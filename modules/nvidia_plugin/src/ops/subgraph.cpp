@@ -6,13 +6,19 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_operation_registry.hpp>
 #include <cuda_profiler.hpp>
+#include <exec_graph_info.hpp>
 #include <ngraph/function.hpp>
+#include <openvino/op/constant.hpp>
 #include <openvino/op/parameter.hpp>
 #include <openvino/op/result.hpp>
 #include <openvino/op/tensor_iterator.hpp>
+#include <optional>
+#include <transformer/cuda_rt_info.hpp>
+#include <unordered_set>
 
 #include "nop_op.hpp"
 #include "parameter.hpp"
@@ -21,21 +27,63 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * Collects regions of mutable buffers which are read and written by the operation of the node
+ */
+StreamSchedule::StepAccesses getStepAccesses(const ov::Node& node,
+                                             const MemoryPlan::Node& planNode,
+                                             const std::unordered_set<BufferID>& mutableBuffers) {
+    StreamSchedule::StepAccesses accesses;
+    const auto addAccess = [&](std::vector<StreamSchedule::Access>& regions,
+                               const MemoryPlan::Tensor& tensor,
+                               std::size_t size) {
+        if (mutableBuffers.count(tensor.buffer) > 0) {
+            regions.push_back({tensor.buffer, tensor.offset, size});
+        }
+    };
+    for (std::size_t i = 0; i < std::min(planNode.inputs.size(), node.get_input_size()); ++i) {
+        addAccess(accesses.reads, planNode.inputs[i], OperationBuffersExtractor::GetTensorByteSize(node.input(i)));
+    }
+    for (std::size_t i = 0; i < std::min(planNode.outputs.size(), node.get_output_size()); ++i) {
+        addAccess(accesses.writes, planNode.outputs[i], OperationBuffersExtractor::GetTensorByteSize(node.output(i)));
+    }
+    const auto& mutableIds = planNode.workbufferIds.mutableIds;
+    for (std::size_t i = 0; i < std::min(mutableIds.size(), planNode.workbufferRequest.mutable_sizes.size()); ++i) {
+        accesses.writes.push_back({mutableIds[i], 0, planNode.workbufferRequest.mutable_sizes[i]});
+    }
+    return accesses;
+}
+
+}  // namespace
+
 SubGraph::SubGraph(const CreationContext& context,
                    const SubGraphOp& op,
                    IndexCollection&& inputIds,
                    IndexCollection&& outputIds)
     : OperationBase(context, op, std::move(inputIds), std::move(outputIds)), function_{op.get_function()} {
     const bool isStableParamsAndResultsNeeded = nullptr != dynamic_cast<const ov::op::v0::TensorIterator*>(&op);
-    initExecuteSequence(context, isStableParamsAndResultsNeeded, isStableParamsAndResultsNeeded);
+    initExecuteSequence(context, isStableParamsAndResultsNeeded, isStableParamsAndResultsNeeded, 1);
 }
 
 SubGraph::SubGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function)
     : OperationBase(context, nullptr), function_{function} {
-    initExecuteSequence(context, false, false);
+    initExecuteSequence(context, false, false, context.streamsPerInferRequest());
 }
 
-void SubGraph::initExecuteSequence(const CreationContext& context, bool isStableParams, bool isStableResults) {
+SubGraph::SubGraph(const CreationContext& context,
+                   const std::shared_ptr<const ngraph::Function>& function,
+                   const MemoryPlan& memoryPlan)
+    : OperationBase(context, nullptr), function_{function} {
+    initExecuteSequence(context, false, false, context.streamsPerInferRequest(), &memoryPlan);
+}
+
+void SubGraph::initExecuteSequence(const CreationContext& context,
+                                   bool isStableParams,
+                                   bool isStableResults,
+                                   std::size_t maxStreams,
+                                   const MemoryPlan* memoryPlan) {
     static constexpr auto InitNeeded = IOperationExec::WorkbufferStatus::InitNeeded;
 
     if (!function_) {
@@ -44,7 +92,29 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
     const auto& orderedNodes = function_->get_ordered_ops();
 
     std::vector<Ptr> init_sequence{};
-    OperationBuffersExtractor opBuffersExtractor{orderedNodes, isStableParams, isStableResults};
+    std::optional<OperationBuffersExtractor> opBuffersExtractor;
+    if (memoryPlan) {
+        if (memoryPlan->nodes.size() != orderedNodes.size()) {
+            throwIEException(fmt::format("Memory plan has {} nodes, but graph has {} nodes",
+                                         memoryPlan->nodes.size(),
+                                         orderedNodes.size()));
+        }
+        // Lifespans of mutable buffers in the plan are valid for its number of streams only
+        if (memoryPlan->streams != maxStreams) {
+            throwIEException(fmt::format("Memory plan is made for {} streams per infer request, but {} are requested",
+                                         memoryPlan->streams,
+                                         maxStreams));
+        }
+    } else {
+        opBuffersExtractor.emplace(orderedNodes, isStableParams, isStableResults, [](const ov::Node& node) {
+            return OperationRegistry::getInstance().isInPlaceCapable(node);
+        });
+    }
+    memory_plan_.nodes.clear();
+    memory_plan_.nodes.reserve(orderedNodes.size());
+    memory_plan_.streams = static_cast<std::uint32_t>(maxStreams);
+    // Index of the node of every operation of exec_sequence_
+    std::vector<std::size_t> stepNodes;
     const auto paramSize = function_->get_parameters().size();
     params_ = std::vector<OperationBase::Ptr>(paramSize);
     params_info_ = std::vector<OperationInfo>(paramSize);
@@ -58,16 +128,48 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
                                          node->get_name(),
                                          node->description()));
         }
-        auto inIds = opBuffersExtractor.inputTensorIds(*node);
-        auto outIds = opBuffersExtractor.outputTensorIds(*node);
-        auto operation = OperationRegistry::getInstance().createOperation(context, node, move(inIds), move(outIds));
+        auto& planNode = memory_plan_.nodes.emplace_back();
+        planNode.name = node->get_name();
+        if (memoryPlan) {
+            const auto& savedNode = memoryPlan->nodes[node_idx];
+            if (savedNode.name != planNode.name) {
+                throwIEException(fmt::format(
+                    "Memory plan node #{} is '{}', but graph node is '{}'", node_idx, savedNode.name, planNode.name));
+            }
+            planNode.inputs = savedNode.inputs;
+            planNode.outputs = savedNode.outputs;
+        } else {
+            planNode.inputs = MemoryPlan::toTensors(opBuffersExtractor->inputTensorIds(*node));
+            planNode.outputs = MemoryPlan::toTensors(opBuffersExtractor->outputTensorIds(*node));
+        }
+        OperationRegistry::Selection selection;
+        auto operation = OperationRegistry::getInstance().createOperation(context,
+                                                                          node,
+                                                                          MemoryPlan::toTensorIds(planNode.inputs),
+                                                                          MemoryPlan::toTensorIds(planNode.outputs),
+                                                                          &selection);
+        if (!selection.implementation.empty()) {
+            auto& rt_info = node->get_rt_info();
+            rt_info[ExecGraphInfoSerialization::IMPL_TYPE] = selection.implementation;
+            rt_info[RtInfo::CUDA_IMPLEMENTATION_SELECTION] = selection.reason;
+        }
         if (dynamic_cast<NopOp*>(operation.get())) {
             continue;
         }
-        operation->SetWorkbufferIds(
-            opBuffersExtractor.processWorkbufferRequest(node_idx, operation->GetWorkBufferRequest()));
-        if (InitNeeded == operation->SetWorkbufferIds(opBuffersExtractor.processWorkbufferRequest(
-                              node_idx, operation->GetWorkBufferRequest()))) {
+        planNode.workbufferRequest = operation->GetWorkBufferRequest();
+        if (memoryPlan) {
+            const auto& savedNode = memoryPlan->nodes[node_idx];
+            if (savedNode.workbufferRequest.immutable_sizes != planNode.workbufferRequest.immutable_sizes ||
+                savedNode.workbufferRequest.mutable_sizes != planNode.workbufferRequest.mutable_sizes) {
+                throwIEException(
+                    fmt::format("Memory plan workbuffers don't match workbuffers of node '{}'", planNode.name));
+            }
+            planNode.workbufferIds = savedNode.workbufferIds;
+        } else {
+            planNode.workbufferIds =
+                opBuffersExtractor->processWorkbufferRequest(node_idx, planNode.workbufferRequest);
+        }
+        if (InitNeeded == operation->SetWorkbufferIds(WorkbufferIds{planNode.workbufferIds})) {
             init_sequence.push_back(operation);
         }
         if (dynamic_cast<ParameterOp*>(operation.get())) {
@@ -85,15 +187,55 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
             results_info_[resultIdx].shape_ = node->get_shape();
         }
         exec_sequence_.push_back(operation);
+        stepNodes.push_back(node_idx);
+    }
+    if (maxStreams > 1) {
+        std::unordered_set<BufferID> mutableBuffers;
+        if (memoryPlan) {
+            for (const auto& [bufferId, offset] : memoryPlan->mutableBuffers.offsets) {
+                mutableBuffers.insert(bufferId);
+            }
+        } else {
+            const auto bufferIds = opBuffersExtractor->mutableBuffersIds();
+            mutableBuffers.insert(bufferIds.begin(), bufferIds.end());
+        }
+        std::vector<StreamSchedule::StepAccesses> steps;
+        steps.reserve(stepNodes.size());
+        for (const auto node_idx : stepNodes) {
+            steps.push_back(getStepAccesses(*orderedNodes[node_idx], memory_plan_.nodes[node_idx], mutableBuffers));
+        }
+        stream_schedule_.emplace(steps, maxStreams);
+        if (opBuffersExtractor) {
+            // Buffers used by concurrent operations shouldn't share memory
+            for (const auto bufferId : mutableBuffers) {
+                if (const auto lifespanEnd = stream_schedule_->LifespanEnd(bufferId)) {
+                    opBuffersExtractor->extendMutableBufferLifespan(bufferId,
+                                                                    static_cast<int>(stepNodes[*lifespanEnd]));
+                }
+            }
+        }
+        if (stream_schedule_->NumLanes() == 1) {
+            stream_schedule_.reset();
+        }
+    }
+    memory_manager_ = memoryPlan ? createMemoryManager(*memoryPlan, orderedNodes)
+                                 : createMemoryManager(*opBuffersExtractor, context.bestMemoryPlanning());
+    memory_plan_.constants = MemoryPlan::toModel(*memory_manager_->immutableTensors().memoryModel());
+    memory_plan_.mutableBuffers = MemoryPlan::toModel(*memory_manager_->mutableTensorsMemoryModel());
+    memory_plan_.immutableWorkbuffers = MemoryPlan::toModel(*memory_manager_->immutableWorkbuffers().memoryModel());
+    execution_plan_ = std::make_unique<ExecutionPlan>(*memory_manager_);
+    for (const auto& op : exec_sequence_) {
+        execution_plan_->append(*op);
     }
-    memory_manager_ = createMemoryManager(opBuffersExtractor);
     initSharedImmutableWorkbuffers(init_sequence);
 }
 
-std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor) {
+std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor,
+                                                             bool bestMemoryPlanning) {
     // Build memory model for mutable memory block
     auto constants_model = opBuffersExtractor.createConstantMemoryModel();
-    auto memory_model = opBuffersExtractor.createMutableMemoryModel();
+    auto memory_model = opBuffersExtractor.createMutableMemoryModel(
+        bestMemoryPlanning ? allMemoryPlanners() : defaultMemoryPlanners(), &planning_report_);
     auto immutable_workbuffer_model = opBuffersExtractor.createImmutableMemoryModel();
 
     // Build shared constants memory block
@@ -105,6 +247,27 @@ std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuff
     return std::make_unique<MemoryManager>(shared_constants_blob, memory_model, immutable_workbuffers);
 }
 
+std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const MemoryPlan& memoryPlan,
+                                                             const std::vector<std::shared_ptr<ov::Node>>& orderedNodes) {
+    auto shared_constants_blob = std::make_shared<DeviceMemBlock>(MemoryPlan::toMemoryModel(memoryPlan.constants));
+    for (unsigned node_idx = 0; node_idx < orderedNodes.size(); node_idx++) {
+        const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(orderedNodes[node_idx]);
+        if (!constant) continue;
+        const auto& outputs = memoryPlan.nodes[node_idx].outputs;
+        IE_ASSERT(outputs.size() == 1) << "Constant node " << constant->get_name() << " should have a single output";
+        void* device_ptr = shared_constants_blob->deviceBufferPtr(outputs.front().buffer);
+        IE_ASSERT(device_ptr != nullptr) << "Constant buffer not found. ID is " << outputs.front().buffer;
+        throwIfError(::cudaMemcpy(device_ptr,
+                                  constant->get_data_ptr(),
+                                  OperationBuffersExtractor::GetTensorByteSize(constant->output(0)),
+                                  cudaMemcpyHostToDevice));
+    }
+    auto memory_model = MemoryPlan::toMemoryModel(memoryPlan.mutableBuffers);
+    auto immutable_workbuffers =
+        std::make_shared<DeviceMemBlock>(MemoryPlan::toMemoryModel(memoryPlan.immutableWorkbuffers));
+    return std::make_unique<MemoryManager>(shared_constants_blob, memory_model, immutable_workbuffers);
+}
+
 void SubGraph::initSharedImmutableWorkbuffers(const std::vector<OperationBase::Ptr>& init_sequence) {
     for (auto op : init_sequence) {
         op->InitSharedImmutableWorkbuffers(getSharedWorkbuffers(*op));
@@ -130,19 +293,76 @@ WorkbufferRequest SubGraph::GetWorkBufferRequest() const {
 
 void SubGraph::Execute(const InferenceRequestContext& context, Inputs, Outputs, const Workbuffers& workbuffers) const {
     const auto& stream = context.getThreadContext().stream();
-    const auto& memoryManager = *memory_manager_;
-    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    const auto boundFrame = execution_plan_->bind(workbuffers.mutable_buffers.at(0));
+    const auto& frame = *boundFrame;
 
     auto& cancellationToken = context.getCancellationToken();
     auto& profiler = context.getProfiler();
     profiler.SetStream(stream);
+    if (stream_schedule_) {
+        executeStreams(context, frame);
+        return;
+    }
+    std::size_t step = 0;
     for (auto& op : profiler.CreateExecSequence(this)) {
         cancellationToken.Check();
-        auto inputTensors = memoryManager.inputTensorPointers(*op, mutableBuffer);
-        auto outputTensors = memoryManager.outputTensorPointers(*op, mutableBuffer);
-        auto workBuffers = memoryManager.workBuffers(*op, mutableBuffer);
-        op->Execute(context, inputTensors, outputTensors, workBuffers);
+        op->Execute(context, frame.inputs(step), frame.outputs(step), frame.workbuffers(step));
+        ++step;
+    }
+}
+
+void SubGraph::executeStreams(const InferenceRequestContext& context, const ExecutionPlan::Frame& frame) const {
+    const auto& threadContext = context.getThreadContext();
+    const auto& stream = threadContext.stream();
+    auto& cancellationToken = context.getCancellationToken();
+    auto& profiler = context.getProfiler();
+    const auto& scheduledSteps = stream_schedule_->Steps();
+    const auto numLanes = stream_schedule_->NumLanes();
+    // Events of the schedule go first, then an event to fork lanes from the stream and events to join them
+    const auto forkEvent = stream_schedule_->NumSignals();
+
+    std::vector<InferenceRequestContext> laneContexts;
+    laneContexts.reserve(numLanes);
+    for (std::size_t lane = 0; lane < numLanes; ++lane) {
+        laneContexts.emplace_back(context, threadContext.lane(lane));
+    }
+    // Operations of other lanes should start after preprocessing which is done on the stream
+    threadContext.event(forkEvent).record(stream);
+    for (std::size_t lane = 1; lane < numLanes; ++lane) {
+        threadContext.event(forkEvent).streamWait(laneContexts[lane].getThreadContext().stream());
+    }
+    // Synchronizing with the stream also makes memory of the request free only when all lanes are done
+    const auto joinLanes = [&] {
+        for (std::size_t lane = 1; lane < numLanes; ++lane) {
+            auto& joinEvent = threadContext.event(forkEvent + lane);
+            joinEvent.record(laneContexts[lane].getThreadContext().stream());
+            joinEvent.streamWait(stream);
+        }
+        profiler.SetStream(stream);
+    };
+    auto sequence = profiler.CreateExecSequence(this);
+    try {
+        std::size_t step = 0;
+        for (auto& op : sequence) {
+            cancellationToken.Check();
+            const auto& scheduled = scheduledSteps[step];
+            const auto& laneContext = laneContexts[scheduled.lane];
+            const auto& laneStream = laneContext.getThreadContext().stream();
+            for (const auto wait : scheduled.waits) {
+                threadContext.event(scheduledSteps[wait].signal).streamWait(laneStream);
+            }
+            profiler.SetStream(laneStream);
+            op->Execute(laneContext, frame.inputs(step), frame.outputs(step), frame.workbuffers(step));
+            if (scheduled.signal != StreamSchedule::Step::kNoSignal) {
+                threadContext.event(scheduled.signal).record(laneStream);
+            }
+            ++step;
+        }
+    } catch (...) {
+        joinLanes();
+        throw;
     }
+    joinLanes();
 }
 
 }  // namespace nvidia_gpu
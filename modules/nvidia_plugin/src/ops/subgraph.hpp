@@ -6,9 +6,13 @@
 
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_operation_base.hpp>
+#include <cuda_stream_schedule.hpp>
+#include <memory_manager/cuda_execution_plan.hpp>
 #include <memory_manager/cuda_memory_manager.hpp>
+#include <memory_manager/cuda_memory_plan.hpp>
 #include <memory_manager/cuda_memory_pool.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
+#include <optional>
 
 class ExecNetworkTest;
 
@@ -27,14 +31,44 @@ public:
                  const Workbuffers& workbuffers) const override;
     const MemoryManager& memoryManager() const { return *memory_manager_; }
 
+    /**
+     * @returns Device memory locations of tensors and workbuffers of getExecSequence() operations
+     */
+    const ExecutionPlan& executionPlan() const { return *execution_plan_; }
+
     const std::vector<OperationBase::Ptr>& getParams() const;
     const std::vector<OperationBase::Ptr>& getExecSequence() const;
     const std::vector<OperationBase::Ptr>& getResults() const;
 
+    /**
+     * @returns Buffers and memory models of the graph which can be used to rebuild it
+     * without extracting buffers and planning memory again
+     */
+    const MemoryPlan& memoryPlan() const { return memory_plan_; }
+
+    /**
+     * @returns Result of planning of mutable memory, empty if the graph was built from a memory plan
+     */
+    const MemoryModelBuilder::PlanningReport& memoryPlanningReport() const { return planning_report_; }
+
+    /**
+     * @returns Distribution of getExecSequence() operations over streams or nullptr
+     * if all of them are executed on a single stream
+     */
+    const StreamSchedule* streamSchedule() const { return stream_schedule_ ? &*stream_schedule_ : nullptr; }
+
 private:
     void initSharedImmutableWorkbuffers(const std::vector<OperationBase::Ptr>& init_sequence);
-    void initExecuteSequence(const CreationContext& context, bool isStableParams, bool isStableResults);
-    static std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor);
+    void initExecuteSequence(const CreationContext& context,
+                             bool isStableParams,
+                             bool isStableResults,
+                             std::size_t maxStreams,
+                             const MemoryPlan* memoryPlan = nullptr);
+    void executeStreams(const InferenceRequestContext& context, const ExecutionPlan::Frame& frame) const;
+    std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor,
+                                                       bool bestMemoryPlanning);
+    static std::unique_ptr<MemoryManager> createMemoryManager(const MemoryPlan& memoryPlan,
+                                                              const std::vector<std::shared_ptr<ov::Node>>& orderedNodes);
     std::vector<DevicePointer<void*>> getSharedWorkbuffers(const IOperationExec& operation);
 
 protected:
@@ -45,6 +79,13 @@ protected:
              IndexCollection&& inputIds,
              IndexCollection&& outputIds);
     SubGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function);
+    /**
+     * Rebuilds graph using previously saved memory plan
+     * @throws InferenceEngineException if the plan doesn't match the function
+     */
+    SubGraph(const CreationContext& context,
+             const std::shared_ptr<const ngraph::Function>& function,
+             const MemoryPlan& memoryPlan);
 
     WorkbufferRequest GetWorkBufferRequest() const override;
 
@@ -63,6 +104,10 @@ protected:
     };
 
     std::unique_ptr<MemoryManager> memory_manager_;
+    std::unique_ptr<ExecutionPlan> execution_plan_;
+    MemoryPlan memory_plan_;
+    MemoryModelBuilder::PlanningReport planning_report_;
+    std::optional<StreamSchedule> stream_schedule_;
     std::vector<OperationBase::Ptr> params_;
     std::vector<OperationInfo> params_info_;
     std::vector<OperationBase::Ptr> exec_sequence_;
@@ -70,5 +70,6 @@ void SwishOp::Execute(const InferenceRequestContext& context,
 }
 
 OPERATION_REGISTER(SwishOp, Swish);
+OPERATION_REGISTER_IN_PLACE(Swish);
 }  // namespace nvidia_gpu
 }  // namespace ov
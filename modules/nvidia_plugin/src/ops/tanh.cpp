@@ -20,5 +20,6 @@ TanhOp::TanhOp(const CreationContext& context,
           std::make_unique<CUDA::TanhDescriptor>(), context, *node, move(inputIds), move(outputIds)} {}
 
 OPERATION_REGISTER(TanhOp, Tanh);
+OPERATION_REGISTER_IN_PLACE(Tanh);
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <cpp/ie_cnn_network.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_profiler.hpp>
@@ -108,6 +109,19 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
     }
     max_threads_per_block_ = context.device().props().maxThreadsPerBlock;
 
+    params_steps_.resize(params_.size());
+    results_steps_.resize(results_.size());
+    for (std::size_t step = 0; step < exec_sequence_.size(); ++step) {
+        const auto& op = exec_sequence_[step];
+        if (const auto param = std::find(params_.begin(), params_.end(), op); param != params_.end()) {
+            params_steps_[std::distance(params_.begin(), param)] = step;
+        } else if (const auto result = std::find(results_.begin(), results_.end(), op); result != results_.end()) {
+            results_steps_[std::distance(results_.begin(), result)] = step;
+        } else {
+            body_steps_.push_back(step);
+        }
+    }
+
     for (const auto& [inputIdx, portMap] : portmap_inputs_) {
         const auto inputShape = inputs_info_[inputIdx].shape_;
         const auto inputType = inputs_info_[inputIdx].type_;
@@ -143,8 +157,8 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
                                Outputs outputTensors,
                                const Workbuffers& workbuffers) const {
     const auto& stream = context.getThreadContext().stream();
-    const auto& memoryManager = *memory_manager_;
-    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    const auto boundFrame = executionPlan().bind(workbuffers.mutable_buffers.at(0));
+    const auto& frame = *boundFrame;
     auto& cancellationToken = context.getCancellationToken();
     auto& profiler = context.getProfiler();
     profiler.SetStream(stream);
@@ -152,11 +166,11 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
     // First iteration
     for (const auto inputIdx : invariant_inputs_) {
         const auto paramIdx = inputs_parameters_map_.at(inputIdx);
-        copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
+        copyParam(stream, frame, inputTensors, 0, inputIdx, paramIdx);
     }
     for (const auto& [inputIdx, paramIdx] : inputs_parameters_map_) {
         if (portmap_inputs_.count(inputIdx) == 0) {
-            copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
+            copyParam(stream, frame, inputTensors, 0, inputIdx, paramIdx);
         }
     }
 
@@ -168,26 +182,25 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
         for (auto& it : portmap_inputs_) {
             const auto& inputIdx = it.first;
             const auto& paramIdx = inputs_parameters_map_.at(inputIdx);
-            copyParam(stream, mutableBuffer, inputTensors, iter, inputIdx, paramIdx);
+            copyParam(stream, frame, inputTensors, iter, inputIdx, paramIdx);
         }
 
         // Inner loop
+        auto step = body_steps_.cbegin();
         for (const auto& op : execSequence) {
-            auto inTensors = memoryManager.inputTensorPointers(*op, mutableBuffer);
-            auto outTensors = memoryManager.outputTensorPointers(*op, mutableBuffer);
-            auto workBuffers = memoryManager.workBuffers(*op, mutableBuffer);
-            op->Execute(context, inTensors, outTensors, workBuffers);
+            op->Execute(context, frame.inputs(*step), frame.outputs(*step), frame.workbuffers(*step));
+            ++step;
         }
 
         // Back-edge mapping
         for (auto& [resultIdx, paramIdx] : results_parameters_map_) {
-            copyBackEdge(stream, mutableBuffer, resultIdx, paramIdx);
+            copyBackEdge(stream, frame, resultIdx, paramIdx);
         }
 
         // Output mapping of ports
         for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
             if (portmap_outputs_.count(outputIdx) > 0) {
-                copyResult(stream, mutableBuffer, outputTensors, iter, resultIdx, outputIdx);
+                copyResult(stream, frame, outputTensors, iter, resultIdx, outputIdx);
             }
         }
 
@@ -195,7 +208,7 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
         if (iterations_results_map_.count(iter) > 0) {
             for (const auto& resultIdx : iterations_results_map_.at(iter)) {
                 const auto& outputIdx = results_outputs_map_.at(resultIdx);
-                copyResult(stream, mutableBuffer, outputTensors, iter, resultIdx, outputIdx);
+                copyResult(stream, frame, outputTensors, iter, resultIdx, outputIdx);
             }
         }
     }
@@ -227,24 +240,21 @@ void TensorIteratorOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
 }
 
 void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
-                                 const CUDA::DevicePointer<void*> mutableBuffer,
+                                 const ExecutionPlan::Frame& frame,
                                  const IOperationExec::Inputs& inputTensors,
                                  const std::int64_t iter,
                                  const uint64_t inputIdx,
                                  const uint64_t paramIdx) const {
-    auto& memoryManager = *memory_manager_;
     const std::size_t inputSize = inputs_info_[inputIdx].size_;
     const std::size_t paramSize = params_info_[paramIdx].size_;
     if (portmap_inputs_.count(inputIdx) == 0) {
         auto& input = inputTensors[inputIdx];
-        const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
+        auto outputTensors = frame.outputs(params_steps_[paramIdx]);
         Expects(inputSize == paramSize);
         stream.transfer(outputTensors[0], input, inputSize);
     } else {
         const auto& portMap = portmap_inputs_.at(inputIdx);
-        const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
+        auto outputTensors = frame.outputs(params_steps_[paramIdx]);
         const auto inputShape = inputs_info_[inputIdx].shape_;
 
         const auto& slice = kernelmap_inputs_.at(inputIdx);
@@ -261,14 +271,11 @@ void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
 }
 
 void TensorIteratorOp::copyBackEdge(const CUDA::Stream& stream,
-                                    CUDA::DevicePointer<void*> mutableBuffer,
+                                    const ExecutionPlan::Frame& frame,
                                     const uint64_t resultIdx,
                                     const uint64_t paramIdx) const {
-    auto& memoryManager = *memory_manager_;
-    const auto& result = results_[resultIdx];
-    const auto& param = params_[paramIdx];
-    auto paramTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
-    auto resultTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
+    auto paramTensors = frame.outputs(params_steps_[paramIdx]);
+    auto resultTensors = frame.inputs(results_steps_[resultIdx]);
     const std::size_t paramSize = params_info_[paramIdx].size_;
     const std::size_t resultSize = results_info_[resultIdx].size_;
     Expects(paramSize == resultSize);
@@ -276,24 +283,21 @@ void TensorIteratorOp::copyBackEdge(const CUDA::Stream& stream,
 }
 
 void TensorIteratorOp::copyResult(const CUDA::Stream& stream,
-                                  CUDA::DevicePointer<void*> mutableBuffer,
+                                  const ExecutionPlan::Frame& frame,
                                   const IOperationExec::Outputs& outputTensors,
                                   const std::int64_t iter,
                                   const std::size_t resultIdx,
                                   const std::size_t outputIdx) const {
-    auto& memoryManager = *memory_manager_;
     const auto resultSize = results_info_[resultIdx].size_;
     const std::size_t outputSize = outputs_info_[outputIdx].size_;
     if (portmap_outputs_.count(outputIdx) == 0) {
-        const auto result = results_[resultIdx];
-        auto inTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
+        auto inTensors = frame.inputs(results_steps_[resultIdx]);
         const auto output = outputTensors[outputIdx];
         Expects(resultSize == outputSize);
         stream.transfer(output, inTensors[0], outputSize);
     } else {
         auto output = outputTensors[outputIdx];
-        const auto& result = results_[resultIdx];
-        auto inputTensors = memoryManager.inputTensorPointers(*result, mutableBuffer);
+        auto inputTensors = frame.inputs(results_steps_[resultIdx]);
         const auto portMap = portmap_outputs_.at(outputIdx);
         const auto outputShape = outputs_info_[outputIdx].shape_;
 
@@ -40,17 +40,17 @@ private:
     void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
 
     void copyParam(const CUDA::Stream& stream,
-                   CUDA::DevicePointer<void*> mutableBuffer,
+                   const ExecutionPlan::Frame& frame,
                    const IOperationExec::Inputs& inputTensors,
                    std::int64_t iter,
                    uint64_t inputIdx,
                    uint64_t paramIdx) const;
     void copyBackEdge(const CUDA::Stream& stream,
-                      CUDA::DevicePointer<void*> mutableBuffer,
+                      const ExecutionPlan::Frame& frame,
                       uint64_t resultIdx,
                       uint64_t paramIdx) const;
     void copyResult(const CUDA::Stream& stream,
-                    CUDA::DevicePointer<void*> mutableBuffer,
+                    const ExecutionPlan::Frame& frame,
                     const IOperationExec::Outputs& outputTensors,
                     int64_t iter,
                     std::size_t resultIdx,
@@ -69,6 +69,10 @@ private:
     std::unordered_map<uint64_t, PortMap> portmap_outputs_;
     std::unordered_map<uint64_t, kernel::Insert> kernelmap_outputs_;
     std::unordered_map<uint64_t, uint64_t> results_parameters_map_;
+    // Steps of executionPlan() for body operations (in order of the profiler sequence), parameters and results
+    std::vector<std::size_t> body_steps_;
+    std::vector<std::size_t> params_steps_;
+    std::vector<std::size_t> results_steps_;
 };
 
 }  // namespace nvidia_gpu
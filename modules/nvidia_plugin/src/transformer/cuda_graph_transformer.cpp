@@ -22,11 +22,13 @@
 #include "bidirectional_lstm_sequence_composition.hpp"
 #include "concat_transformation.hpp"
 #include "cuda_fullyconnected_transformation.hpp"
+#include "fuse_eltwise_chain.hpp"
 #include "matmul_transformations.hpp"
 #include "noop_broadcast_transformation.hpp"
 #include "nvidia/nvidia_config.hpp"
 #include "remove_duplicated_results_transformation.hpp"
 #include "remove_redundant_convert_transformation.hpp"
+#include "split_transformation.hpp"
 #include "transformations/common_optimizations/convert_compression_only_to_legacy.hpp"
 #include "transformations/op_conversions/convert_divide.hpp"
 #include "transformations/op_conversions/convert_interpolate1_to_interpolate4.hpp"
@@ -35,16 +37,10 @@
 
 using namespace ov::nvidia_gpu;
 
-std::shared_ptr<ngraph::Function> GraphTransformer::export_transform(
-    const CUDA::Device& device,
-    const std::shared_ptr<const ngraph::Function>& function,
-    const InferenceEngine::InputsDataMap& inputInfoMap,
-    const InferenceEngine::OutputsDataMap& outputsInfoMap,
-    const Configuration& config) const {
-    auto transformed_function = ngraph::clone_function(*function);
+namespace {
 
+std::shared_ptr<ngraph::pass::PassConfig> makePassConfig() {
     auto passConfig = std::make_shared<ngraph::pass::PassConfig>();
-    ngraph::pass::Manager manager{passConfig};
 
     passConfig->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
     passConfig->disable<ngraph::pass::MVN6Decomposition>();
@@ -59,13 +55,21 @@ std::shared_ptr<ngraph::Function> GraphTransformer::export_transform(
     passConfig->disable<ngraph::pass::ConvertSubtract>();
     passConfig->disable<ngraph::pass::ConvertDivide>();
     passConfig->disable<ngraph::pass::ConvertMod>();
+    return passConfig;
+}
 
-    [[maybe_unused]] const auto& originOps = function->get_ordered_ops();
-    [[maybe_unused]] const auto& originOpsSize = originOps.size();
+}  // namespace
 
+void GraphTransformer::register_common_passes(TimedPassManager& manager,
+                                              const InferenceEngine::InputsDataMap& inputInfoMap) const {
     manager.register_pass<ngraph::pass::InitNodeInfo>();
     manager.register_pass<ngraph::pass::AddPreprocessing>(inputInfoMap);
     manager.register_pass<ngraph::pass::CommonOptimizations>();
+}
+
+void GraphTransformer::register_export_passes(TimedPassManager& manager,
+                                              const std::shared_ptr<const ngraph::Function>& function,
+                                              const InferenceEngine::InputsDataMap& inputInfoMap) const {
     // NOTE: G-API supports only FP32 networks for pre-processing
     //       nvidia_gpu supports FP16 networks, but this transformation is needed for export
     bool needF16toF32 = false;
@@ -81,45 +85,12 @@ std::shared_ptr<ngraph::Function> GraphTransformer::export_transform(
         manager.register_pass<ngraph::pass::ConvertPrecision>(
             precisions_array{{ngraph::element::f16, ngraph::element::f32}});
     }
-
-    manager.run_passes(transformed_function);
-
-    [[maybe_unused]] const auto& transformedOps = transformed_function->get_ordered_ops();
-    [[maybe_unused]] const auto& transformedOpsSize = transformedOps.size();
-
-    return transformed_function;
 }
 
-std::shared_ptr<ngraph::Function> GraphTransformer::transform(const CUDA::Device& device,
-                                                              const std::shared_ptr<const ngraph::Function>& function,
-                                                              const InferenceEngine::InputsDataMap& inputInfoMap,
-                                                              const InferenceEngine::OutputsDataMap& outputsInfoMap,
-                                                              const Configuration& config) const {
-    auto transformed_function = ngraph::clone_function(*function);
-
-    auto passConfig = std::make_shared<ngraph::pass::PassConfig>();
-    ngraph::pass::Manager manager{passConfig};
-
-    passConfig->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
-    passConfig->disable<ngraph::pass::MVN6Decomposition>();
-    passConfig->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
-
-    // NOTE: Elementwise decompositions are now disabled because generally their straightforward versions
-    // are executed faster on CUDA/cuDNN.
-    // However this is not valid for the case with broadcasting of very large shapes (e.g. {{1024, 1024, 384, 2}, {1}})
-    // on CUDA, for them decomposed cuDNN versions are faster.
-    // TODO: Consider as possible optimisations: enabling these decompositions for large shapes, creating cuDNN versions
-    // for these operations, implementing in-place logic in NVIDIA GPU plugin for these operations.
-    passConfig->disable<ngraph::pass::ConvertSubtract>();
-    passConfig->disable<ngraph::pass::ConvertDivide>();
-    passConfig->disable<ngraph::pass::ConvertMod>();
-
-    [[maybe_unused]] const auto& originOps = function->get_ordered_ops();
-    [[maybe_unused]] const auto& originOpsSize = originOps.size();
-
-    manager.register_pass<ngraph::pass::InitNodeInfo>();
-    manager.register_pass<ngraph::pass::AddPreprocessing>(inputInfoMap);
-    manager.register_pass<ngraph::pass::CommonOptimizations>();
+void GraphTransformer::register_device_passes(TimedPassManager& manager,
+                                              const std::shared_ptr<ngraph::pass::PassConfig>& passConfig,
+                                              const CUDA::Device& device,
+                                              const Configuration& config) const {
     manager.register_pass<ngraph::pass::RemoveDuplicatedResultsTransformation>();
     if (!isHalfSupported(device)) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(ov::element::f16, ov::element::f32);
@@ -131,6 +102,7 @@ std::shared_ptr<ngraph::Function> GraphTransformer::transform(const CUDA::Device
     manager.register_pass<ngraph::pass::RemoveRedundantConvertTransformation>();
 
     if (!config.disabled_tensoriterator_transform) {
+        // NOTE: Disables decomposition of sequences in passConfig, so it affects common passes too
         manager.register_pass<ngraph::pass::BidirectionalSequenceComposition>(passConfig);
     }
     manager.register_pass<ngraph::pass::ConvolutionAsymPaddingTransformation>();
@@ -144,12 +116,79 @@ std::shared_ptr<ngraph::Function> GraphTransformer::transform(const CUDA::Device
     manager.register_pass<ngraph::pass::TransposeMatMulTransformation>();
     manager.register_pass<ngraph::pass::FullyConnectedTransformation>();
     manager.register_pass<ngraph::pass::ConcatTransformation>();
+    manager.register_pass<ngraph::pass::SplitTransformation>();
     manager.register_pass<ngraph::pass::NoopBroadcastTransformation>();
+    manager.register_pass<ngraph::pass::FuseEltwiseChain>();
+}
 
-    manager.run_passes(transformed_function);
+GraphTransformer::TransformedFunctions GraphTransformer::export_and_transform(
+    const CUDA::Device& device,
+    const std::shared_ptr<const ngraph::Function>& function,
+    const InferenceEngine::InputsDataMap& inputInfoMap,
+    const InferenceEngine::OutputsDataMap& outputsInfoMap,
+    const Configuration& config) const {
+    TransformedFunctions result;
+    const auto passConfig = makePassConfig();
+    TimedPassManager commonManager{passConfig};
+    TimedPassManager exportManager{passConfig};
+    TimedPassManager deviceManager{passConfig};
+    // All passes are registered before running any of them, because registration may change passConfig
+    register_common_passes(commonManager, inputInfoMap);
+    register_export_passes(exportManager, function, inputInfoMap);
+    register_device_passes(deviceManager, passConfig, device, config);
+
+    result.executable = ngraph::clone_function(*function);
+    commonManager.run_passes(result.executable, result.timings);
+    // Cloned function shares data of constants, so the fork is cheap
+    result.exported = ngraph::clone_function(*result.executable);
+    exportManager.run_passes(result.exported, result.timings);
+    deviceManager.run_passes(result.executable, result.timings);
+    return result;
+}
+
+GraphTransformer::TransformedFunctions GraphTransformer::transform_exported(
+    const CUDA::Device& device,
+    const std::shared_ptr<const ngraph::Function>& function,
+    const Configuration& config) const {
+    TransformedFunctions result;
+    const auto passConfig = makePassConfig();
+    TimedPassManager deviceManager{passConfig};
+    deviceManager.register_pass<ngraph::pass::InitNodeInfo>();
+    register_device_passes(deviceManager, passConfig, device, config);
+
+    result.exported = ngraph::clone_function(*function);
+    result.executable = ngraph::clone_function(*function);
+    deviceManager.run_passes(result.executable, result.timings);
+    return result;
+}
 
-    [[maybe_unused]] const auto& transformedOps = transformed_function->get_ordered_ops();
-    [[maybe_unused]] const auto& transformedOpsSize = transformedOps.size();
+std::shared_ptr<ngraph::Function> GraphTransformer::export_transform(
+    const CUDA::Device& device,
+    const std::shared_ptr<const ngraph::Function>& function,
+    const InferenceEngine::InputsDataMap& inputInfoMap,
+    const InferenceEngine::OutputsDataMap& outputsInfoMap,
+    const Configuration& config) const {
+    auto transformed_function = ngraph::clone_function(*function);
+    const auto passConfig = makePassConfig();
+    TimedPassManager manager{passConfig};
+    register_common_passes(manager, inputInfoMap);
+    register_export_passes(manager, function, inputInfoMap);
+    PassTimings timings;
+    manager.run_passes(transformed_function, timings);
+    return transformed_function;
+}
 
+std::shared_ptr<ngraph::Function> GraphTransformer::transform(const CUDA::Device& device,
+                                                              const std::shared_ptr<const ngraph::Function>& function,
+                                                              const InferenceEngine::InputsDataMap& inputInfoMap,
+                                                              const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                                                              const Configuration& config) const {
+    auto transformed_function = ngraph::clone_function(*function);
+    const auto passConfig = makePassConfig();
+    TimedPassManager manager{passConfig};
+    register_common_passes(manager, inputInfoMap);
+    register_device_passes(manager, passConfig, device, config);
+    PassTimings timings;
+    manager.run_passes(transformed_function, timings);
     return transformed_function;
 }
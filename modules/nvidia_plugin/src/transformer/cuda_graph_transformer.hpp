@@ -9,12 +9,41 @@
 
 #include "cpp/ie_cnn_network.h"
 #include "cuda_config.hpp"
+#include "timed_pass_manager.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
 class GraphTransformer {
 public:
+    struct TransformedFunctions {
+        std::shared_ptr<ngraph::Function> exported;
+        std::shared_ptr<ngraph::Function> executable;
+        PassTimings timings;
+    };
+
+    /**
+     * @brief Produces both results of export_transform and transform at once.
+     *        The original function is cloned once and the passes common for both
+     *        of them are applied once, then the result is forked for export.
+     * @return Function for export, function for execution and time of every applied pass
+     */
+    TransformedFunctions export_and_transform(const CUDA::Device& device,
+                                              const std::shared_ptr<const ngraph::Function>& function,
+                                              const InferenceEngine::InputsDataMap& inputInfoMap,
+                                              const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                                              const Configuration& config) const;
+
+    /**
+     * @brief Transforms a function which export_and_transform has produced for export before,
+     *        e.g. the one read back on ImportNetwork. Common passes have already been applied
+     *        to it, so only passes specific for the device are run.
+     * @return The given function for export, function for execution and time of every applied pass
+     */
+    TransformedFunctions transform_exported(const CUDA::Device& device,
+                                            const std::shared_ptr<const ngraph::Function>& function,
+                                            const Configuration& config) const;
+
     std::shared_ptr<ngraph::Function> export_transform(const CUDA::Device& device,
                                                        const std::shared_ptr<const ngraph::Function>& function,
                                                        const InferenceEngine::InputsDataMap& inputInfoMap,
@@ -38,6 +67,16 @@ public:
                                                 const InferenceEngine::InputsDataMap& inputInfoMap,
                                                 const InferenceEngine::OutputsDataMap& outputsInfoMap,
                                                 const Configuration& config) const;
+
+private:
+    void register_common_passes(TimedPassManager& manager, const InferenceEngine::InputsDataMap& inputInfoMap) const;
+    void register_export_passes(TimedPassManager& manager,
+                                const std::shared_ptr<const ngraph::Function>& function,
+                                const InferenceEngine::InputsDataMap& inputInfoMap) const;
+    void register_device_passes(TimedPassManager& manager,
+                                const std::shared_ptr<ngraph::pass::PassConfig>& passConfig,
+                                const CUDA::Device& device,
+                                const Configuration& config) const;
 };
 
 }  // namespace nvidia_gpu
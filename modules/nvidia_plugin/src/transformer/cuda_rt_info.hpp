@@ -7,5 +7,7 @@
 namespace ov::nvidia_gpu::RtInfo {
 
 static constexpr char CUDA_FUSED_NAMES_MAPPING[] = "CUDA_FUSED_NAMES_MAPPING";
+// Why OperationRegistry has chosen the implementation of a node, see OperationRegistry::Selection
+static constexpr char CUDA_IMPLEMENTATION_SELECTION[] = "CUDA_IMPLEMENTATION_SELECTION";
 
 }
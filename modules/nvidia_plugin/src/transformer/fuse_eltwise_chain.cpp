@@ -0,0 +1,182 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_eltwise_chain.hpp"
+
+#include <algorithm>
+#include <exec_graph_info.hpp>
+#include <map>
+#include <ngraph/rt_info.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <optional>
+#include <unordered_set>
+
+#include "nodes/fused_eltwise.hpp"
+
+using ov::nvidia_gpu::nodes::EltwiseOpcode;
+using ov::nvidia_gpu::nodes::FusedEltwise;
+
+namespace ngraph::pass {
+
+namespace {
+
+std::optional<EltwiseOpcode> getOpcode(const ov::Node& node) {
+    static const std::map<ov::NodeTypeInfo, EltwiseOpcode> binaryOpcodes{
+        {ov::opset8::Add::get_type_info_static(), EltwiseOpcode::ADD},
+        {ov::opset8::Subtract::get_type_info_static(), EltwiseOpcode::SUBTRACT},
+        {ov::opset8::Multiply::get_type_info_static(), EltwiseOpcode::MULTIPLY},
+        {ov::opset8::Divide::get_type_info_static(), EltwiseOpcode::DIVIDE},
+        {ov::opset8::Maximum::get_type_info_static(), EltwiseOpcode::MAXIMUM},
+        {ov::opset8::Minimum::get_type_info_static(), EltwiseOpcode::MINIMUM},
+        {ov::opset8::SquaredDifference::get_type_info_static(), EltwiseOpcode::SQUARED_DIFFERENCE},
+        {ov::opset8::Power::get_type_info_static(), EltwiseOpcode::POWER},
+    };
+    static const std::map<ov::NodeTypeInfo, EltwiseOpcode> unaryOpcodes{
+        {ov::opset8::Sigmoid::get_type_info_static(), EltwiseOpcode::SIGMOID},
+        {ov::opset8::Relu::get_type_info_static(), EltwiseOpcode::RELU},
+        {ov::opset8::Tanh::get_type_info_static(), EltwiseOpcode::TANH},
+        {ov::opset8::Exp::get_type_info_static(), EltwiseOpcode::EXP},
+        {ov::opset8::Abs::get_type_info_static(), EltwiseOpcode::ABS},
+        {ov::opset8::Negative::get_type_info_static(), EltwiseOpcode::NEGATIVE},
+        {ov::opset8::Sqrt::get_type_info_static(), EltwiseOpcode::SQRT},
+        {ov::opset8::Swish::get_type_info_static(), EltwiseOpcode::SWISH},
+    };
+    if (auto binary = binaryOpcodes.find(node.get_type_info()); binary != binaryOpcodes.end()) {
+        const auto broadcastType = node.get_autob().m_type;
+        if (node.get_input_size() == 2 &&
+            (broadcastType == ov::op::AutoBroadcastType::NONE || broadcastType == ov::op::AutoBroadcastType::NUMPY)) {
+            return binary->second;
+        }
+    } else if (auto unary = unaryOpcodes.find(node.get_type_info()); unary != unaryOpcodes.end()) {
+        // Swish with explicit beta is not supported
+        if (node.get_input_size() == 1) {
+            return unary->second;
+        }
+    }
+    return std::nullopt;
+}
+
+bool isFusible(const ov::Node& node) {
+    if (node.get_output_size() != 1 || node.get_output_partial_shape(0).is_dynamic() || !getOpcode(node)) {
+        return false;
+    }
+    const auto type = node.get_output_element_type(0);
+    if (type != ov::element::f32 && type != ov::element::f16) {
+        return false;
+    }
+    for (const auto& input : node.inputs()) {
+        if (input.get_element_type() != type || input.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<ov::Output<ov::Node>> externalInputs(const std::vector<std::shared_ptr<ov::Node>>& nodes,
+                                                 const std::unordered_set<ov::Node*>& members) {
+    std::vector<ov::Output<ov::Node>> inputs;
+    for (const auto& node : nodes) {
+        for (const auto& input : node->input_values()) {
+            const bool isExternal = members.count(input.get_node()) == 0;
+            if (isExternal && std::find(inputs.begin(), inputs.end(), input) == inputs.end()) {
+                inputs.push_back(input);
+            }
+        }
+    }
+    return inputs;
+}
+
+/**
+ * Producer can join the chain if the chain consumes all its results and the chain keeps
+ * the limits of FusedEltwise. Shape of intermediate results should be the same as of the
+ * chain output, so no element is computed more than once.
+ */
+bool canJoin(const std::shared_ptr<ov::Node>& producer,
+             const ov::Node& root,
+             const std::vector<std::shared_ptr<ov::Node>>& chain,
+             const std::unordered_set<ov::Node*>& members) {
+    if (!isFusible(*producer) || producer->get_output_shape(0) != root.get_output_shape(0) ||
+        producer->get_output_element_type(0) != root.get_output_element_type(0) ||
+        chain.size() >= FusedEltwise::max_instructions) {
+        return false;
+    }
+    for (const auto& consumer : producer->output(0).get_target_inputs()) {
+        if (members.count(consumer.get_node()) == 0) {
+            return false;
+        }
+    }
+    auto extendedChain = chain;
+    extendedChain.push_back(producer);
+    auto extendedMembers = members;
+    extendedMembers.insert(producer.get());
+    return externalInputs(extendedChain, extendedMembers).size() <= FusedEltwise::max_inputs;
+}
+
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(FuseEltwiseChain, FuseEltwiseChain::Name, 0);
+
+bool FuseEltwiseChain::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool changed = false;
+    const auto orderedOps = f->get_ordered_ops();
+    std::unordered_set<ov::Node*> fused;
+    // Chains are grown from their last operation towards producers
+    for (auto root = orderedOps.rbegin(); root != orderedOps.rend(); ++root) {
+        if (fused.count(root->get()) > 0 || !isFusible(**root) ||
+            externalInputs({*root}, {root->get()}).size() > FusedEltwise::max_inputs) {
+            continue;
+        }
+        std::vector<std::shared_ptr<ov::Node>> chain{*root};
+        std::unordered_set<ov::Node*> members{root->get()};
+        for (std::size_t i = 0; i < chain.size(); ++i) {
+            for (const auto& input : chain[i]->input_values()) {
+                auto producer = input.get_node_shared_ptr();
+                if (members.count(producer.get()) == 0 && fused.count(producer.get()) == 0 &&
+                    canJoin(producer, **root, chain, members)) {
+                    chain.push_back(producer);
+                    members.insert(producer.get());
+                }
+            }
+        }
+        if (chain.size() < 2) {
+            continue;
+        }
+
+        std::vector<std::shared_ptr<ov::Node>> orderedChain;
+        for (const auto& node : orderedOps) {
+            if (members.count(node.get()) > 0) {
+                orderedChain.push_back(node);
+            }
+        }
+        const auto inputs = externalInputs(orderedChain, members);
+        std::map<ov::Output<ov::Node>, std::size_t> registers;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            registers.emplace(inputs[i], i);
+        }
+        FusedEltwise::Program program;
+        for (const auto& node : orderedChain) {
+            const auto opcode = *getOpcode(*node);
+            const auto lhs = registers.at(node->input_value(0));
+            const auto rhs = FusedEltwise::is_unary(opcode) ? 0 : registers.at(node->input_value(1));
+            registers.emplace(node->output(0), inputs.size() + program.size());
+            program.push_back({opcode, lhs, rhs});
+        }
+
+        auto fusedEltwise = std::make_shared<FusedEltwise>(inputs, std::move(program));
+        fusedEltwise->set_friendly_name((*root)->get_friendly_name());
+        ov::copy_runtime_info(orderedChain, fusedEltwise);
+        std::string originalLayers = (*root)->get_friendly_name();
+        for (auto node = orderedChain.rbegin() + 1; node != orderedChain.rend(); ++node) {
+            originalLayers += "," + (*node)->get_friendly_name();
+        }
+        fusedEltwise->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+        ov::replace_node(*root, fusedEltwise);
+
+        fused.insert(members.begin(), members.end());
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace ngraph::pass
@@ -0,0 +1,23 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph::pass {
+
+/**
+ * @brief Collapses chains of broadcast compatible elementwise operations into FusedEltwise nodes,
+ * so intermediate tensors of the chain are neither written to nor read from device memory.
+ */
+class FuseEltwiseChain : public ngraph::pass::FunctionPass {
+public:
+    static constexpr auto Name = "FuseEltwiseChain";
+
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
+
+}  // namespace ngraph::pass
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace ov::nvidia_gpu::nodes {
 
 /**
@@ -13,4 +15,45 @@ namespace ov::nvidia_gpu::nodes {
  */
 enum class ActivationMode { SIGMOID, RELU, TANH, CLIPPED_RELU, ELU, SWISH, NO_ACTIVATION };
 
+/**
+ * @brief Operations of FusedEltwise expression.
+ *
+ * Binary operations use numpy broadcasting, SWISH is Swish with beta equal to 1.
+ */
+enum class EltwiseOpcode {
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    MAXIMUM,
+    MINIMUM,
+    SQUARED_DIFFERENCE,
+    POWER,
+    SIGMOID,
+    RELU,
+    TANH,
+    EXP,
+    ABS,
+    NEGATIVE,
+    SQRT,
+    SWISH
+};
+
+/**
+ * @brief Instruction of FusedEltwise expression.
+ *
+ * Operands are indices of registers. First registers hold inputs of the node, every instruction
+ * writes the next register, the register of the last instruction is the output of the node.
+ * Unary operations ignore @rhs.
+ */
+struct EltwiseInstruction {
+    EltwiseOpcode opcode;
+    std::size_t lhs;
+    std::size_t rhs;
+};
+
+inline bool operator==(const EltwiseInstruction& a, const EltwiseInstruction& b) {
+    return a.opcode == b.opcode && a.lhs == b.lhs && a.rhs == b.rhs;
+}
+
 }  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,198 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_eltwise.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ngraph/runtime/host_tensor.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+namespace {
+
+float evaluateInstruction(const EltwiseOpcode opcode, const float a, const float b) {
+    switch (opcode) {
+        case EltwiseOpcode::ADD:
+            return a + b;
+        case EltwiseOpcode::SUBTRACT:
+            return a - b;
+        case EltwiseOpcode::MULTIPLY:
+            return a * b;
+        case EltwiseOpcode::DIVIDE:
+            return a / b;
+        case EltwiseOpcode::MAXIMUM:
+            return std::max(a, b);
+        case EltwiseOpcode::MINIMUM:
+            return std::min(a, b);
+        case EltwiseOpcode::SQUARED_DIFFERENCE:
+            return (a - b) * (a - b);
+        case EltwiseOpcode::POWER:
+            return std::pow(a, b);
+        case EltwiseOpcode::SIGMOID:
+            return 1.0f / (1.0f + std::exp(-a));
+        case EltwiseOpcode::RELU:
+            return std::max(a, 0.0f);
+        case EltwiseOpcode::TANH:
+            return std::tanh(a);
+        case EltwiseOpcode::EXP:
+            return std::exp(a);
+        case EltwiseOpcode::ABS:
+            return std::abs(a);
+        case EltwiseOpcode::NEGATIVE:
+            return -a;
+        case EltwiseOpcode::SQRT:
+            return std::sqrt(a);
+        case EltwiseOpcode::SWISH:
+            return a / (1.0f + std::exp(-a));
+    }
+    return 0.0f;
+}
+
+/**
+ * Maps index of an output element to index of an input element according to numpy broadcasting
+ */
+std::size_t broadcastIndex(std::size_t outIndex, const ov::Shape& inShape, const ov::Shape& outShape) {
+    std::size_t inIndex = 0;
+    std::size_t inStride = 1;
+    for (std::size_t i = 0; i < outShape.size(); ++i) {
+        const auto axis = outShape.size() - i - 1;
+        const auto coordinate = outIndex % outShape[axis];
+        outIndex /= outShape[axis];
+        if (i < inShape.size()) {
+            const auto inDim = inShape[inShape.size() - i - 1];
+            inIndex += (inDim == 1 ? 0 : coordinate) * inStride;
+            inStride *= inDim;
+        }
+    }
+    return inIndex;
+}
+
+template <typename T>
+void evaluateProgram(const FusedEltwise::Program& program,
+                     const ngraph::HostTensorVector& outputs,
+                     const ngraph::HostTensorVector& inputs) {
+    const auto& outShape = outputs[0]->get_shape();
+    auto* out = outputs[0]->get_data_ptr<T>();
+    std::vector<float> registers(inputs.size() + program.size());
+    for (std::size_t i = 0; i < ov::shape_size(outShape); ++i) {
+        for (std::size_t k = 0; k < inputs.size(); ++k) {
+            const auto index = broadcastIndex(i, inputs[k]->get_shape(), outShape);
+            registers[k] = static_cast<float>(inputs[k]->get_data_ptr<const T>()[index]);
+        }
+        for (std::size_t k = 0; k < program.size(); ++k) {
+            const auto& instruction = program[k];
+            const auto rhs = FusedEltwise::is_unary(instruction.opcode) ? 0.0f : registers[instruction.rhs];
+            registers[inputs.size() + k] = evaluateInstruction(instruction.opcode, registers[instruction.lhs], rhs);
+        }
+        out[i] = static_cast<T>(registers.back());
+    }
+}
+
+}  // namespace
+
+FusedEltwise::FusedEltwise(const ov::OutputVector& inputs, Program program)
+    : ov::op::Op(inputs), m_program{std::move(program)} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedEltwise::is_unary(const EltwiseOpcode opcode) {
+    switch (opcode) {
+        case EltwiseOpcode::SIGMOID:
+        case EltwiseOpcode::RELU:
+        case EltwiseOpcode::TANH:
+        case EltwiseOpcode::EXP:
+        case EltwiseOpcode::ABS:
+        case EltwiseOpcode::NEGATIVE:
+        case EltwiseOpcode::SQRT:
+        case EltwiseOpcode::SWISH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FusedEltwise::visit_attributes(ov::AttributeVisitor& visitor) {
+    std::vector<int64_t> opcodes;
+    std::vector<int64_t> lhs;
+    std::vector<int64_t> rhs;
+    for (const auto& instruction : m_program) {
+        opcodes.push_back(static_cast<int64_t>(instruction.opcode));
+        lhs.push_back(static_cast<int64_t>(instruction.lhs));
+        rhs.push_back(static_cast<int64_t>(instruction.rhs));
+    }
+    visitor.on_attribute("opcodes", opcodes);
+    visitor.on_attribute("lhs", lhs);
+    visitor.on_attribute("rhs", rhs);
+    if (opcodes.size() != lhs.size() || opcodes.size() != rhs.size()) {
+        return false;
+    }
+    m_program.clear();
+    for (std::size_t i = 0; i < opcodes.size(); ++i) {
+        m_program.push_back({static_cast<EltwiseOpcode>(opcodes[i]),
+                             static_cast<std::size_t>(lhs[i]),
+                             static_cast<std::size_t>(rhs[i])});
+    }
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedEltwise::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedEltwise>(new_args, m_program);
+}
+
+void FusedEltwise::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "FusedEltwise should have inputs");
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "FusedEltwise program should not be empty");
+
+    auto result_et = get_input_element_type(0);
+    auto result_shape = get_input_partial_shape(0);
+    for (std::size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              ov::element::Type::merge(result_et, result_et, get_input_element_type(i)),
+                              "Arguments do not have the same element type (arg0 element type: ",
+                              get_input_element_type(0),
+                              ", arg",
+                              i,
+                              " element type: ",
+                              get_input_element_type(i),
+                              ").");
+        NODE_VALIDATION_CHECK(this,
+                              ov::PartialShape::broadcast_merge_into(
+                                  result_shape, get_input_partial_shape(i), ov::op::AutoBroadcastType::NUMPY),
+                              "Argument shapes are inconsistent.");
+    }
+    for (std::size_t k = 0; k < m_program.size(); ++k) {
+        const auto& instruction = m_program[k];
+        const auto numRegisters = get_input_size() + k;
+        const bool rhsDefined = is_unary(instruction.opcode) || instruction.rhs < numRegisters;
+        NODE_VALIDATION_CHECK(this,
+                              instruction.lhs < numRegisters && rhsDefined,
+                              "Instruction ",
+                              k,
+                              " of FusedEltwise program uses undefined register");
+    }
+    set_output_type(0, result_et, result_shape);
+}
+
+bool FusedEltwise::evaluate(const ngraph::HostTensorVector& outputs, const ngraph::HostTensorVector& inputs) const {
+    outputs[0]->set_shape(get_output_shape(0));
+    switch (get_output_element_type(0)) {
+        case ov::element::Type_t::f32:
+            evaluateProgram<float>(m_program, outputs, inputs);
+            return true;
+        case ov::element::Type_t::f16:
+            evaluateProgram<ov::float16>(m_program, outputs, inputs);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FusedEltwise::has_evaluate() const {
+    const auto type = get_output_element_type(0);
+    return type == ov::element::f32 || type == ov::element::f16;
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,49 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/ops.hpp>
+#include <vector>
+
+#include "cuda_plugin_custom_node_types.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief FusedEltwise computes a chain of elementwise operations in a single pass over the output.
+ *
+ * The chain is described by a program of EltwiseInstruction over the node inputs, which are
+ * broadcast to the output shape with numpy rules.
+ */
+class FusedEltwise : public ov::op::Op {
+public:
+    using Program = std::vector<EltwiseInstruction>;
+
+    static constexpr std::size_t max_inputs = 8;
+    static constexpr std::size_t max_instructions = 16;
+
+    FusedEltwise(const ov::OutputVector& inputs, Program program);
+
+    inline static constexpr type_info_t type_info{"FusedEltwise", 0ul};
+    const type_info_t& get_type_info() const override { return type_info; }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    bool evaluate(const ngraph::HostTensorVector& outputs, const ngraph::HostTensorVector& inputs) const override;
+    bool has_evaluate() const override;
+
+    const Program& get_program() const { return m_program; }
+
+    static bool is_unary(EltwiseOpcode opcode);
+
+private:
+    Program m_program;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
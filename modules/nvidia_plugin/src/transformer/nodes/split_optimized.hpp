@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/split.hpp>
+#include <openvino/op/variadic_split.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * Split which outputs are contiguous parts of its input,
+ * so they are represented as views of the input buffer
+ */
+class SplitOptimized : public ov::op::v1::Split {
+public:
+    using ov::op::v1::Split::Split;
+
+    inline static constexpr type_info_t type_info{"SplitOptimized", 0ul};
+    const type_info_t& get_type_info() const override { return type_info; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<SplitOptimized>(new_args.at(0), new_args.at(1), get_num_splits());
+    }
+};
+
+/**
+ * VariadicSplit which outputs are contiguous parts of its input,
+ * so they are represented as views of the input buffer
+ */
+class VariadicSplitOptimized : public ov::op::v1::VariadicSplit {
+public:
+    using ov::op::v1::VariadicSplit::VariadicSplit;
+
+    inline static constexpr type_info_t type_info{"VariadicSplitOptimized", 0ul};
+    const type_info_t& get_type_info() const override { return type_info; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<VariadicSplitOptimized>(new_args.at(0), new_args.at(1), new_args.at(2));
+    }
+};
+
+}  // namespace ov::nvidia_gpu::nodes
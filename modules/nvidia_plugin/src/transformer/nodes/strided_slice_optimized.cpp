@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "strided_slice_optimized.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <openvino/op/constant.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+namespace {
+
+bool is_zero_mask(const std::vector<int64_t>& mask) {
+    return std::all_of(mask.begin(), mask.end(), [](auto bit) { return bit == 0; });
+}
+
+bool is_set(const std::vector<int64_t>& mask, std::size_t axis) { return axis < mask.size() && mask[axis] != 0; }
+
+}  // namespace
+
+std::shared_ptr<Node> StridedSliceOptimized::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<StridedSliceOptimized>(new_args.at(0),
+                                                   new_args.at(1),
+                                                   new_args.at(2),
+                                                   new_args.at(3),
+                                                   get_begin_mask(),
+                                                   get_end_mask(),
+                                                   get_new_axis_mask(),
+                                                   get_shrink_axis_mask(),
+                                                   get_ellipsis_mask());
+}
+
+std::optional<std::size_t> StridedSliceOptimized::get_contiguous_offset(const ov::op::v1::StridedSlice& slice) {
+    if (slice.get_input_size() != 4 || slice.is_dynamic()) {
+        return std::nullopt;
+    }
+    if (!is_zero_mask(slice.get_new_axis_mask()) || !is_zero_mask(slice.get_shrink_axis_mask()) ||
+        !is_zero_mask(slice.get_ellipsis_mask())) {
+        return std::nullopt;
+    }
+    const auto begin_node = dynamic_cast<const ov::op::v0::Constant*>(slice.get_input_node_ptr(1));
+    const auto strides_node = dynamic_cast<const ov::op::v0::Constant*>(slice.get_input_node_ptr(3));
+    if (!begin_node || !strides_node) {
+        return std::nullopt;
+    }
+    const auto strides = strides_node->cast_vector<int64_t>();
+    if (!std::all_of(strides.begin(), strides.end(), [](auto stride) { return stride == 1; })) {
+        return std::nullopt;
+    }
+
+    const auto& input_shape = slice.get_input_shape(0);
+    const auto& output_shape = slice.get_output_shape(0);
+    if (input_shape.size() != output_shape.size()) {
+        return std::nullopt;
+    }
+    // The slice is contiguous if it cuts a single axis, all outer dimensions are units
+    // and all inner dimensions are taken completely
+    const auto mismatch = std::mismatch(input_shape.begin(), input_shape.end(), output_shape.begin());
+    if (mismatch.first == input_shape.end()) {
+        return 0;
+    }
+    const std::size_t axis = std::distance(input_shape.begin(), mismatch.first);
+    if (std::accumulate(input_shape.begin(), mismatch.first, std::size_t{1}, std::multiplies<std::size_t>()) != 1 ||
+        !std::equal(mismatch.first + 1, input_shape.end(), mismatch.second + 1)) {
+        return std::nullopt;
+    }
+    const auto begin = begin_node->cast_vector<int64_t>();
+    int64_t axis_begin = 0;
+    if (axis < begin.size() && !is_set(slice.get_begin_mask(), axis)) {
+        const auto dim = static_cast<int64_t>(input_shape[axis]);
+        axis_begin = std::clamp(begin[axis] < 0 ? begin[axis] + dim : begin[axis], int64_t{0}, dim);
+    }
+    const auto inner_size =
+        std::accumulate(mismatch.first + 1, input_shape.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    return static_cast<std::size_t>(axis_begin) * inner_size;
+}
+
+}  // namespace ov::nvidia_gpu::nodes
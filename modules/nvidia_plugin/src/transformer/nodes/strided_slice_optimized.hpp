@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <openvino/op/strided_slice.hpp>
+#include <optional>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * StridedSlice which output is a contiguous part of its input,
+ * so it is represented as a view of the input buffer
+ */
+class StridedSliceOptimized : public ov::op::v1::StridedSlice {
+public:
+    using ov::op::v1::StridedSlice::StridedSlice;
+
+    inline static constexpr type_info_t type_info{"StridedSliceOptimized", 0ul};
+    const type_info_t& get_type_info() const override { return type_info; }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    /**
+     * Computes offset of the slice within the input
+     * @param slice StridedSlice node with constant begin, end and strides
+     * @returns Offset in elements or std::nullopt if the slice isn't a contiguous part of the input
+     */
+    static std::optional<std::size_t> get_contiguous_offset(const ov::op::v1::StridedSlice& slice);
+};
+
+}  // namespace ov::nvidia_gpu::nodes
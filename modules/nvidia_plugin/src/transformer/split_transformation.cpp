@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "split_transformation.hpp"
+
+#include <algorithm>
+#include <cuda_op_buffers_extractor.hpp>
+#include <functional>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/rt_info.hpp>
+#include <numeric>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/split.hpp>
+#include <openvino/op/strided_slice.hpp>
+#include <openvino/op/variadic_split.hpp>
+
+#include "nodes/concat_optimized.hpp"
+#include "nodes/split_optimized.hpp"
+#include "nodes/strided_slice_optimized.hpp"
+
+namespace ngraph::pass {
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::SplitTransformation, "SplitTransformation", 0);
+
+namespace {
+
+/**
+ * ConcatOptimized places its inputs into a new buffer,
+ * so they can't be views of another buffer
+ */
+bool feeds_concat_optimized(const ov::Output<ov::Node>& output) {
+    for (const auto& input : output.get_target_inputs()) {
+        const auto node = input.get_node();
+        if (dynamic_cast<const ov::nvidia_gpu::nodes::ConcatOptimized*>(node)) {
+            return true;
+        }
+        if (ov::nvidia_gpu::OperationBuffersExtractor::isReshapeOnlyNode(*node) && input.get_index() == 0 &&
+            feeds_concat_optimized(node->output(0))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool can_be_viewed(const ov::Node& node) {
+    if (node.is_dynamic() || dynamic_cast<const ov::op::v0::Constant*>(node.get_input_node_ptr(0))) {
+        return false;
+    }
+    const auto outputs = node.outputs();
+    return std::none_of(outputs.begin(), outputs.end(), [](const auto& output) { return feeds_concat_optimized(output); });
+}
+
+bool is_split_contiguous(const ov::Node& split) {
+    const auto axis_node = dynamic_cast<const ov::op::v0::Constant*>(split.get_input_node_ptr(1));
+    if (!axis_node) {
+        return false;
+    }
+    const auto& shape = split.get_input_shape(0);
+    auto axis = axis_node->cast_vector<int64_t>().at(0);
+    if (axis < 0) {
+        axis += static_cast<int64_t>(shape.size());
+    }
+    if (axis < 0 || axis >= shape.size()) {
+        return false;
+    }
+    const auto outer_size =
+        std::accumulate(shape.begin(), shape.begin() + axis, std::size_t{1}, std::multiplies<std::size_t>());
+    return outer_size == 1;
+}
+
+std::shared_ptr<ov::Node> make_optimized_node(const std::shared_ptr<ov::Node>& node) {
+    using namespace ov::nvidia_gpu::nodes;
+
+    if (auto split = std::dynamic_pointer_cast<ov::op::v1::Split>(node)) {
+        if (!is_split_contiguous(*split)) return nullptr;
+        return std::make_shared<SplitOptimized>(split->input_value(0), split->input_value(1), split->get_num_splits());
+    }
+    if (auto split = std::dynamic_pointer_cast<ov::op::v1::VariadicSplit>(node)) {
+        if (!is_split_contiguous(*split)) return nullptr;
+        return std::make_shared<VariadicSplitOptimized>(
+            split->input_value(0), split->input_value(1), split->input_value(2));
+    }
+    if (auto slice = std::dynamic_pointer_cast<ov::op::v1::StridedSlice>(node)) {
+        if (!StridedSliceOptimized::get_contiguous_offset(*slice)) return nullptr;
+        return std::make_shared<StridedSliceOptimized>(slice->input_value(0),
+                                                       slice->input_value(1),
+                                                       slice->input_value(2),
+                                                       slice->input_value(3),
+                                                       slice->get_begin_mask(),
+                                                       slice->get_end_mask(),
+                                                       slice->get_new_axis_mask(),
+                                                       slice->get_shrink_axis_mask(),
+                                                       slice->get_ellipsis_mask());
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+bool change_split_to_split_optimized(pattern::Matcher& m) {
+    auto node = m.get_match_root();
+    if (!can_be_viewed(*node)) {
+        return false;
+    }
+    auto optimized = make_optimized_node(node);
+    if (!optimized) {
+        return false;
+    }
+    optimized->set_friendly_name(node->get_friendly_name());
+    ov::copy_runtime_info(node, optimized);
+    ov::replace_node(node, optimized);
+    return true;
+}
+
+SplitTransformation::SplitTransformation() {
+    auto split = pattern::wrap_type<ov::op::v1::Split, ov::op::v1::VariadicSplit, ov::op::v1::StridedSlice>();
+
+    matcher_pass_callback callback = [](pattern::Matcher& m) { return change_split_to_split_optimized(m); };
+
+    auto m = std::make_shared<pattern::Matcher>(split, "SplitTransformation");
+    register_matcher(m, callback);
+}
+
+}  // namespace ngraph::pass
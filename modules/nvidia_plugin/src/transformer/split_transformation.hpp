@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <transformations_visibility.hpp>
+
+namespace ngraph::pass {
+
+/**
+ * Replaces Split, VariadicSplit and StridedSlice which outputs are contiguous
+ * parts of their input with the optimized nodes, which outputs are views
+ * of the input buffer and don't need any copy
+ */
+class SplitTransformation : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    SplitTransformation();
+};
+
+}  // namespace ngraph::pass
@@ -0,0 +1,21 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timed_pass_manager.hpp"
+
+#include "cuda_itt.hpp"
+
+namespace ov::nvidia_gpu {
+
+void TimedPassManager::run_passes(const std::shared_ptr<ngraph::Function>& function, PassTimings& timings) const {
+    using Time = std::chrono::steady_clock;
+    for (const auto& stage : stages_) {
+        OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, openvino::itt::handle(stage.name));
+        const auto start = Time::now();
+        stage.manager->run_passes(function);
+        timings[stage.name] += std::chrono::duration_cast<std::chrono::microseconds>(Time::now() - start);
+    }
+}
+
+}  // namespace ov::nvidia_gpu
@@ -0,0 +1,56 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::nvidia_gpu {
+
+/**
+ * @brief Time spent in transformation passes by pass name.
+ * Time of passes registered several times is accumulated.
+ */
+using PassTimings = std::map<std::string, std::chrono::microseconds>;
+
+/**
+ * @brief TimedPassManager runs registered passes in order like ngraph::pass::Manager,
+ * but measures time of each of them and reports it to ITT.
+ *
+ * Every pass is owned by its own ngraph::pass::Manager sharing the same PassConfig,
+ * so passes keep the behaviour they have within a single manager.
+ */
+class TimedPassManager {
+public:
+    explicit TimedPassManager(std::shared_ptr<ngraph::pass::PassConfig> passConfig)
+        : pass_config_{std::move(passConfig)} {}
+
+    template <typename T, class... Args>
+    std::shared_ptr<T> register_pass(Args&&... args) {
+        auto manager = std::make_unique<ngraph::pass::Manager>(pass_config_);
+        auto pass = manager->register_pass<T>(std::forward<Args>(args)...);
+        stages_.push_back({pass->get_name(), std::move(manager)});
+        return pass;
+    }
+
+    void run_passes(const std::shared_ptr<ngraph::Function>& function, PassTimings& timings) const;
+
+private:
+    struct Stage {
+        std::string name;
+        std::unique_ptr<ngraph::pass::Manager> manager;
+    };
+
+    std::shared_ptr<ngraph::pass::PassConfig> pass_config_;
+    std::vector<Stage> stages_;
+};
+
+}  // namespace ov::nvidia_gpu
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov::nvidia_gpu::utils {
+
+void LatencyHistogram::Snapshot::add(const Snapshot& other) noexcept {
+    for (std::size_t i = 0; i < kNumBuckets; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+}
+
+std::uint64_t LatencyHistogram::Snapshot::count() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto c : counts_) {
+        total += c;
+    }
+    return total;
+}
+
+float LatencyHistogram::Snapshot::percentile(const double quantile) const noexcept {
+    const auto total = count();
+    if (total == 0) {
+        return 0.0f;
+    }
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(quantile * total)));
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < kNumBuckets; ++i) {
+        cumulative += counts_[i];
+        if (cumulative >= rank) {
+            return bucketMidpoint(i);
+        }
+    }
+    return bucketMidpoint(kNumBuckets - 1);
+}
+
+void LatencyHistogram::record(const float microseconds) noexcept {
+    counts_[bucket(microseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept {
+    Snapshot result;
+    for (std::size_t i = 0; i < kNumBuckets; ++i) {
+        result.counts_[i] = counts_[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+std::size_t LatencyHistogram::bucket(const float microseconds) noexcept {
+    if (!(microseconds > 0.0f)) {
+        return 0;
+    }
+    const auto position = std::floor((std::log2(microseconds) - kMinOctave) * kBucketsPerOctave);
+    if (position < 0.0) {
+        return 0;
+    }
+    return std::min(static_cast<std::size_t>(position), kNumBuckets - 1);
+}
+
+float LatencyHistogram::bucketMidpoint(const std::size_t bucket) noexcept {
+    return std::exp2((bucket + 0.5f) / kBucketsPerOctave + kMinOctave);
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief LatencyHistogram counts latencies in logarithmic buckets, four per power of two,
+ * from 1/16 to 2^28 microseconds, so percentiles are reported with about 9% error.
+ *
+ * Counters are atomic, so a single writer records latencies without locks while
+ * other threads take snapshots.
+ */
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kBucketsPerOctave = 4;
+    static constexpr int kMinOctave = -4;
+    static constexpr std::size_t kNumBuckets = 32 * kBucketsPerOctave;
+
+    /**
+     * Non-atomic copy of histogram counters, which may be merged with other snapshots
+     */
+    class Snapshot {
+    public:
+        void add(const Snapshot& other) noexcept;
+        std::uint64_t count() const noexcept;
+        /**
+         * @param quantile Quantile in [0, 1]
+         * @return Latency in microseconds which is not exceeded by the given quantile of samples,
+         * or 0 for an empty histogram
+         */
+        float percentile(double quantile) const noexcept;
+
+    private:
+        friend class LatencyHistogram;
+        std::array<std::uint64_t, kNumBuckets> counts_{};
+    };
+
+    void record(float microseconds) noexcept;
+    Snapshot snapshot() const noexcept;
+
+    static std::size_t bucket(float microseconds) noexcept;
+    static float bucketMidpoint(std::size_t bucket) noexcept;
+
+private:
+    std::array<std::atomic<std::uint64_t>, kNumBuckets> counts_{};
+};
+
+}  // namespace ov::nvidia_gpu::utils
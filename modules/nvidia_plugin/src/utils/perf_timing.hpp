@@ -30,6 +30,15 @@ public:
         return duration_;
     }
     float duration() const noexcept { return duration_; }
+    /**
+     * Returns time in milliseconds from @origin to the start event, if it is recorded
+     */
+    std::optional<float> startOffset(const CUDA::Event& origin) const {
+        if (!start_.has_value()) {
+            return std::nullopt;
+        }
+        return start_->elapsedSince(origin);
+    }
     void clear() {
         start_.reset();
         stop_.reset();
@@ -0,0 +1,301 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_convert.hpp"
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NVIDIA_PLUGIN_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+// Smaller tensors are converted faster than threads are woken up
+constexpr std::size_t kMinParallelCount = 1 << 16;
+
+template <typename SrcT, typename DstT>
+using ConvertFunction = void (*)(const SrcT*, DstT*, std::size_t);
+
+/**
+ * Converts a float to an integer type, out of range values saturate and NaN becomes the lowest value.
+ * Limits of the integer types used here are exactly representable as float.
+ */
+template <typename DstT>
+DstT saturateCast(const float x) {
+    if (!(x > static_cast<float>(std::numeric_limits<DstT>::lowest()))) {
+        return std::numeric_limits<DstT>::lowest();
+    }
+    if (x >= static_cast<float>(std::numeric_limits<DstT>::max())) {
+        return std::numeric_limits<DstT>::max();
+    }
+    return static_cast<DstT>(x);
+}
+
+template <typename DstT, typename SrcT>
+DstT scalarCast(const SrcT x) {
+    if constexpr (std::is_same_v<DstT, __half>) {
+        return __float2half(static_cast<float>(x));
+    } else if constexpr (std::is_same_v<SrcT, __half>) {
+        return scalarCast<DstT>(__half2float(x));
+    } else if constexpr (std::is_floating_point_v<SrcT> && std::is_integral_v<DstT>) {
+        return saturateCast<DstT>(x);
+    } else {
+        return static_cast<DstT>(x);
+    }
+}
+
+template <typename SrcT, typename DstT>
+void convertScalar(const SrcT* src, DstT* dst, const std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = scalarCast<DstT>(src[i]);
+    }
+}
+
+#ifdef NVIDIA_PLUGIN_X86_SIMD
+
+constexpr int kRoundToNearest = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+
+template <typename T>
+const __m128i* asM128(const T* p) {
+    return reinterpret_cast<const __m128i*>(p);
+}
+
+template <typename T>
+__m128i* asM128(T* p) {
+    return reinterpret_cast<__m128i*>(p);
+}
+
+__attribute__((target("avx512f"))) void f32ToF16Avx512(const float* src, __half* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const auto halves = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), kRoundToNearest);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), halves);
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void f16ToF32Avx512(const __half* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const auto halves = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(halves));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void f32ToF16Avx2(const float* src, __half* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_si128(asM128(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), kRoundToNearest));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void f16ToF32Avx2(const __half* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(asM128(src + i))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void u8ToF16Avx2(const std::uint8_t* src, __half* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto floats = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(asM128(src + i))));
+        _mm_storeu_si128(asM128(dst + i), _mm256_cvtps_ph(floats, kRoundToNearest));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void i16ToF16Avx2(const std::int16_t* src, __half* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto floats = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(asM128(src + i))));
+        _mm_storeu_si128(asM128(dst + i), _mm256_cvtps_ph(floats, kRoundToNearest));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void u8ToF32Avx2(const std::uint8_t* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(asM128(src + i)))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i8ToF32Avx2(const std::int8_t* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(asM128(src + i)))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i16ToF32Avx2(const std::int16_t* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(asM128(src + i)))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+/**
+ * Truncates floats to integers of [lowest, max] range the way saturateCast does,
+ * _mm256_max_ps returns the second operand for NaN
+ */
+__attribute__((target("avx2"))) __m256i saturateToInt(const __m256 floats, const float lowest, const float max) {
+    return _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(floats, _mm256_set1_ps(lowest)), _mm256_set1_ps(max)));
+}
+
+__attribute__((target("avx2"))) void storeAsU8(const __m256i ints, std::uint8_t* dst) {
+    const auto words = _mm_packus_epi32(_mm256_castsi256_si128(ints), _mm256_extracti128_si256(ints, 1));
+    _mm_storel_epi64(asM128(dst), _mm_packus_epi16(words, words));
+}
+
+__attribute__((target("avx2"))) void storeAsI16(const __m256i ints, std::int16_t* dst) {
+    _mm_storeu_si128(asM128(dst), _mm_packs_epi32(_mm256_castsi256_si128(ints), _mm256_extracti128_si256(ints, 1)));
+}
+
+__attribute__((target("avx2,f16c"))) void f16ToU8Avx2(const __half* src, std::uint8_t* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        storeAsU8(saturateToInt(_mm256_cvtph_ps(_mm_loadu_si128(asM128(src + i))), 0.f, 255.f), dst + i);
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void f16ToI16Avx2(const __half* src, std::int16_t* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        storeAsI16(saturateToInt(_mm256_cvtph_ps(_mm_loadu_si128(asM128(src + i))), -32768.f, 32767.f), dst + i);
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void f32ToU8Avx2(const float* src, std::uint8_t* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        storeAsU8(saturateToInt(_mm256_loadu_ps(src + i), 0.f, 255.f), dst + i);
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void f32ToI32Avx2(const float* src, std::int32_t* dst, const std::size_t count) {
+    std::size_t i = 0;
+    // _mm256_cvttps_epi32 returns INT_MIN for NaN and out of range values, positive overflows are flipped to INT_MAX
+    const auto overflow = _mm256_set1_ps(2147483648.f);
+    for (; i + 8 <= count; i += 8) {
+        const auto floats = _mm256_loadu_ps(src + i);
+        const auto positiveOverflow = _mm256_castps_si256(_mm256_cmp_ps(floats, overflow, _CMP_GE_OQ));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_xor_si256(_mm256_cvttps_epi32(floats), positiveOverflow));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+/**
+ * Picks the widest implementation CPU supports.
+ * NOTE: F16C is not reported separately, but it is available on all CPUs with AVX2
+ */
+template <typename SrcT, typename DstT>
+ConvertFunction<SrcT, DstT> selectConvert(ConvertFunction<SrcT, DstT> avx512, ConvertFunction<SrcT, DstT> avx2) {
+    if (avx512 && InferenceEngine::with_cpu_x86_avx512f()) {
+        return avx512;
+    }
+    if (avx2 && InferenceEngine::with_cpu_x86_avx2()) {
+        return avx2;
+    }
+    return convertScalar<SrcT, DstT>;
+}
+
+template <typename SrcT, typename DstT>
+ConvertFunction<SrcT, DstT> selectConvert() {
+    constexpr ConvertFunction<SrcT, DstT> none = nullptr;
+    if constexpr (std::is_same_v<SrcT, float> && std::is_same_v<DstT, __half>) {
+        return selectConvert<SrcT, DstT>(f32ToF16Avx512, f32ToF16Avx2);
+    } else if constexpr (std::is_same_v<SrcT, __half> && std::is_same_v<DstT, float>) {
+        return selectConvert<SrcT, DstT>(f16ToF32Avx512, f16ToF32Avx2);
+    } else if constexpr (std::is_same_v<SrcT, std::uint8_t> && std::is_same_v<DstT, __half>) {
+        return selectConvert<SrcT, DstT>(none, u8ToF16Avx2);
+    } else if constexpr (std::is_same_v<SrcT, std::int16_t> && std::is_same_v<DstT, __half>) {
+        return selectConvert<SrcT, DstT>(none, i16ToF16Avx2);
+    } else if constexpr (std::is_same_v<SrcT, std::uint8_t> && std::is_same_v<DstT, float>) {
+        return selectConvert<SrcT, DstT>(none, u8ToF32Avx2);
+    } else if constexpr (std::is_same_v<SrcT, std::int8_t> && std::is_same_v<DstT, float>) {
+        return selectConvert<SrcT, DstT>(none, i8ToF32Avx2);
+    } else if constexpr (std::is_same_v<SrcT, std::int16_t> && std::is_same_v<DstT, float>) {
+        return selectConvert<SrcT, DstT>(none, i16ToF32Avx2);
+    } else if constexpr (std::is_same_v<SrcT, __half> && std::is_same_v<DstT, std::uint8_t>) {
+        return selectConvert<SrcT, DstT>(none, f16ToU8Avx2);
+    } else if constexpr (std::is_same_v<SrcT, __half> && std::is_same_v<DstT, std::int16_t>) {
+        return selectConvert<SrcT, DstT>(none, f16ToI16Avx2);
+    } else if constexpr (std::is_same_v<SrcT, float> && std::is_same_v<DstT, std::uint8_t>) {
+        return selectConvert<SrcT, DstT>(none, f32ToU8Avx2);
+    } else if constexpr (std::is_same_v<SrcT, float> && std::is_same_v<DstT, std::int32_t>) {
+        return selectConvert<SrcT, DstT>(none, f32ToI32Avx2);
+    } else {
+        return convertScalar<SrcT, DstT>;
+    }
+}
+
+#else
+
+template <typename SrcT, typename DstT>
+ConvertFunction<SrcT, DstT> selectConvert() {
+    return convertScalar<SrcT, DstT>;
+}
+
+#endif  // NVIDIA_PLUGIN_X86_SIMD
+
+}  // namespace
+
+template <typename SrcT, typename DstT>
+void convertPrecision(const SrcT* src, DstT* dst, const std::size_t count) {
+    static const auto convert = selectConvert<SrcT, DstT>();
+    if (count < kMinParallelCount) {
+        convert(src, dst, count);
+        return;
+    }
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::size_t start = 0;
+        std::size_t end = 0;
+        InferenceEngine::splitter(count, nthr, ithr, start, end);
+        convert(src + start, dst + start, end - start);
+    });
+}
+
+template <typename SrcT, typename DstT>
+void convertPrecisionScalar(const SrcT* src, DstT* dst, const std::size_t count) {
+    convertScalar(src, dst, count);
+}
+
+#define INSTANTIATE_CONVERT_PRECISION(SrcT, DstT)                                 \
+    template void convertPrecision<SrcT, DstT>(const SrcT*, DstT*, std::size_t); \
+    template void convertPrecisionScalar<SrcT, DstT>(const SrcT*, DstT*, std::size_t);
+
+INSTANTIATE_CONVERT_PRECISION(std::uint8_t, __half)
+INSTANTIATE_CONVERT_PRECISION(std::uint8_t, float)
+INSTANTIATE_CONVERT_PRECISION(std::int8_t, float)
+INSTANTIATE_CONVERT_PRECISION(std::int16_t, __half)
+INSTANTIATE_CONVERT_PRECISION(std::int16_t, float)
+INSTANTIATE_CONVERT_PRECISION(__half, std::uint8_t)
+INSTANTIATE_CONVERT_PRECISION(__half, std::int16_t)
+INSTANTIATE_CONVERT_PRECISION(__half, float)
+INSTANTIATE_CONVERT_PRECISION(float, std::uint8_t)
+INSTANTIATE_CONVERT_PRECISION(float, __half)
+INSTANTIATE_CONVERT_PRECISION(float, std::int32_t)
+
+#undef INSTANTIATE_CONVERT_PRECISION
+
+}  // namespace ov::nvidia_gpu::utils
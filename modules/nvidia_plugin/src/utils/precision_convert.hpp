@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_fp16.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Converts @count elements of @src into element type of @dst on host.
+ *
+ * Uses AVX-512 or AVX2/F16C instructions when CPU supports them and scalar code otherwise.
+ * Large tensors are split across threads of the executor which calls the function.
+ * Conversions to integer types saturate out of range values and convert NaN to the lowest value.
+ *
+ * Supported conversions are the ones CudaInferRequest performs for network inputs and outputs:
+ * u8, i16 and bool (as int8_t) to f16/f32, f16 to u8/i16/f32, f32 to u8/f16/i32.
+ */
+template <typename SrcT, typename DstT>
+void convertPrecision(const SrcT* src, DstT* dst, std::size_t count);
+
+/**
+ * @brief Scalar single threaded conversion which is used as a reference by tests and benchmarks
+ */
+template <typename SrcT, typename DstT>
+void convertPrecisionScalar(const SrcT* src, DstT* dst, std::size_t count);
+
+}  // namespace ov::nvidia_gpu::utils
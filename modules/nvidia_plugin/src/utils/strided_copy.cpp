@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "strided_copy.hpp"
+
+#include <ie_parallel.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <openvino/core/except.hpp>
+#include <vector>
+
+#include "ngraph/util.hpp"
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+// Smaller tensors are copied faster than threads are woken up
+constexpr std::size_t kMinParallelBytes = 1 << 18;
+
+using OffsetTable = std::vector<std::size_t>;
+
+/**
+ * Builds byte offsets in source memory for every coordinate of every logical axis.
+ * Offset of an element is the sum of offsets of its coordinates, because block
+ * dimensions of different axes are independent
+ */
+std::vector<OffsetTable> makeOffsetTables(const InferenceEngine::BlockingDesc& desc,
+                                          const InferenceEngine::SizeVector& dims,
+                                          const std::size_t elementSize) {
+    const auto& blockDims = desc.getBlockDims();
+    const auto& order = desc.getOrder();
+    const auto& strides = desc.getStrides();
+    const auto& offsets = desc.getOffsetPaddingToData();
+    OPENVINO_ASSERT(order.size() == blockDims.size() && strides.size() == blockDims.size() &&
+                        offsets.size() == blockDims.size(),
+                    "ov::nvidia_gpu: inconsistent blocking descriptor");
+    std::vector<OffsetTable> tables(dims.size());
+    for (std::size_t axis = 0; axis < dims.size(); ++axis) {
+        // Block dimensions of the axis from the outermost to the innermost
+        std::vector<std::size_t> blocks;
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            OPENVINO_ASSERT(order[i] < dims.size(),
+                            "ov::nvidia_gpu: invalid axes order: ",
+                            ngraph::vector_to_string(order));
+            if (order[i] == axis) {
+                blocks.push_back(i);
+            }
+        }
+        OPENVINO_ASSERT(!blocks.empty(),
+                        "ov::nvidia_gpu: axis ",
+                        axis,
+                        " is missing in axes order: ",
+                        ngraph::vector_to_string(order));
+        auto& table = tables[axis];
+        table.resize(dims[axis]);
+        for (std::size_t x = 0; x < dims[axis]; ++x) {
+            std::size_t rest = x;
+            std::size_t offset = 0;
+            for (std::size_t b = blocks.size(); b-- > 0;) {
+                const auto i = blocks[b];
+                const auto coordinate = b == 0 ? rest : rest % blockDims[i];
+                rest = b == 0 ? 0 : rest / blockDims[i];
+                offset += (coordinate + offsets[i]) * strides[i];
+            }
+            table[x] = offset * elementSize;
+        }
+    }
+    return tables;
+}
+
+bool isContiguous(const OffsetTable& table, const std::size_t stride) {
+    for (std::size_t x = 0; x < table.size(); ++x) {
+        if (table[x] != table[0] + x * stride) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t ElementSize>
+void gatherRow(const std::uint8_t* src, std::uint8_t* dst, const OffsetTable& table) {
+    for (const auto offset : table) {
+        std::memcpy(dst, src + offset, ElementSize);
+        dst += ElementSize;
+    }
+}
+
+void gatherRow(const std::uint8_t* src, std::uint8_t* dst, const OffsetTable& table, const std::size_t elementSize) {
+    switch (elementSize) {
+        case 1:
+            return gatherRow<1>(src, dst, table);
+        case 2:
+            return gatherRow<2>(src, dst, table);
+        case 4:
+            return gatherRow<4>(src, dst, table);
+        case 8:
+            return gatherRow<8>(src, dst, table);
+        default:
+            for (const auto offset : table) {
+                std::memcpy(dst, src + offset, elementSize);
+                dst += elementSize;
+            }
+    }
+}
+
+}  // namespace
+
+bool isDenseDesc(const InferenceEngine::BlockingDesc& desc, const InferenceEngine::SizeVector& dims) {
+    const auto& blockDims = desc.getBlockDims();
+    const auto& order = desc.getOrder();
+    const auto& strides = desc.getStrides();
+    const auto& offsets = desc.getOffsetPaddingToData();
+    if (blockDims.size() != dims.size()) {
+        return false;
+    }
+    std::size_t expectedStride = 1;
+    for (std::size_t i = blockDims.size(); i-- > 0;) {
+        if (order.at(i) != i || strides.at(i) != expectedStride || offsets.at(i) != 0) {
+            return false;
+        }
+        expectedStride *= blockDims.at(i);
+    }
+    return true;
+}
+
+void copyToDense(const void* src,
+                 void* dst,
+                 const InferenceEngine::BlockingDesc& desc,
+                 const InferenceEngine::SizeVector& dims,
+                 const std::size_t elementSize) {
+    const auto numElements = std::accumulate(dims.begin(), dims.end(), std::size_t{1}, std::multiplies<>());
+    if (numElements == 0) {
+        return;
+    }
+    const auto* srcBytes = static_cast<const std::uint8_t*>(src);
+    auto* dstBytes = static_cast<std::uint8_t*>(dst);
+    const auto tables = makeOffsetTables(desc, dims, elementSize);
+
+    // Innermost axes, which continue each other in source memory, are copied as a single run
+    std::size_t runBytes = elementSize;
+    std::size_t runOffset = 0;
+    std::size_t numRowAxes = dims.size();
+    while (numRowAxes > 0 && isContiguous(tables[numRowAxes - 1], runBytes)) {
+        runBytes *= dims[numRowAxes - 1];
+        runOffset += tables[numRowAxes - 1][0];
+        --numRowAxes;
+    }
+    const bool gather = numRowAxes == dims.size() && numRowAxes > 0;
+    if (gather) {
+        // Innermost axis is strided, so each row of it is gathered element by element
+        --numRowAxes;
+    }
+    const auto rowBytes = gather ? dims.back() * elementSize : runBytes;
+    const auto numRows = numElements * elementSize / rowBytes;
+
+    auto copyRows = [&](const std::size_t begin, const std::size_t end) {
+        if (begin >= end) {
+            return;
+        }
+        std::vector<std::size_t> coordinates(numRowAxes);
+        for (std::size_t axis = numRowAxes, rest = begin; axis-- > 0;) {
+            coordinates[axis] = rest % dims[axis];
+            rest /= dims[axis];
+        }
+        auto* dstRow = dstBytes + begin * rowBytes;
+        for (std::size_t row = begin; row < end; ++row) {
+            std::size_t srcOffset = runOffset;
+            for (std::size_t axis = 0; axis < numRowAxes; ++axis) {
+                srcOffset += tables[axis][coordinates[axis]];
+            }
+            if (gather) {
+                gatherRow(srcBytes + srcOffset, dstRow, tables.back(), elementSize);
+            } else {
+                std::memcpy(dstRow, srcBytes + srcOffset, rowBytes);
+            }
+            dstRow += rowBytes;
+            for (std::size_t axis = numRowAxes; axis-- > 0;) {
+                if (++coordinates[axis] < dims[axis]) {
+                    break;
+                }
+                coordinates[axis] = 0;
+            }
+        }
+    };
+    if (numRows == 1 || numElements * elementSize < kMinParallelBytes) {
+        copyRows(0, numRows);
+        return;
+    }
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        InferenceEngine::splitter(numRows, nthr, ithr, begin, end);
+        copyRows(begin, end);
+    });
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_layouts.h>
+
+#include <cstddef>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Checks whether memory described by @desc is a dense planar tensor of dimensions @dims,
+ * i.e. it can be used as is without gathering.
+ */
+bool isDenseDesc(const InferenceEngine::BlockingDesc& desc, const InferenceEngine::SizeVector& dims);
+
+/**
+ * @brief Gathers tensor of dimensions @dims described by @desc from @src into dense planar @dst.
+ *
+ * Supports permuted axes orders, blocked layouts and ROI offsets (offsetPaddingToData of block dimensions).
+ * Contiguous innermost runs are copied with memcpy, outer dimensions are split across threads of
+ * the executor which calls the function.
+ *
+ * @param src Pointer to the beginning of the described memory
+ * @param dst Dense destination of shape_size(@dims) elements
+ * @param desc Blocking descriptor of @src
+ * @param dims Logical dimensions of the tensor
+ * @param elementSize Size of a single element in bytes
+ */
+void copyToDense(const void* src,
+                 void* dst,
+                 const InferenceEngine::BlockingDesc& desc,
+                 const InferenceEngine::SizeVector& dims,
+                 std::size_t elementSize);
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cuda_dynamic_batcher.hpp>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+using namespace std::chrono_literals;
+
+class DynamicBatcherTest : public testing::Test {
+public:
+    using Batcher = DynamicBatcher<int>;
+
+    void OnDispatch(Batcher::Batch&& batch) {
+        {
+            std::lock_guard<std::mutex> lock{mtx_};
+            batches_.push_back(std::move(batch));
+        }
+        cv_.notify_all();
+    }
+
+    void WaitForRequests(std::size_t numRequests) {
+        std::unique_lock<std::mutex> lock{mtx_};
+        ASSERT_TRUE(cv_.wait_for(lock, 10s, [&] {
+            return std::accumulate(batches_.begin(), batches_.end(), std::size_t{0}, [](auto sum, const auto& b) {
+                       return sum + b.size();
+                   }) >= numRequests;
+        }));
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::vector<Batcher::Batch> batches_;
+};
+
+TEST_F(DynamicBatcherTest, FullBatchIsDispatchedBeforeWindow) {
+    Batcher batcher{{4, 10s, 0us, 1}, [this](auto&& batch) { OnDispatch(std::move(batch)); }};
+    for (int i = 0; i < 4; ++i) {
+        batcher.Submit(i);
+    }
+    WaitForRequests(4);
+    ASSERT_EQ(batches_.size(), 1);
+    ASSERT_EQ(batches_[0], (std::vector<int>{0, 1, 2, 3}));
+    batcher.OnBatchCompleted(1ms);
+    ASSERT_DOUBLE_EQ(batcher.GetStatistics().fillRatio(4), 1.0);
+}
+
+TEST_F(DynamicBatcherTest, PartialBatchIsDispatchedAfterWindow) {
+    Batcher batcher{{4, 20ms, 0us, 1}, [this](auto&& batch) { OnDispatch(std::move(batch)); }};
+    const auto start = Batcher::Time::now();
+    batcher.Submit(0);
+    batcher.Submit(1);
+    WaitForRequests(2);
+    ASSERT_GE(Batcher::Time::now() - start, 20ms);
+    ASSERT_EQ(batches_.size(), 1);
+    batcher.OnBatchCompleted(1ms);
+    const auto statistics = batcher.GetStatistics();
+    ASSERT_EQ(statistics.numBatches, 1);
+    ASSERT_EQ(statistics.numRequests, 2);
+    ASSERT_DOUBLE_EQ(statistics.fillRatio(4), 0.5);
+}
+
+TEST_F(DynamicBatcherTest, LatencyBoundShortensWindow) {
+    Batcher batcher{{4, 10s, 50ms, 1}, [this](auto&& batch) { OnDispatch(std::move(batch)); }};
+    batcher.Submit(0);
+    WaitForRequests(1);
+    // Batches are expected to take 40ms now, so the next request may wait only for 10ms
+    batcher.OnBatchCompleted(40ms);
+    const auto start = Batcher::Time::now();
+    batcher.Submit(1);
+    WaitForRequests(2);
+    ASSERT_LT(Batcher::Time::now() - start, 1s);
+    ASSERT_EQ(batches_.size(), 2);
+    batcher.OnBatchCompleted(40ms);
+}
+
+TEST_F(DynamicBatcherTest, RequestsAreGatheredWhileBatchIsInFlight) {
+    Batcher batcher{{8, 0us, 0us, 1}, [this](auto&& batch) { OnDispatch(std::move(batch)); }};
+    batcher.Submit(0);
+    WaitForRequests(1);
+    for (int i = 1; i < 4; ++i) {
+        batcher.Submit(i);
+    }
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        ASSERT_EQ(batches_.size(), 1);
+    }
+    batcher.OnBatchCompleted(1ms);
+    WaitForRequests(4);
+    ASSERT_EQ(batches_.size(), 2);
+    ASSERT_EQ(batches_[1], (std::vector<int>{1, 2, 3}));
+    batcher.OnBatchCompleted(1ms);
+}
+
+TEST_F(DynamicBatcherTest, DestructorDispatchesPendingRequests) {
+    {
+        Batcher* self = nullptr;
+        Batcher batcher{{3, 10s, 0us, 1}, [&](auto&& batch) {
+                            OnDispatch(std::move(batch));
+                            self->OnBatchCompleted(1ms);
+                        }};
+        self = &batcher;
+        for (int i = 0; i < 5; ++i) {
+            batcher.Submit(i);
+        }
+        WaitForRequests(3);
+    }
+    ASSERT_EQ(batches_.size(), 2);
+    ASSERT_EQ(batches_[1], (std::vector<int>{3, 4}));
+}
+
+TEST_F(DynamicBatcherTest, DestructorKeepsBatchesInFlightLimit) {
+    std::atomic<int> inFlight{0};
+    std::atomic<int> maxInFlight{0};
+    // Accessed only by the batcher thread, destroyed after the batcher, so all completions are awaited
+    std::vector<std::future<void>> completions;
+    {
+        Batcher* self = nullptr;
+        Batcher batcher{{1, 10s, 0us, 1}, [&](auto&& batch) {
+                            maxInFlight = std::max(maxInFlight.load(), ++inFlight);
+                            OnDispatch(std::move(batch));
+                            completions.push_back(std::async(std::launch::async, [&] {
+                                std::this_thread::sleep_for(5ms);
+                                --inFlight;
+                                self->OnBatchCompleted(5ms);
+                            }));
+                        }};
+        self = &batcher;
+        for (int i = 0; i < 4; ++i) {
+            batcher.Submit(i);
+        }
+        WaitForRequests(1);
+    }
+    ASSERT_EQ(batches_.size(), 4);
+    ASSERT_EQ(maxInFlight, 1);
+}
@@ -0,0 +1,138 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <ngraph/function.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformer/fuse_eltwise_chain.hpp>
+#include <transformer/nodes/fused_eltwise.hpp>
+#include <vector>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace ov::nvidia_gpu;
+using nodes::EltwiseOpcode;
+using nodes::FusedEltwise;
+
+namespace {
+
+const ov::Shape kShape{1, 4, 3, 5};
+const ov::Shape kChannelShape{1, 4, 1, 1};
+
+std::shared_ptr<ov::opset8::Constant> channelConstant(float start) {
+    std::vector<float> values(ov::shape_size(kChannelShape));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = start + 0.25f * i;
+    }
+    return ov::opset8::Constant::create(ov::element::f32, kChannelShape, values);
+}
+
+/**
+ * Scale and shift followed by Swish decomposed into Sigmoid and Multiply
+ */
+std::shared_ptr<ngraph::Function> createScaleShiftSwish() {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, kShape);
+    auto multiply = std::make_shared<ov::opset8::Multiply>(data, channelConstant(0.5f));
+    auto add = std::make_shared<ov::opset8::Add>(multiply, channelConstant(-1.0f));
+    auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(add);
+    auto swish = std::make_shared<ov::opset8::Multiply>(add, sigmoid);
+    return std::make_shared<ngraph::Function>(ov::NodeVector{swish}, ov::ParameterVector{data});
+}
+
+std::size_t countFusedEltwise(const ngraph::Function& function) {
+    std::size_t count = 0;
+    for (const auto& node : function.get_ops()) {
+        count += ov::is_type<FusedEltwise>(node) ? 1 : 0;
+    }
+    return count;
+}
+
+std::vector<float> evaluate(const std::shared_ptr<ngraph::Function>& function, const std::vector<float>& input) {
+    auto inputTensor = std::make_shared<ngraph::runtime::HostTensor>(ov::element::f32, kShape);
+    inputTensor->write(input.data(), input.size() * sizeof(float));
+    auto outputTensor = std::make_shared<ngraph::runtime::HostTensor>();
+    EXPECT_TRUE(function->evaluate({outputTensor}, {inputTensor}));
+    const auto* output = outputTensor->get_data_ptr<float>();
+    return {output, output + ov::shape_size(outputTensor->get_shape())};
+}
+
+}  // namespace
+
+TEST(FuseEltwiseChain, ScaleShiftSwish) {
+    auto function = createScaleShiftSwish();
+    ngraph::pass::InitNodeInfo().run_on_function(function);
+    ngraph::pass::FuseEltwiseChain().run_on_function(function);
+    ASSERT_NO_THROW(check_rt_info(function));
+
+    std::shared_ptr<ngraph::Function> reference;
+    {
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, kShape);
+        const FusedEltwise::Program program{{EltwiseOpcode::MULTIPLY, 0, 1},
+                                            {EltwiseOpcode::ADD, 3, 2},
+                                            {EltwiseOpcode::SIGMOID, 4, 0},
+                                            {EltwiseOpcode::MULTIPLY, 4, 5}};
+        auto fused = std::make_shared<FusedEltwise>(
+            ov::OutputVector{data, channelConstant(0.5f), channelConstant(-1.0f)}, program);
+        reference = std::make_shared<ngraph::Function>(ov::NodeVector{fused}, ov::ParameterVector{data});
+    }
+    const auto result = compare_functions(function, reference);
+    ASSERT_TRUE(result.first) << result.second;
+
+    const auto fused = std::dynamic_pointer_cast<FusedEltwise>(
+        function->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_program(),
+              std::dynamic_pointer_cast<FusedEltwise>(
+                  reference->get_results().at(0)->input_value(0).get_node_shared_ptr())
+                  ->get_program());
+}
+
+TEST(FuseEltwiseChain, KeepsIntermediateResultsUsedOutside) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, kShape);
+    auto multiply = std::make_shared<ov::opset8::Multiply>(data, channelConstant(0.5f));
+    auto relu = std::make_shared<ov::opset8::Relu>(multiply);
+    auto tanh = std::make_shared<ov::opset8::Tanh>(relu);
+    auto function = std::make_shared<ngraph::Function>(ov::NodeVector{tanh, multiply}, ov::ParameterVector{data});
+
+    ngraph::pass::FuseEltwiseChain().run_on_function(function);
+
+    // Multiply is a network output, so only Relu and Tanh are fused
+    ASSERT_EQ(countFusedEltwise(*function), 1u);
+    const auto fused = std::dynamic_pointer_cast<FusedEltwise>(
+        function->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(fused);
+    ASSERT_EQ(fused->get_program().size(), 2u);
+    ASSERT_EQ(fused->input_value(0).get_node_shared_ptr(), multiply);
+}
+
+TEST(FuseEltwiseChain, SingleOperationIsNotFused) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, kShape);
+    auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(data);
+    auto function = std::make_shared<ngraph::Function>(ov::NodeVector{sigmoid}, ov::ParameterVector{data});
+
+    ASSERT_FALSE(ngraph::pass::FuseEltwiseChain().run_on_function(function));
+    ASSERT_EQ(countFusedEltwise(*function), 0u);
+}
+
+TEST(FuseEltwiseChain, EvaluatesAsOriginal) {
+    std::vector<float> input(ov::shape_size(kShape));
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = 0.1f * static_cast<float>(i) - 3.0f;
+    }
+    const auto expected = evaluate(createScaleShiftSwish(), input);
+
+    auto function = createScaleShiftSwish();
+    ngraph::pass::FuseEltwiseChain().run_on_function(function);
+    ASSERT_EQ(countFusedEltwise(*function), 1u);
+    const auto actual = evaluate(function, input);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-5f) << "index " << i;
+    }
+}
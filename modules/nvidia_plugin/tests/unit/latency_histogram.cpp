@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <utils/latency_histogram.hpp>
+
+using namespace ov::nvidia_gpu::utils;
+
+namespace {
+
+// Relative error of a reported percentile is bounded by half of a bucket
+constexpr float kTolerance = 0.1f;
+
+}  // namespace
+
+TEST(LatencyHistogramTest, Empty) {
+    const LatencyHistogram histogram;
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count(), 0u);
+    ASSERT_EQ(snapshot.percentile(0.5), 0.0f);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(static_cast<float>(i));
+    }
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count(), 1000u);
+    ASSERT_NEAR(snapshot.percentile(0.5), 500.0f, 500.0f * kTolerance);
+    ASSERT_NEAR(snapshot.percentile(0.99), 990.0f, 990.0f * kTolerance);
+}
+
+TEST(LatencyHistogramTest, OutOfRangeValues) {
+    LatencyHistogram histogram;
+    histogram.record(0.0f);
+    histogram.record(-1.0f);
+    histogram.record(1e12f);
+    ASSERT_EQ(histogram.snapshot().count(), 3u);
+    ASSERT_EQ(LatencyHistogram::bucket(0.0f), 0u);
+    ASSERT_EQ(LatencyHistogram::bucket(1e12f), LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogramTest, MergeSnapshots) {
+    LatencyHistogram fast;
+    LatencyHistogram slow;
+    for (int i = 0; i < 90; ++i) {
+        fast.record(10.0f);
+    }
+    for (int i = 0; i < 10; ++i) {
+        slow.record(1000.0f);
+    }
+    auto merged = fast.snapshot();
+    merged.add(slow.snapshot());
+    ASSERT_EQ(merged.count(), 100u);
+    ASSERT_NEAR(merged.percentile(0.5), 10.0f, 10.0f * kTolerance);
+    ASSERT_NEAR(merged.percentile(0.99), 1000.0f, 1000.0f * kTolerance);
+}
+
+TEST(LatencyHistogramTest, ConcurrentSnapshots) {
+    LatencyHistogram histogram;
+    constexpr int kRecords = 100000;
+    std::thread writer{[&] {
+        for (int i = 0; i < kRecords; ++i) {
+            histogram.record(5.0f);
+        }
+    }};
+    std::uint64_t lastCount = 0;
+    while (lastCount < kRecords) {
+        const auto count = histogram.snapshot().count();
+        ASSERT_GE(count, lastCount);
+        lastCount = count;
+    }
+    writer.join();
+}
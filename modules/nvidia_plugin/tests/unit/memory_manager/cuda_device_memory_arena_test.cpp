@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_device_memory_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+
+#include "memory_manager/cuda_device_mem_block.hpp"
+#include "memory_manager/cuda_memory_pool.hpp"
+#include "memory_manager/model/cuda_memory_model.hpp"
+
+using namespace ov::nvidia_gpu;
+
+TEST(DeviceMemoryArena, ReleasedSlabIsReused) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>();
+    const void* firstPtr = nullptr;
+    {
+        auto slab = arena->Lease(1000, cancellationToken);
+        firstPtr = slab.allocation().get();
+        ASSERT_EQ(arena->LeasedSize(), 1000);
+    }
+    ASSERT_EQ(arena->LeasedSize(), 0);
+    ASSERT_EQ(arena->AllocatedSize(), 1000);
+
+    // Smaller request is served from the idle slab
+    auto slab = arena->Lease(600, cancellationToken);
+    ASSERT_EQ(slab.allocation().get(), firstPtr);
+    ASSERT_EQ(slab.size(), 1000);
+    ASSERT_EQ(arena->AllocatedSize(), 1000);
+}
+
+TEST(DeviceMemoryArena, MuchLargerIdleSlabIsKeptForLargeRequests) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>();
+    const void* bigPtr = nullptr;
+    {
+        auto slab = arena->Lease(1000, cancellationToken);
+        bigPtr = slab.allocation().get();
+    }
+    auto smallSlab = arena->Lease(100, cancellationToken);
+    ASSERT_NE(smallSlab.allocation().get(), bigPtr);
+    ASSERT_EQ(smallSlab.size(), 100);
+    auto bigSlab = arena->Lease(900, cancellationToken);
+    ASSERT_EQ(bigSlab.allocation().get(), bigPtr);
+    ASSERT_EQ(arena->AllocatedSize(), 1100);
+}
+
+TEST(DeviceMemoryArena, MuchLargerIdleSlabIsLeasedWithoutRoomForNewOne) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>(1024);
+    const void* bigPtr = nullptr;
+    {
+        auto slab = arena->Lease(1024, cancellationToken);
+        bigPtr = slab.allocation().get();
+    }
+    auto slab = arena->Lease(100, cancellationToken);
+    ASSERT_EQ(slab.allocation().get(), bigPtr);
+    ASSERT_EQ(slab.size(), 1024);
+    ASSERT_EQ(arena->AllocatedSize(), 1024);
+}
+
+TEST(DeviceMemoryArena, MoveAssignedSlabIsReleased) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>();
+    auto slab = arena->Lease(1000, cancellationToken);
+    slab = arena->Lease(600, cancellationToken);
+    ASSERT_EQ(slab.size(), 600);
+    ASSERT_EQ(arena->LeasedSize(), 600);
+    ASSERT_EQ(arena->AllocatedSize(), 1600);
+    {
+        auto other = arena->Lease(800, cancellationToken);
+        ASSERT_EQ(other.size(), 1000);
+        ASSERT_EQ(arena->LeasedSize(), 1600);
+    }
+    ASSERT_EQ(arena->LeasedSize(), 600);
+}
+
+TEST(DeviceMemoryArena, HighWaterMark) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>();
+    {
+        auto slab0 = arena->Lease(1000, cancellationToken);
+        auto slab1 = arena->Lease(500, cancellationToken);
+        ASSERT_NE(slab0.allocation().get(), slab1.allocation().get());
+        ASSERT_EQ(arena->HighWaterMark(), 1500);
+    }
+    {
+        auto slab0 = arena->Lease(1000, cancellationToken);
+        auto slab1 = arena->Lease(500, cancellationToken);
+    }
+    ASSERT_EQ(arena->AllocatedSize(), 1500);
+    ASSERT_EQ(arena->HighWaterMark(), 1500);
+}
+
+TEST(DeviceMemoryArena, IdleSlabsAreEvictedToStayWithinCapacity) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>(1024);
+    { auto slab = arena->Lease(512, cancellationToken); }
+    ASSERT_EQ(arena->AllocatedSize(), 512);
+    auto slab = arena->Lease(1024, cancellationToken);
+    ASSERT_EQ(arena->AllocatedSize(), 1024);
+    ASSERT_EQ(arena->HighWaterMark(), 1024);
+}
+
+TEST(DeviceMemoryArena, LeaseWaitsForRelease) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>(1024);
+    auto slab = std::make_unique<DeviceMemoryArena::Slab>(arena->Lease(1024, cancellationToken));
+    const auto ptr = slab->allocation().get();
+    auto waiter = std::async(std::launch::async, [&arena] {
+        CancellationToken token{};
+        return arena->Lease(768, token).allocation().get();
+    });
+    ASSERT_EQ(waiter.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    slab.reset();
+    ASSERT_EQ(waiter.get(), ptr);
+    ASSERT_EQ(arena->AllocatedSize(), 1024);
+}
+
+TEST(DeviceMemoryArena, RequestAboveCapacityThrows) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>(1024);
+    ASSERT_THROW(arena->Lease(2048, cancellationToken), InferenceEngine::Exception);
+}
+
+TEST(DeviceMemoryArena, MemoryPoolsShareSlabs) {
+    CancellationToken cancellationToken{};
+    auto arena = std::make_shared<DeviceMemoryArena>();
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto bigModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto smallModel = std::make_shared<MemoryModel>(600, offsets);
+    auto bigPool = std::make_shared<MemoryPool>(2, bigModel, arena);
+    auto smallPool = std::make_shared<MemoryPool>(2, smallModel, arena);
+    ASSERT_EQ(arena->AllocatedSize(), 0);
+
+    const void* bigPtr = nullptr;
+    {
+        auto proxy = bigPool->WaitAndGet(cancellationToken);
+        bigPtr = proxy.Get().view().data();
+        ASSERT_EQ(arena->LeasedSize(), 1000);
+    }
+    {
+        auto proxy = smallPool->WaitAndGet(cancellationToken);
+        ASSERT_EQ(proxy.Get().view().data(), bigPtr);
+        ASSERT_EQ(proxy.Get().view().size(), 600);
+    }
+    ASSERT_EQ(arena->LeasedSize(), 0);
+    ASSERT_EQ(arena->AllocatedSize(), 1000);
+    ASSERT_EQ(bigPool->Size(), 2);
+    ASSERT_EQ(smallPool->Size(), 2);
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "cuda_operation_base.hpp"
+#include "memory_manager/cuda_execution_plan.hpp"
+#include "memory_manager/cuda_immutable_memory_block_builder.hpp"
+#include "memory_manager/cuda_memory_manager.hpp"
+#include "memory_manager/model/cuda_memory_model_builder.hpp"
+
+namespace {
+
+using namespace ov::nvidia_gpu;
+
+/**
+ * Operation which only describes its tensors, the benchmark measures host side
+ * cost of obtaining tensor pointers, not the execution itself
+ */
+class FakeOperation : public IOperationMeta, public IOperationExec {
+public:
+    FakeOperation(std::vector<TensorID> inputs, std::vector<TensorID> outputs, WorkbufferIds workbuffers)
+        : inputs_{std::move(inputs)}, outputs_{std::move(outputs)}, workbuffers_{std::move(workbuffers)} {}
+
+    const std::string& GetName() const override { return name_; }
+    const std::string& GetTypeName() const override { return name_; }
+    const std::string_view& GetCategory() const override { return Category::CUDA; }
+    gsl::span<const TensorID> GetInputIds() const override { return inputs_; }
+    gsl::span<const TensorID> GetOutputIds() const override { return outputs_; }
+
+    void Execute(const InferenceRequestContext&, Inputs, Outputs, const Workbuffers&) const override {}
+    void InitSharedImmutableWorkbuffers(const Buffers&) override {}
+    WorkbufferRequest GetWorkBufferRequest() const override { return {}; }
+    const WorkbufferIds& GetWorkbufferIds() const override { return workbuffers_; }
+    WorkbufferStatus SetWorkbufferIds(WorkbufferIds&&) override { return WorkbufferStatus::NoInitNeeded; }
+
+private:
+    std::string name_;
+    std::vector<TensorID> inputs_;
+    std::vector<TensorID> outputs_;
+    WorkbufferIds workbuffers_;
+};
+
+TEST(ExecutionPlanBenchmark, DISABLED_benchmark) {
+    using microseconds = std::chrono::duration<double, std::micro>;
+    constexpr int kNumOperations = 1000;
+    constexpr int kNumInferences = 1000;
+    constexpr size_t kTensorSize = 1024;
+
+    // Linear chain where every operation also consumes a constant and every 4th one needs a workbuffer
+    const std::vector<uint8_t> data(kTensorSize, 0);
+    ImmutableMemoryBlockBuilder constantsBuilder;
+    MemoryModelBuilder mutableBuilder;
+    BufferID nextId = 0;
+    std::vector<FakeOperation> operations;
+    operations.reserve(kNumOperations);
+    for (int i = 0; i < kNumOperations; ++i) {
+        const BufferID constant = nextId++;
+        const BufferID input = nextId++;
+        const BufferID output = nextId++;
+        constantsBuilder.addAllocation(constant, data.data(), data.size());
+        mutableBuilder.addAllocation(input, i, i, kTensorSize);
+        mutableBuilder.addAllocation(output, i, i + 1, kTensorSize);
+        WorkbufferIds workbuffers;
+        if (i % 4 == 0) {
+            workbuffers.mutableIds.push_back(nextId);
+            mutableBuilder.addAllocation(nextId++, i, i, kTensorSize);
+        }
+        operations.emplace_back(std::vector<TensorID>{TensorID{input}, TensorID{constant}},
+                                std::vector<TensorID>{TensorID{output}},
+                                std::move(workbuffers));
+    }
+    auto constants = constantsBuilder.build().first;
+    const auto mutableModel = mutableBuilder.build();
+    const MemoryManager memoryManager{constants, mutableModel};
+    auto allocation = CUDA::DefaultStream::stream().malloc(mutableModel->deviceMemoryBlockSize());
+    const CUDA::DevicePointer<void*> mutableBuffer{allocation.get()};
+
+    // Keeps compiler from throwing the loops away
+    const void* sink = nullptr;
+    auto consume = [&sink](auto inputs, auto outputs, const Workbuffers& workbuffers) {
+        sink = inputs[0].get();
+        sink = outputs[0].get();
+        if (!workbuffers.mutable_buffers.empty()) sink = workbuffers.mutable_buffers[0].get();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumInferences; ++i) {
+        for (const auto& op : operations) {
+            auto inputs = memoryManager.inputTensorPointers(op, mutableBuffer);
+            auto outputs = memoryManager.outputTensorPointers(op, mutableBuffer);
+            auto workbuffers = memoryManager.workBuffers(op, mutableBuffer);
+            consume(inputs, outputs, workbuffers);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    const double lookupTime = microseconds{end - start}.count() / (kNumInferences * kNumOperations);
+
+    ExecutionPlan plan{memoryManager};
+    for (const auto& op : operations) {
+        plan.append(op, op.GetWorkbufferIds());
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumInferences; ++i) {
+        auto frame = plan.bind(mutableBuffer);
+        for (std::size_t step = 0; step < plan.size(); ++step) {
+            consume(frame->inputs(step), frame->outputs(step), frame->workbuffers(step));
+        }
+    }
+    end = std::chrono::steady_clock::now();
+    const double planTime = microseconds{end - start}.count() / (kNumInferences * kNumOperations);
+
+    std::cout << std::fixed << std::setprecision(4) << "Operations: " << kNumOperations
+              << "\nMemoryManager lookups: " << lookupTime << " microseconds per operation"
+              << "\nExecutionPlan: " << planTime << " microseconds per operation (bind included)\n";
+    ASSERT_NE(sink, nullptr);
+}
+
+}  // namespace
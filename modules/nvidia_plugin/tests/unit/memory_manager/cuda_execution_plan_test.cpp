@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_execution_plan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <details/ie_exception.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "cuda_operation_base.hpp"
+#include "memory_manager/cuda_immutable_memory_block_builder.hpp"
+#include "memory_manager/cuda_memory_manager.hpp"
+#include "memory_manager/model/cuda_memory_model_builder.hpp"
+
+class ExecutionPlanTest : public testing::Test, public ov::nvidia_gpu::IOperationMeta {
+public:
+    using TensorID = ov::nvidia_gpu::TensorID;
+
+    void SetUp() override {
+        using namespace ov::nvidia_gpu;
+        // Allocate shared memory block for constant tensors
+        {
+            const std::vector<uint8_t> data(256, 0xA5);
+            ImmutableMemoryBlockBuilder builder;
+            for (auto id : sharedConstantIds_) {
+                builder.addAllocation(id.GetId(), &data[0], data.size());
+            }
+            std::tie(immutableTensors_, std::ignore) = builder.build();
+        }
+
+        // Allocate shared memory block for immutable workbuffers
+        {
+            const std::vector<uint8_t> data(64, 0x5A);
+            ImmutableMemoryBlockBuilder builder;
+            for (auto id : immutableWorkbufferIds_) {
+                builder.addAllocation(id, &data[0], data.size());
+            }
+            std::tie(immutableWorkbuffers_, std::ignore) = builder.build();
+        }
+
+        // Create MemoryModel for mutable tensors and workbuffers
+        {
+            MemoryModelBuilder builder;
+            const size_t size = 16;
+            for (int i = 0; i < mutableTensorIds_.size(); ++i) {
+                builder.addAllocation(mutableTensorIds_[i].GetId(), i, i + 2, size);
+            }
+            builder.addAllocation(mutableWorkbufferId_, 0, 0, size);
+            mutableMemoryModel_ = builder.build();
+        }
+        memoryManager_ = std::make_unique<MemoryManager>(immutableTensors_, mutableMemoryModel_, immutableWorkbuffers_);
+        allocation_ = std::make_unique<CUDA::DefaultAllocation>(
+            CUDA::DefaultStream::stream().malloc(mutableMemoryModel_->deviceMemoryBlockSize()));
+    }
+
+    CUDA::DevicePointer<void*> mutableBuffer() const { return CUDA::DevicePointer<void*>{allocation_->get()}; }
+
+    const std::vector<TensorID> sharedConstantIds_ = {TensorID{0}, TensorID{1}, TensorID{2}};
+    const std::vector<TensorID> mutableTensorIds_ = {TensorID{101}, TensorID{104}, TensorID{103}, TensorID{105}};
+    const std::vector<ov::nvidia_gpu::BufferID> immutableWorkbufferIds_ = {201, 202};
+    const ov::nvidia_gpu::BufferID mutableWorkbufferId_ = 301;
+
+    std::shared_ptr<ov::nvidia_gpu::DeviceMemBlock> immutableTensors_;
+    std::shared_ptr<ov::nvidia_gpu::DeviceMemBlock> immutableWorkbuffers_;
+    ov::nvidia_gpu::MemoryModel::Ptr mutableMemoryModel_;
+    std::unique_ptr<ov::nvidia_gpu::MemoryManager> memoryManager_;
+    std::unique_ptr<CUDA::DefaultAllocation> allocation_;
+
+public:  // ov::nvidia_gpu::IOperationMeta
+    std::vector<ov::nvidia_gpu::TensorID> inputIds_;
+    std::vector<ov::nvidia_gpu::TensorID> outputIds_;
+    const std::string& GetName() const override {
+        static std::string empty;
+        return empty;
+    }
+    const std::string& GetTypeName() const override { return GetName(); }
+    const std::string_view& GetCategory() const override {
+        static constexpr std::string_view empty{""};
+        return empty;
+    }
+
+    gsl::span<const ov::nvidia_gpu::TensorID> GetInputIds() const override { return inputIds_; }
+    gsl::span<const ov::nvidia_gpu::TensorID> GetOutputIds() const override { return outputIds_; }
+};
+
+TEST_F(ExecutionPlanTest, PointersMatchMemoryManager) {
+    using namespace ov::nvidia_gpu;
+
+    ExecutionPlan plan{*memoryManager_};
+    inputIds_ = {sharedConstantIds_[1], mutableTensorIds_[0], sharedConstantIds_[0]};
+    outputIds_ = {mutableTensorIds_[1]};
+    const WorkbufferIds firstWorkbuffers{{immutableWorkbufferIds_[1]}, {mutableWorkbufferId_}};
+    EXPECT_EQ(plan.append(*this, firstWorkbuffers), 0);
+    const auto firstInputs = memoryManager_->inputTensorPointers(*this, mutableBuffer());
+    const auto firstOutputs = memoryManager_->outputTensorPointers(*this, mutableBuffer());
+
+    inputIds_ = {mutableTensorIds_[1]};
+    outputIds_ = {mutableTensorIds_[2], mutableTensorIds_[3]};
+    EXPECT_EQ(plan.append(*this, WorkbufferIds{}), 1);
+    const auto secondInputs = memoryManager_->inputTensorPointers(*this, mutableBuffer());
+    const auto secondOutputs = memoryManager_->outputTensorPointers(*this, mutableBuffer());
+    ASSERT_EQ(plan.size(), 2);
+
+    const auto frame = plan.bind(mutableBuffer());
+    auto expectSame = [](auto actual, const auto& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].get(), expected[i].get());
+        }
+    };
+    expectSame(frame->inputs(0), firstInputs);
+    expectSame(frame->outputs(0), firstOutputs);
+    expectSame(frame->inputs(1), secondInputs);
+    expectSame(frame->outputs(1), secondOutputs);
+
+    const auto& firstWorkbuffersPtrs = frame->workbuffers(0);
+    ASSERT_EQ(firstWorkbuffersPtrs.immutable_buffers.size(), 1);
+    EXPECT_EQ(firstWorkbuffersPtrs.immutable_buffers[0].get(),
+              immutableWorkbuffers_->deviceBufferPtr(immutableWorkbufferIds_[1]));
+    ASSERT_EQ(firstWorkbuffersPtrs.mutable_buffers.size(), 1);
+    EXPECT_EQ(firstWorkbuffersPtrs.mutable_buffers[0].get(),
+              mutableMemoryModel_->deviceBufferPtr(mutableBuffer().cast<uint8_t*>(), mutableWorkbufferId_));
+    const auto& secondWorkbuffersPtrs = frame->workbuffers(1);
+    EXPECT_TRUE(secondWorkbuffersPtrs.immutable_buffers.empty());
+    EXPECT_TRUE(secondWorkbuffersPtrs.mutable_buffers.empty());
+}
+
+TEST_F(ExecutionPlanTest, FrameIsReusedForSameMutableBuffer) {
+    using namespace ov::nvidia_gpu;
+
+    ExecutionPlan plan{*memoryManager_};
+    inputIds_ = {mutableTensorIds_[0]};
+    outputIds_ = {mutableTensorIds_[1]};
+    plan.append(*this, WorkbufferIds{});
+
+    const auto frame = plan.bind(mutableBuffer());
+    EXPECT_EQ(plan.bind(mutableBuffer()), frame);
+
+    const auto otherBuffer = CUDA::DevicePointer<void*>{mutableBuffer().cast<uint8_t*>().get() + 256};
+    const auto otherFrame = plan.bind(otherBuffer);
+    EXPECT_NE(otherFrame, frame);
+    EXPECT_EQ(otherFrame->inputs(0)[0].get(), static_cast<const uint8_t*>(frame->inputs(0)[0].get()) + 256);
+
+    // Frames bound before are not reused after the plan is extended
+    plan.append(*this, WorkbufferIds{});
+    const auto extendedFrame = plan.bind(mutableBuffer());
+    EXPECT_NE(extendedFrame, frame);
+    EXPECT_EQ(extendedFrame->inputs(1)[0].get(), frame->inputs(0)[0].get());
+}
+
+TEST_F(ExecutionPlanTest, ChildTensorOffset) {
+    using namespace ov::nvidia_gpu;
+
+    ExecutionPlan plan{*memoryManager_};
+    auto parent = std::make_shared<TensorID>(mutableTensorIds_[0]);
+    TensorID child{999};
+    child.SetParent(parent, 8);
+    inputIds_ = {child};
+    outputIds_ = {};
+    plan.append(*this, WorkbufferIds{});
+
+    ptrdiff_t offset = -1;
+    ASSERT_TRUE(mutableMemoryModel_->offsetForBuffer(mutableTensorIds_[0].GetId(), offset));
+    const auto frame = plan.bind(mutableBuffer());
+    EXPECT_EQ(frame->inputs(0)[0].get(), static_cast<const uint8_t*>(allocation_->get()) + offset + 8);
+}
+
+TEST_F(ExecutionPlanTest, InvalidTensorID) {
+    using namespace ov::nvidia_gpu;
+
+    ExecutionPlan plan{*memoryManager_};
+    inputIds_ = {TensorID{9999}};
+#ifdef NDEBUG
+    ASSERT_THROW(plan.append(*this, WorkbufferIds{}), InferenceEngine::details::InferenceEngineException);
+#else
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    ASSERT_DEATH(plan.append(*this, WorkbufferIds{}), "Assertion");
+#endif
+}
+
+TEST_F(ExecutionPlanTest, ConstantsCanNotBeOutputs) {
+    using namespace ov::nvidia_gpu;
+
+    ExecutionPlan plan{*memoryManager_};
+    outputIds_ = {sharedConstantIds_[0]};
+#ifdef NDEBUG
+    ASSERT_THROW(plan.append(*this, WorkbufferIds{}), InferenceEngine::details::InferenceEngineException);
+#else
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    ASSERT_DEATH(plan.append(*this, WorkbufferIds{}), "Assertion");
+#endif
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/cuda_memory_plan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using ov::nvidia_gpu::BufferID;
+using ov::nvidia_gpu::MemoryModel;
+using ov::nvidia_gpu::MemoryPlan;
+using ov::nvidia_gpu::TensorID;
+
+namespace {
+
+MemoryPlan makePlan() {
+    auto parent = std::make_shared<TensorID>(10);
+    TensorID child{3};
+    child.SetParent(parent, 256);
+
+    MemoryPlan plan;
+    plan.nodes.push_back({"Parameter_0", {}, MemoryPlan::toTensors(std::vector<TensorID>{TensorID{1}}), {}, {}});
+    plan.nodes.push_back({"Concat_1",
+                          MemoryPlan::toTensors(std::vector<TensorID>{child, TensorID{1}}),
+                          MemoryPlan::toTensors(std::vector<TensorID>{*parent}),
+                          {{64}, {128, 32}},
+                          {{20}, {21, 22}}});
+    plan.constants = MemoryPlan::toModel(MemoryModel{512, {{4, 0}, {5, 256}}});
+    plan.mutableBuffers = MemoryPlan::toModel(MemoryModel{1024, {{1, 0}, {10, 512}, {21, 256}, {22, 384}}});
+    plan.immutableWorkbuffers = MemoryPlan::toModel(MemoryModel{256, {{20, 0}}});
+    plan.streams = 3;
+    return plan;
+}
+
+}  // namespace
+
+TEST(MemoryPlan, RoundTrip) {
+    const auto plan = makePlan();
+    std::stringstream stream;
+    plan.write(stream);
+
+    const auto loaded = MemoryPlan::read(stream);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->nodes.size(), plan.nodes.size());
+    const auto& node = loaded->nodes.at(1);
+    EXPECT_EQ(node.name, "Concat_1");
+    EXPECT_EQ(node.workbufferRequest.immutable_sizes, (std::vector<std::size_t>{64}));
+    EXPECT_EQ(node.workbufferRequest.mutable_sizes, (std::vector<std::size_t>{128, 32}));
+    EXPECT_EQ(node.workbufferIds.immutableIds, (std::vector<BufferID>{20}));
+    EXPECT_EQ(node.workbufferIds.mutableIds, (std::vector<BufferID>{21, 22}));
+
+    const auto inputs = MemoryPlan::toTensorIds(node.inputs);
+    ASSERT_EQ(inputs.size(), 2);
+    EXPECT_EQ(inputs[0].GetId(), 3);
+    EXPECT_EQ(inputs[0].GetBuffer().GetId(), 10);
+    EXPECT_EQ(inputs[0].GetOffset(), 256);
+    EXPECT_EQ(inputs[1].GetBuffer().GetId(), 1);
+    EXPECT_EQ(inputs[1].GetOffset(), 0);
+
+    const auto mutableModel = MemoryPlan::toMemoryModel(loaded->mutableBuffers);
+    EXPECT_EQ(mutableModel->deviceMemoryBlockSize(), 1024);
+    ptrdiff_t offset = -1;
+    ASSERT_TRUE(mutableModel->offsetForBuffer(22, offset));
+    EXPECT_EQ(offset, 384);
+    EXPECT_EQ(MemoryPlan::toMemoryModel(loaded->constants)->bufferIds(), (std::vector<BufferID>{4, 5}));
+    EXPECT_EQ(MemoryPlan::toMemoryModel(loaded->immutableWorkbuffers)->deviceMemoryBlockSize(), 256);
+    EXPECT_EQ(loaded->streams, 3);
+}
+
+TEST(MemoryPlan, ReadWithoutPlan) {
+    std::stringstream stream;
+    EXPECT_FALSE(MemoryPlan::read(stream).has_value());
+}
+
+TEST(MemoryPlan, ReadWithoutPlanKeepsPosition) {
+    const std::string data = "not a memory plan";
+    std::stringstream stream{data};
+    EXPECT_FALSE(MemoryPlan::read(stream).has_value());
+    std::string rest;
+    std::getline(stream, rest);
+    EXPECT_EQ(rest, data);
+}
+
+TEST(MemoryPlan, FixedLayout) {
+    MemoryPlan plan;
+    plan.nodes.push_back({"", MemoryPlan::toTensors(std::vector<TensorID>{TensorID{1}}), {}, {}, {}});
+    std::stringstream stream;
+    plan.write(stream);
+    // magic, version, payload size, then node count, name size, input count, input of 3 x 4 bytes,
+    // output count, 4 empty vectors, 3 empty models and streams
+    constexpr std::size_t kHeaderSize = 8 + 4 + 8;
+    constexpr std::size_t kPayloadSize = 8 + 8 + 8 + 12 + 8 + 4 * 8 + 3 * (8 + 8) + 4;
+    EXPECT_EQ(stream.str().size(), kHeaderSize + kPayloadSize);
+}
+
+TEST(MemoryPlan, ReadOtherVersion) {
+    std::stringstream stream;
+    makePlan().write(stream);
+    auto data = stream.str();
+    data[8] = static_cast<char>(MemoryPlan::kVersion + 1);  // version goes right after 8 bytes of magic
+    std::stringstream otherVersion{data};
+    EXPECT_FALSE(MemoryPlan::read(otherVersion).has_value());
+}
+
+TEST(MemoryPlan, ReadCorruptedSizeThrows) {
+    std::stringstream stream;
+    makePlan().write(stream);
+    auto data = stream.str();
+    // Node count goes right after magic, version and payload size
+    const std::uint64_t hugeSize = std::uint64_t{1} << 60;
+    data.replace(8 + 4 + 8, sizeof(hugeSize), reinterpret_cast<const char*>(&hugeSize), sizeof(hugeSize));
+    std::stringstream corrupted{data};
+    EXPECT_THROW(MemoryPlan::read(corrupted), InferenceEngine::Exception);
+}
+
+TEST(MemoryPlan, ReadTruncatedThrows) {
+    std::stringstream stream;
+    makePlan().write(stream);
+    auto data = stream.str();
+    data.resize(data.size() / 2);
+    std::stringstream truncated{data};
+    EXPECT_THROW(MemoryPlan::read(truncated), InferenceEngine::Exception);
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "memory_manager/model/details/cuda_memory_solver.hpp"
+
+namespace {
+
+using Box = ov::nvidia_gpu::MemorySolver::Box;
+using Backend = ov::nvidia_gpu::MemorySolver::Backend;
+
+/**
+ * Synthetic graph: mostly short lived tensors of a linear chain with some
+ * long living skip connections and a few tensors alive till the end.
+ */
+std::vector<Box> syntheticBoxes(int num) {
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> short_lifespan{1, 4};
+    std::uniform_int_distribution<int> long_lifespan{16, 256};
+    std::uniform_int_distribution<int> kind{0, 99};
+    std::uniform_int_distribution<int64_t> size{1, 1024};
+    std::vector<Box> boxes;
+    boxes.reserve(num);
+    for (int i = 0; i < num; i++) {
+        const int k = kind(gen);
+        const int finish = k == 0 ? -1 : i + (k < 10 ? long_lifespan(gen) : short_lifespan(gen));
+        boxes.push_back({i, finish, size(gen) * 256, i});
+    }
+    return boxes;
+}
+
+TEST(MemorySolverBenchmark, DISABLED_benchmark) {
+    using milliseconds = std::chrono::duration<double, std::milli>;
+    constexpr int kMaxTimeSlotsBoxes = 10000;
+
+    for (int num : {1000, 10000, 100000}) {
+        const auto boxes = syntheticBoxes(num);
+        for (auto backend : {Backend::TimeSlots, Backend::OccupancyTree}) {
+            // TimeSlots backend takes too long on bigger graphs
+            if (backend == Backend::TimeSlots && num > kMaxTimeSlotsBoxes) continue;
+            auto start = std::chrono::steady_clock::now();
+            ov::nvidia_gpu::MemorySolver solver{boxes};
+            const auto blob_size = solver.solve(backend);
+            auto end = std::chrono::steady_clock::now();
+            std::cout << std::fixed << std::setprecision(3) << "Boxes: " << num
+                      << " Backend: " << (backend == Backend::TimeSlots ? "TimeSlots" : "OccupancyTree")
+                      << " Blob size: " << blob_size << " Planning time: " << milliseconds{end - start}.count()
+                      << " milliseconds\n";
+        }
+    }
+}
+
+}  // namespace
@@ -91,6 +91,47 @@ TEST(MemoryModelBuilder, Build) {
     EXPECT_EQ(model->deviceMemoryBlockSize(), 2 * allocation_size);
 }
 
+TEST(MemoryModelBuilder, PlanningReport) {
+    using namespace ov::nvidia_gpu;
+
+    MemoryModelBuilder builder;
+    const size_t size = 1;
+    const size_t allocation_size = applyAllignment(size);
+    builder.addAllocation(0, 0, 1, size);
+    builder.addAllocation(1, 1, 2, size);
+    builder.addAllocation(2, 2, 3, size);
+    builder.addAllocation(3, 3, 4, size);
+
+    MemoryModel::Ptr model = builder.build();
+    const auto& report = builder.planningReport();
+    EXPECT_EQ(report.planner, "GreedyBySize");
+    EXPECT_EQ(report.blobSize, model->deviceMemoryBlockSize());
+    EXPECT_EQ(report.lowerBound, 2 * allocation_size);
+}
+
+/*
+ * Same as MemSolverTest.DISABLED_Unefficiency, but MemoryModelBuilder
+ * with all planners is expected to find the optimal solution with one of them.
+ * The default builder keeps the greedy solution.
+ */
+TEST(MemoryModelBuilder, KeepsSmallestPlan) {
+    using namespace ov::nvidia_gpu;
+
+    const size_t unit = applyAllignment(1);
+    MemoryModelBuilder greedy_builder;
+    MemoryModelBuilder builder{allMemoryPlanners()};
+    for (auto* b : {&greedy_builder, &builder}) {
+        b->addAllocation(0, 6, 7, 3 * unit);
+        b->addAllocation(1, 2, 5, 2 * unit);
+        b->addAllocation(2, 5, 8, 2 * unit);
+        b->addAllocation(3, 2, 3, 2 * unit);
+    }
+
+    EXPECT_EQ(greedy_builder.build()->deviceMemoryBlockSize(), 6 * unit);
+    EXPECT_EQ(builder.build()->deviceMemoryBlockSize(), 5 * unit);
+    EXPECT_EQ(builder.planningReport().lowerBound, 5 * unit);
+}
+
 TEST(MemoryModelBuilder, HandleDuplicateAllocation) {
     using namespace ov::nvidia_gpu;
 
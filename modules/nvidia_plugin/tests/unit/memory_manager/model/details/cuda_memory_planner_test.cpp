@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/model/details/cuda_memory_planner.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "memory_manager/model/details/cuda_memory_interval_tree.hpp"
+
+using Box = ov::nvidia_gpu::MemorySolver::Box;
+using ov::nvidia_gpu::MemoryPlanner;
+
+namespace {
+
+void expectNoOverlapping(const std::vector<Box>& boxes, const MemoryPlanner::Offsets& offsets, int64_t blobSize) {
+    int max_ts = 0;
+    for (const auto& box : boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
+    auto finish = [max_ts](const Box& box) { return box.finish == -1 ? max_ts : box.finish; };
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        const auto off1 = offsets.at(boxes[i].id);
+        ASSERT_GE(off1, 0);
+        ASSERT_LE(off1 + boxes[i].size, blobSize);
+        for (std::size_t j = i + 1; j < boxes.size(); j++) {
+            const auto off2 = offsets.at(boxes[j].id);
+            const bool no_overlap = finish(boxes[i]) < boxes[j].start || boxes[i].start > finish(boxes[j]) ||
+                                    off1 + boxes[i].size <= off2 || off1 >= off2 + boxes[j].size;
+            ASSERT_TRUE(no_overlap) << "Box overlapping is detected";
+        }
+    }
+}
+
+std::vector<Box> randomBoxes(std::size_t num, int maxLifespan, unsigned seed) {
+    std::mt19937 gen{seed};
+    std::uniform_int_distribution<int> lifespan{0, maxLifespan};
+    std::uniform_int_distribution<int64_t> size{1, 64};
+    std::vector<Box> boxes;
+    for (std::size_t i = 0; i < num; i++) {
+        const int start = static_cast<int>(i);
+        boxes.push_back({start, start + lifespan(gen), size(gen), static_cast<int64_t>(i)});
+    }
+    return boxes;
+}
+
+}  // namespace
+
+TEST(TimeIntervalTreeTest, QueryInsertedOnly) {
+    ov::nvidia_gpu::TimeIntervalTree tree{{{0, 2}, {1, 1}, {3, 5}, {4, 4}}};
+    std::vector<std::size_t> result;
+    tree.query(0, 5, result);
+    EXPECT_TRUE(result.empty());
+
+    tree.insert(0);
+    tree.insert(2);
+    tree.query(1, 3, result);
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(result, (std::vector<std::size_t>{0, 2}));
+
+    result.clear();
+    tree.erase(0);
+    tree.insert(1);
+    tree.query(0, 1, result);
+    EXPECT_EQ(result, (std::vector<std::size_t>{1}));
+}
+
+TEST(MemoryPlannerTest, AllPlannersProduceValidPlacement) {
+    const auto boxes = randomBoxes(200, 20, 42);
+    for (const auto& planner : ov::nvidia_gpu::allMemoryPlanners()) {
+        MemoryPlanner::Offsets offsets;
+        const auto blobSize = planner->plan(boxes, offsets);
+        if (blobSize < 0) continue;  // planner gave up
+        SCOPED_TRACE(planner->name());
+        EXPECT_GE(blobSize, ov::nvidia_gpu::MemorySolver{boxes}.maxDepth());
+        expectNoOverlapping(boxes, offsets, blobSize);
+    }
+}
+
+TEST(MemoryPlannerTest, ToEndBoxes) {
+    const std::vector<Box> boxes{
+        {0, 1, 2, 0},
+        {1, -1, 2, 1},
+        {3, 3, 2, 2},
+        {3, -1, 2, 3},
+        {3, 4, 2, 4},
+    };
+    for (const auto& planner : ov::nvidia_gpu::allMemoryPlanners()) {
+        SCOPED_TRACE(planner->name());
+        MemoryPlanner::Offsets offsets;
+        const auto blobSize = planner->plan(boxes, offsets);
+        EXPECT_EQ(blobSize, 8);
+        expectNoOverlapping(boxes, offsets, blobSize);
+    }
+}
+
+TEST(MemoryPlannerTest, GreedyBySizeMatchesMemorySolver) {
+    const auto boxes = randomBoxes(100, 10, 7);
+    ov::nvidia_gpu::MemorySolver ms{boxes};
+    const auto expectedSize = ms.solve();
+
+    MemoryPlanner::Offsets offsets;
+    EXPECT_EQ(ov::nvidia_gpu::GreedyBySizePlanner{}.plan(boxes, offsets), expectedSize);
+    for (const auto& box : boxes) EXPECT_EQ(offsets.at(box.id), ms.getOffset(box.id));
+}
+
+TEST(MemoryPlannerTest, BranchAndBoundFindsOptimum) {
+    //  The case MemorySolver doesn't solve optimally (see MemSolverTest.DISABLED_Unefficiency)
+    const std::vector<Box> boxes{
+        {6, 7, 3, 0},
+        {2, 5, 2, 1},
+        {5, 8, 2, 2},
+        {2, 3, 2, 3},
+    };
+    MemoryPlanner::Offsets offsets;
+    const auto blobSize = ov::nvidia_gpu::BranchAndBoundPlanner{}.plan(boxes, offsets);
+    EXPECT_EQ(blobSize, 5);
+    expectNoOverlapping(boxes, offsets, blobSize);
+}
+
+TEST(MemoryPlannerTest, BranchAndBoundGivesUpOnBigGraphs) {
+    const auto boxes = randomBoxes(ov::nvidia_gpu::BranchAndBoundPlanner::kDefaultMaxBoxes + 1, 3, 1);
+    MemoryPlanner::Offsets offsets;
+    EXPECT_EQ(ov::nvidia_gpu::BranchAndBoundPlanner{}.plan(boxes, offsets), -1);
+}
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
 #include <vector>
 
 #include "details/ie_exception.hpp"
@@ -282,3 +283,24 @@ TEST(MemSolverTest, BestSolution1) {
     for (int i = 0; i < n; i++)
         for (int j = i + 1; j < n; j++) ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+TEST(MemSolverTest, BackendsProduceSameOffsets) {
+    using Backend = ov::nvidia_gpu::MemorySolver::Backend;
+
+    std::mt19937 gen{2022};
+    std::uniform_int_distribution<int> lifespan{0, 16};
+    std::uniform_int_distribution<int> gap{0, 2};
+    std::uniform_int_distribution<int64_t> size{1, 8};
+    std::vector<Box> boxes;
+    int start = 0;
+    for (int id = 0; id < 500; id++) {
+        start += gap(gen);
+        const int finish = id % 50 == 0 ? -1 : start + lifespan(gen);
+        boxes.push_back({start, finish, size(gen), id});
+    }
+
+    ov::nvidia_gpu::MemorySolver slots_ms(boxes);
+    ov::nvidia_gpu::MemorySolver occupancy_ms(boxes);
+    EXPECT_EQ(slots_ms.solve(Backend::TimeSlots), occupancy_ms.solve(Backend::OccupancyTree));
+    for (const auto &box : boxes) EXPECT_EQ(slots_ms.getOffset(box.id), occupancy_ms.getOffset(box.id));
+}
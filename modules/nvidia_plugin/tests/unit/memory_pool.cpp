@@ -7,10 +7,12 @@
 #include <condition_variable>
 #include <cuda_executable_network.hpp>
 #include <cuda_plugin.hpp>
+#include <future>
 #include <memory>
 #include <memory_manager/model/cuda_memory_model.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/node.hpp>
+#include <thread>
 #include <threading/ie_executor_manager.hpp>
 #include <typeinfo>
 
@@ -47,3 +49,103 @@ TEST_F(MemoryPoolTest, MemoryManagerProxy_Success) {
     }
     ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 2);
 }
+
+TEST_F(MemoryPoolTest, ElasticMemoryPool_GrowsOnDemand) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, 3, 0ms, memoryModel);
+    ASSERT_EQ(memoryPool->Size(), 3);
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 1);
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 1);
+    {
+        auto memoryManagerProxy0 = memoryPool->WaitAndGet(cancellationToken);
+        auto memoryManagerProxy1 = memoryPool->WaitAndGet(cancellationToken);
+        auto memoryManagerProxy2 = memoryPool->WaitAndGet(cancellationToken);
+        ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 0);
+        const auto statistics = memoryPool->GetStatistics();
+        ASSERT_EQ(statistics.numAllocated, 3);
+        ASSERT_EQ(statistics.numInUse, 3);
+    }
+    // Idle timeout is not set, so all blocks are kept
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 3);
+    const auto statistics = memoryPool->GetStatistics();
+    ASSERT_EQ(statistics.numInUse, 0);
+    ASSERT_EQ(statistics.peakInUse, 3);
+    ASSERT_EQ(statistics.numRequests, 3);
+    ASSERT_EQ(statistics.numWaits, 0);
+}
+
+TEST_F(MemoryPoolTest, ElasticMemoryPool_ReleasesIdleBlocks) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, 3, 1ms, memoryModel);
+    {
+        auto memoryManagerProxy0 = memoryPool->WaitAndGet(cancellationToken);
+        auto memoryManagerProxy1 = memoryPool->WaitAndGet(cancellationToken);
+        auto memoryManagerProxy2 = memoryPool->WaitAndGet(cancellationToken);
+    }
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 3);
+    std::this_thread::sleep_for(10ms);
+    // Releasing is lazy, so idle blocks are kept until the pool is used again
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 3);
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 3);
+    { auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken); }
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 1);
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 1);
+}
+
+TEST_F(MemoryPoolTest, MemoryPool_ResizeUp) {
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    memoryPool->Resize(2);
+    ASSERT_EQ(memoryPool->Size(), 2);
+    auto memoryManagerProxy0 = memoryPool->WaitAndGet(cancellationToken);
+    auto memoryManagerProxy1 = memoryPool->WaitAndGet(cancellationToken);
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 2);
+}
+
+TEST_F(MemoryPoolTest, MemoryPool_ResizeUpWakesWaiters) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+    auto waiter = std::async(std::launch::async, [&memoryPool] {
+        CancellationToken token{};
+        auto proxy = memoryPool->WaitAndGet(token);
+    });
+    ASSERT_EQ(waiter.wait_for(10ms), std::future_status::timeout);
+    memoryPool->Resize(2);
+    // The waiter allocates a new block while the first one is still in use
+    ASSERT_EQ(waiter.wait_for(1s), std::future_status::ready);
+    waiter.get();
+    ASSERT_EQ(memoryPool->GetStatistics().numAllocated, 2);
+}
+
+TEST_F(MemoryPoolTest, MemoryPool_WaitsAreCounted) {
+    using namespace std::chrono_literals;
+    CancellationToken cancellationToken{};
+    std::unordered_map<BufferID, ptrdiff_t> offsets;
+    auto memoryModel = std::make_shared<MemoryModel>(1000, offsets);
+    auto memoryPool = std::make_shared<MemoryPool>(1, memoryModel);
+    auto memoryManagerProxy = std::make_unique<MemoryPool::Proxy>(memoryPool->WaitAndGet(cancellationToken));
+    auto waiter = std::async(std::launch::async, [&memoryPool] {
+        CancellationToken token{};
+        auto proxy = memoryPool->WaitAndGet(token);
+    });
+    std::this_thread::sleep_for(10ms);
+    memoryManagerProxy.reset();
+    waiter.get();
+    const auto statistics = memoryPool->GetStatistics();
+    ASSERT_EQ(statistics.numRequests, 2);
+    ASSERT_EQ(statistics.numWaits, 1);
+    ASSERT_GE(statistics.maxWaitTime, 5ms);
+    ASSERT_GE(statistics.totalWaitTime, statistics.maxWaitTime);
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cuda_op_buffers_extractor.hpp>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <vector>
+
+namespace {
+
+/**
+ * Creates a graph of the given number of nodes: a chain of Add nodes with a
+ * constant addend and a residual connection to the node two steps back, with
+ * a Reshape on every 8th step
+ */
+std::shared_ptr<ngraph::Function> createChainFunction(std::size_t numNodes) {
+    using namespace ngraph;
+    const ov::Shape shape{1, 64};
+    auto input = std::make_shared<opset1::Parameter>(ov::element::f32, shape);
+    const auto addend = std::vector<float>(ov::shape_size(shape), 0.5f);
+    const auto pattern = std::vector<int64_t>{1, 64};
+    ov::Output<ov::Node> previous = input;
+    ov::Output<ov::Node> current = input;
+    std::size_t nodes = 1;
+    for (std::size_t step = 1; nodes < numNodes; step++) {
+        ov::Output<ov::Node> next;
+        if (step % 8 == 0) {
+            auto reshapePattern = std::make_shared<opset1::Constant>(ov::element::i64, ov::Shape{2}, pattern);
+            next = std::make_shared<opset1::Reshape>(current, reshapePattern, false);
+            nodes += 2;
+        } else {
+            auto constant = std::make_shared<opset1::Constant>(ov::element::f32, shape, addend);
+            auto add = std::make_shared<opset1::Add>(current, constant);
+            next = std::make_shared<opset1::Add>(add, previous);
+            nodes += 3;
+        }
+        previous = current;
+        current = next;
+    }
+    auto result = std::make_shared<opset1::Result>(current);
+    return std::make_shared<ngraph::Function>(ov::ResultVector{result}, ov::ParameterVector{input}, "Chain");
+}
+
+TEST(OperationBuffersExtractorBenchmark, DISABLED_benchmark) {
+    using milliseconds = std::chrono::duration<double, std::milli>;
+    constexpr int kNumAttempts = 10;
+
+    for (std::size_t numNodes : {2000, 20000, 100000}) {
+        const auto function = createChainFunction(numNodes);
+        const auto orderedNodes = function->get_ordered_ops();
+        std::size_t numBuffers = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kNumAttempts; i++) {
+            ov::nvidia_gpu::OperationBuffersExtractor extractor{orderedNodes};
+            for (const auto& node : orderedNodes) {
+                numBuffers += extractor.inputTensorIds(*node).size() + extractor.outputTensorIds(*node).size();
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::cout << std::fixed << std::setprecision(3) << "Nodes: " << orderedNodes.size()
+                  << " Tensors: " << numBuffers / kNumAttempts
+                  << " Extraction time: " << milliseconds{end - start}.count() / kNumAttempts << " milliseconds\n";
+    }
+}
+
+}  // namespace
@@ -11,6 +11,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <stdexcept>
 #include <transformer/nodes/concat_optimized.hpp>
+#include <transformer/nodes/split_optimized.hpp>
 #include <vector>
 
 /*
@@ -579,3 +580,210 @@ TEST_F(OperationBufferExtractorConcatOptimizedV2Test, CheckImmutableBuffersIndic
                             OutputBufferIndex::Constant_Adder_1,
                             OutputBufferIndex::Constant_Reshape_1_Pattern));
 }
+
+class OperationBufferExtractorInPlaceTest : public testing::Test {
+    /**
+     * Creates a graph with the following structure (left to right):
+     * ```
+     * Parameter                     ____________________
+     *          \                   /                    \
+     *            Add --> Relu -----                      Add --> Result
+     *          /                   \                    /
+     *   Constant                     ---> Sigmoid ----->
+     *    (Bias)
+     * ```
+     * Add, Relu and Sigmoid are in-place capable
+     */
+    void SetUp() override {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, ov::Shape({3}));
+
+        std::vector<float> bias_values = {-0.03, 0.13, 0.65};
+        auto bias = std::make_shared<ngraph::opset1::Constant>(ov::element::f32, ov::Shape{3}, bias_values);
+
+        auto add_0 = std::make_shared<ngraph::opset1::Add>(input, bias);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add_0);
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(relu);
+        auto add_1 = std::make_shared<ngraph::opset1::Add>(sigmoid, relu);
+
+        ov::ParameterVector inputs{input};
+        ov::NodeVector outputs{add_1};
+        ngraph_function_ = std::make_unique<ngraph::Function>(outputs, inputs, "InPlaceGraph");
+        exec_sequence_ = ngraph_function_->get_ordered_ops();
+    }
+
+protected:
+    using TensorID = ov::nvidia_gpu::TensorID;
+
+    struct OpIndex {
+        using Type = size_t;
+        constexpr static Type Parameter = 0;
+        constexpr static Type Constant_Bias = 1;
+        constexpr static Type Add_0 = 2;
+        constexpr static Type Relu = 3;
+        constexpr static Type Sigmoid = 4;
+        constexpr static Type Add_1 = 5;
+        constexpr static Type Result = 6;
+    };
+
+    struct OutputBufferIndex {
+        using Type = unsigned;
+        constexpr static Type Parameter = 0;
+        constexpr static Type Constant_Bias = 1;
+        constexpr static Type Add_0 = 2;
+        constexpr static Type Relu = 3;
+        constexpr static Type Sigmoid = 4;
+        constexpr static Type Add_1 = 5;
+    };
+
+    void createExtractor(bool is_stable_params, bool is_in_place_enabled) {
+        ov::nvidia_gpu::OperationBuffersExtractor::InPlacePredicate is_in_place_capable;
+        if (is_in_place_enabled) {
+            is_in_place_capable = [](const ov::Node& node) {
+                using namespace ngraph;
+                return is_type<opset1::Add>(&node) || is_type<opset1::Relu>(&node) || is_type<opset1::Sigmoid>(&node);
+            };
+        }
+        extractor_ = std::make_unique<ov::nvidia_gpu::OperationBuffersExtractor>(
+            exec_sequence_, is_stable_params, false, is_in_place_capable);
+    }
+
+    std::vector<TensorID> inputBufferIndices(OpIndex::Type op_idx) {
+        return extractor_->inputTensorIds(*exec_sequence_.at(op_idx));
+    }
+
+    std::vector<TensorID> outputBufferIndices(OpIndex::Type op_idx) {
+        return extractor_->outputTensorIds(*exec_sequence_.at(op_idx));
+    }
+
+protected:
+    std::unique_ptr<ngraph::Function> ngraph_function_;
+    std::vector<std::shared_ptr<ov::Node>> exec_sequence_;
+    std::unique_ptr<ov::nvidia_gpu::OperationBuffersExtractor> extractor_;
+};
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckTestIntegrity) {
+    using namespace ngraph;
+    EXPECT_TRUE(is_type<opset1::Parameter>(exec_sequence_.at(OpIndex::Parameter)));
+    EXPECT_TRUE(is_type<opset1::Constant>(exec_sequence_.at(OpIndex::Constant_Bias)));
+    EXPECT_TRUE(is_type<opset1::Add>(exec_sequence_.at(OpIndex::Add_0)));
+    EXPECT_TRUE(is_type<opset1::Relu>(exec_sequence_.at(OpIndex::Relu)));
+    EXPECT_TRUE(is_type<opset1::Sigmoid>(exec_sequence_.at(OpIndex::Sigmoid)));
+    EXPECT_TRUE(is_type<opset1::Add>(exec_sequence_.at(OpIndex::Add_1)));
+    EXPECT_TRUE(is_type<opset1::Result>(exec_sequence_.at(OpIndex::Result)));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckMutableBuffersIndicesWithoutInPlace) {
+    using ::testing::ElementsAre;
+    createExtractor(false, false);
+    auto buffer_indices = extractor_->mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices,
+                ElementsAre(OutputBufferIndex::Parameter,
+                            OutputBufferIndex::Add_0,
+                            OutputBufferIndex::Relu,
+                            OutputBufferIndex::Sigmoid,
+                            OutputBufferIndex::Add_1));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckDyingInputsAreReused) {
+    using ::testing::ElementsAre;
+    createExtractor(false, true);
+    // Parameter buffer goes through Add_0 and Relu, Relu is still needed by Add_1, so Sigmoid allocates
+    // the next buffer, which is reused by Add_1
+    constexpr OutputBufferIndex::Type sigmoidBuffer = 2;
+    auto buffer_indices = extractor_->mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices, ElementsAre(OutputBufferIndex::Parameter, sigmoidBuffer));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Add_0), ElementsAre(TensorID{OutputBufferIndex::Parameter}));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Relu), ElementsAre(TensorID{OutputBufferIndex::Parameter}));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Sigmoid), ElementsAre(TensorID{sigmoidBuffer}));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Add_1), ElementsAre(TensorID{sigmoidBuffer}));
+    ASSERT_THAT(inputBufferIndices(OpIndex::Add_1),
+                ElementsAre(TensorID{sigmoidBuffer}, TensorID{OutputBufferIndex::Parameter}));
+
+    ASSERT_EQ(extractor_->mutableBufferLifespanStart(OutputBufferIndex::Parameter), OpIndex::Parameter);
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(OutputBufferIndex::Parameter), OpIndex::Add_1);
+    ASSERT_EQ(extractor_->mutableBufferLifespanStart(sigmoidBuffer), OpIndex::Sigmoid);
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(sigmoidBuffer), OpIndex::Result);
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckStableParametersAreNotReused) {
+    using ::testing::ElementsAre;
+    createExtractor(true, true);
+    // Add_0 allocates a new buffer instead of the stable Parameter one, Relu reuses it
+    constexpr OutputBufferIndex::Type add0Buffer = 2;
+    constexpr OutputBufferIndex::Type sigmoidBuffer = 3;
+    auto buffer_indices = extractor_->mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices, ElementsAre(OutputBufferIndex::Parameter, add0Buffer, sigmoidBuffer));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Relu), ElementsAre(TensorID{add0Buffer}));
+    ASSERT_THAT(outputBufferIndices(OpIndex::Add_1), ElementsAre(TensorID{sigmoidBuffer}));
+}
+
+class OperationBufferExtractorSplitOptimizedTest : public testing::Test {
+    /**
+     * Creates a graph with the following structure (left to right):
+     * ```
+     *                             ----> Add --> Result
+     * Parameter --> SplitOptimized ---/
+     *             /               \
+     *     Constant                  ----------> Result
+     *      (Axis)
+     * ```
+     */
+    void SetUp() override {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ov::element::f32, ov::Shape({6, 2}));
+        auto axis = std::make_shared<ngraph::opset1::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{0});
+        split_ = std::make_shared<ov::nvidia_gpu::nodes::SplitOptimized>(input, axis, 3);
+        add_ = std::make_shared<ngraph::opset1::Add>(split_->output(0), split_->output(1));
+        auto result_0 = std::make_shared<ngraph::opset1::Result>(add_);
+        auto result_1 = std::make_shared<ngraph::opset1::Result>(split_->output(2));
+        ngraph_function_ = std::make_unique<ngraph::Function>(
+            ov::ResultVector{result_0, result_1}, ov::ParameterVector{input}, "SplitOptimizedGraph");
+        exec_sequence_ = ngraph_function_->get_ordered_ops();
+        extractor_ = std::make_unique<ov::nvidia_gpu::OperationBuffersExtractor>(exec_sequence_);
+    }
+
+protected:
+    using TensorID = ov::nvidia_gpu::TensorID;
+
+    int nodeIndex(const std::shared_ptr<ov::Node>& node) const {
+        return std::distance(exec_sequence_.begin(), std::find(exec_sequence_.begin(), exec_sequence_.end(), node));
+    }
+
+    std::unique_ptr<ngraph::Function> ngraph_function_;
+    std::vector<std::shared_ptr<ov::Node>> exec_sequence_;
+    std::shared_ptr<ov::Node> split_;
+    std::shared_ptr<ov::Node> add_;
+    std::unique_ptr<ov::nvidia_gpu::OperationBuffersExtractor> extractor_;
+};
+
+TEST_F(OperationBufferExtractorSplitOptimizedTest, CheckOutputsAreViewsOfInput) {
+    const auto inputs = extractor_->inputTensorIds(*split_);
+    const auto outputs = extractor_->outputTensorIds(*split_);
+    ASSERT_EQ(outputs.size(), 3);
+    const auto outputSize = ov::nvidia_gpu::OperationBuffersExtractor::GetTensorByteSize(split_->output(0));
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        EXPECT_EQ(outputs[i].GetBuffer().GetId(), inputs[0].GetBuffer().GetId());
+        EXPECT_EQ(outputs[i].GetOffset(), i * outputSize);
+    }
+    const auto addInputs = extractor_->inputTensorIds(*add_);
+    ASSERT_EQ(addInputs.size(), 2);
+    EXPECT_EQ(addInputs[0].GetOffset(), 0);
+    EXPECT_EQ(addInputs[1].GetOffset(), outputSize);
+}
+
+TEST_F(OperationBufferExtractorSplitOptimizedTest, CheckInputBufferLifespanCoversViews) {
+    using ::testing::ElementsAre;
+    const auto inputBuffer = extractor_->inputTensorIds(*split_)[0].GetBuffer().GetId();
+    const auto addBuffer = extractor_->outputTensorIds(*add_)[0].GetBuffer().GetId();
+    auto buffer_indices = extractor_->mutableBuffersIds();
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    ASSERT_THAT(buffer_indices, ElementsAre(inputBuffer, addBuffer));
+
+    int lastViewUse = nodeIndex(add_);
+    for (const auto& input : split_->output(2).get_target_inputs()) {
+        lastViewUse = std::max(lastViewUse, nodeIndex(input.get_node()->shared_from_this()));
+    }
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(inputBuffer), lastViewUse);
+}
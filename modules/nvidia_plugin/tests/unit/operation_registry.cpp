@@ -5,8 +5,14 @@
 #include <gtest/gtest.h>
 
 #include <cuda_operation_registry.hpp>
+#include <error.hpp>
 #include <memory>
 #include <ngraph/node.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/parameter.hpp>
+#include <ops/add_cuda.hpp>
+#include <ops/add_cudnn.hpp>
+#include <ops/eltwise_cost_model.hpp>
 #include <ops/parameter.hpp>
 #include <typeinfo>
 #include <vector>
@@ -89,3 +95,110 @@ TEST_F(OperationRegistryTest, BuildOperationAndCheckTenorIds_Success) {
     ASSERT_EQ(std::vector<TensorID>(inputIds.begin(), inputIds.end()), dummyInputBufferIds);
     ASSERT_EQ(std::vector<TensorID>(outputIds.begin(), outputIds.end()), dummyOutputBufferIds);
 }
+
+namespace {
+
+std::shared_ptr<ov::Node> makeAdd(const ov::Shape& shape0, const ov::Shape& shape1) {
+    return std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape0),
+                                             std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape1));
+}
+
+}  // namespace
+
+TEST(EltwiseCostModelTest, SmallTensorPrefersCudaKernel) {
+    const auto add = makeAdd({1, 16, 8, 8}, {1, 16, 8, 8});
+    ASSERT_LT(EltwiseCostModel::cudaKernel(*add), EltwiseCostModel::cudnn(*add));
+}
+
+TEST(EltwiseCostModelTest, LargeTensorPrefersCuDnn) {
+    const auto add = makeAdd({8, 64, 128, 128}, {8, 64, 128, 128});
+    ASSERT_GT(EltwiseCostModel::cudaKernel(*add), EltwiseCostModel::cudnn(*add));
+}
+
+TEST(EltwiseCostModelTest, BroadcastMakesCudaKernelMoreExpensive) {
+    const auto plain = makeAdd({1, 64, 64, 64}, {1, 64, 64, 64});
+    const auto broadcast = makeAdd({1, 64, 64, 64}, {1, 64, 1, 1});
+    ASSERT_LT(EltwiseCostModel::cudnn(*broadcast), EltwiseCostModel::cudnn(*plain));
+    ASSERT_GT(EltwiseCostModel::cudaKernel(*broadcast) - EltwiseCostModel::cudnn(*broadcast),
+              EltwiseCostModel::cudaKernel(*plain) - EltwiseCostModel::cudnn(*plain));
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_DefaultIsCuDnn) {
+    for (const auto& shape : {ov::Shape{2, 3}, ov::Shape{8, 64, 128, 128}}) {
+        const auto add = makeAdd(shape, shape);
+        OperationRegistry::Selection selection;
+        auto operation = OperationRegistry::getInstance().createOperation(
+            CreationContext{device_, optimizeOption},
+            add,
+            std::vector<TensorID>{TensorID{0}, TensorID{1}},
+            std::vector<TensorID>{TensorID{2}},
+            &selection);
+        ASSERT_TRUE(std::dynamic_pointer_cast<AddCuDnnOp>(operation));
+        ASSERT_EQ(selection.implementation, "cudnn");
+        ASSERT_EQ(selection.reason, "registration order");
+    }
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_CostModel) {
+    const auto add = makeAdd({2, 3}, {2, 3});
+    OperationRegistry::Selection selection;
+    auto operation = OperationRegistry::getInstance().createOperation(
+        CreationContext{device_, optimizeOption, {}, 1, false, true},
+        add,
+        std::vector<TensorID>{TensorID{0}, TensorID{1}},
+        std::vector<TensorID>{TensorID{2}},
+        &selection);
+    ASSERT_TRUE(std::dynamic_pointer_cast<AddCudaOp>(operation));
+    ASSERT_EQ(selection.implementation, "cuda");
+    ASSERT_EQ(selection.reason.rfind("cost model", 0), 0u);
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_Configuration) {
+    const auto add = makeAdd({2, 3}, {2, 3});
+    OperationRegistry::Selection selection;
+    auto operation = OperationRegistry::getInstance().createOperation(
+        CreationContext{device_, optimizeOption, {{"Add", "cudnn"}}},
+        add,
+        std::vector<TensorID>{TensorID{0}, TensorID{1}},
+        std::vector<TensorID>{TensorID{2}},
+        &selection);
+    ASSERT_TRUE(std::dynamic_pointer_cast<AddCuDnnOp>(operation));
+    ASSERT_EQ(selection.implementation, "cudnn");
+    ASSERT_EQ(selection.reason, "configuration");
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_FallbackWhenNotSupported) {
+    // cuDNN doesn't support broadcasting of both inputs
+    const auto add = makeAdd({2, 1}, {1, 3});
+    OperationRegistry::Selection selection;
+    auto operation = OperationRegistry::getInstance().createOperation(
+        CreationContext{device_, optimizeOption, {{"Add", "cudnn"}}},
+        add,
+        std::vector<TensorID>{TensorID{0}, TensorID{1}},
+        std::vector<TensorID>{TensorID{2}},
+        &selection);
+    ASSERT_TRUE(std::dynamic_pointer_cast<AddCudaOp>(operation));
+    ASSERT_EQ(selection.implementation, "cuda");
+    ASSERT_NE(selection.reason.find("failed"), std::string::npos);
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_UnknownImplementation) {
+    const auto add = makeAdd({2, 3}, {2, 3});
+    ASSERT_THROW(OperationRegistry::getInstance().createOperation(
+                     CreationContext{device_, optimizeOption, {{"Add", "unknown"}}},
+                     add,
+                     std::vector<TensorID>{TensorID{0}, TensorID{1}},
+                     std::vector<TensorID>{TensorID{2}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(OperationRegistryTest, SelectImplementation_NotReportedForSingleImplementation) {
+    auto parameterDummyNode = std::make_shared<ParameterDummyNode>();
+    OperationRegistry::Selection selection{"stale", "stale"};
+    OperationRegistry::getInstance().createOperation(CreationContext{device_, optimizeOption},
+                                                     parameterDummyNode,
+                                                     std::vector<TensorID>{dummyInputBufferIds},
+                                                     std::vector<TensorID>{dummyOutputBufferIds},
+                                                     &selection);
+    ASSERT_TRUE(selection.implementation.empty());
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utils/precision_convert.hpp>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+// Covers vector tails and multithreaded conversion
+constexpr std::size_t kSizes[] = {1, 7, 8, 17, 1000, (1 << 16) + 13};
+
+template <typename T>
+float toFloat(const T x) {
+    if constexpr (std::is_same_v<T, __half>) {
+        return __half2float(x);
+    } else {
+        return static_cast<float>(x);
+    }
+}
+
+/**
+ * Generates values which are exactly representable in every type of the conversion,
+ * so the result does not depend on the implementation
+ */
+template <typename SrcT>
+std::vector<SrcT> generate(const std::size_t size, const float min, const float max) {
+    std::mt19937 engine{static_cast<std::mt19937::result_type>(size)};
+    std::uniform_int_distribution<int> distribution{static_cast<int>(min), static_cast<int>(max)};
+    std::vector<SrcT> values(size);
+    for (auto& v : values) {
+        if constexpr (std::is_same_v<SrcT, __half>) {
+            v = __float2half(static_cast<float>(distribution(engine)));
+        } else {
+            v = static_cast<SrcT>(distribution(engine));
+        }
+    }
+    return values;
+}
+
+template <typename SrcT, typename DstT>
+void testConvert(const float min, const float max) {
+    for (const auto size : kSizes) {
+        const auto src = generate<SrcT>(size, min, max);
+        std::vector<DstT> expected(size);
+        std::vector<DstT> actual(size);
+        utils::convertPrecisionScalar(src.data(), expected.data(), size);
+        utils::convertPrecision(src.data(), actual.data(), size);
+        for (std::size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(toFloat(expected[i]), toFloat(actual[i])) << "size " << size << " index " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(PrecisionConvert, U8ToF16) { testConvert<std::uint8_t, __half>(0, 255); }
+
+TEST(PrecisionConvert, U8ToF32) { testConvert<std::uint8_t, float>(0, 255); }
+
+TEST(PrecisionConvert, I8ToF32) { testConvert<std::int8_t, float>(-128, 127); }
+
+TEST(PrecisionConvert, I16ToF16) { testConvert<std::int16_t, __half>(-2048, 2048); }
+
+TEST(PrecisionConvert, I16ToF32) { testConvert<std::int16_t, float>(-32768, 32767); }
+
+TEST(PrecisionConvert, F16ToU8) { testConvert<__half, std::uint8_t>(0, 255); }
+
+TEST(PrecisionConvert, F16ToI16) { testConvert<__half, std::int16_t>(-2048, 2048); }
+
+TEST(PrecisionConvert, F16ToF32) { testConvert<__half, float>(-65504, 65504); }
+
+TEST(PrecisionConvert, F32ToU8) { testConvert<float, std::uint8_t>(0, 255); }
+
+TEST(PrecisionConvert, F32ToF16) { testConvert<float, __half>(-2048, 2048); }
+
+TEST(PrecisionConvert, F32ToI32) { testConvert<float, std::int32_t>(-(1 << 24), 1 << 24); }
+
+TEST(PrecisionConvert, FractionalF32ToF16) {
+    constexpr std::size_t size = 1003;
+    std::vector<float> src(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        src[i] = static_cast<float>(i) / 7.0f - 50.0f;
+    }
+    std::vector<__half> expected(size);
+    std::vector<__half> actual(size);
+    utils::convertPrecisionScalar(src.data(), expected.data(), size);
+    utils::convertPrecision(src.data(), actual.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(__half2float(expected[i]), __half2float(actual[i])) << "index " << i;
+    }
+}
+
+namespace {
+
+/**
+ * Converts out of range values, infinities and NaN mixed with regular values
+ */
+template <typename SrcT, typename DstT>
+void testSaturation(const std::vector<float>& values, const std::vector<DstT>& saturated) {
+    for (const auto size : kSizes) {
+        std::vector<SrcT> src(size);
+        std::vector<DstT> expected(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto value = values[i % values.size()];
+            if constexpr (std::is_same_v<SrcT, __half>) {
+                src[i] = __float2half(value);
+            } else {
+                src[i] = value;
+            }
+            expected[i] = saturated[i % saturated.size()];
+        }
+        std::vector<DstT> scalar(size);
+        std::vector<DstT> actual(size);
+        utils::convertPrecisionScalar(src.data(), scalar.data(), size);
+        utils::convertPrecision(src.data(), actual.data(), size);
+        for (std::size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(expected[i], scalar[i]) << "size " << size << " index " << i;
+            ASSERT_EQ(expected[i], actual[i]) << "size " << size << " index " << i;
+        }
+    }
+}
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+}  // namespace
+
+TEST(PrecisionConvert, F32ToU8Saturates) {
+    testSaturation<float, std::uint8_t>({-1e10f, -1.f, 3.5f, 256.f, 3e9f, kInf, -kInf, kNaN},
+                                        {0, 0, 3, 255, 255, 255, 0, 0});
+}
+
+TEST(PrecisionConvert, F32ToI32Saturates) {
+    constexpr auto min = std::numeric_limits<std::int32_t>::min();
+    constexpr auto max = std::numeric_limits<std::int32_t>::max();
+    testSaturation<float, std::int32_t>({-1e10f, -2147483648.f, -3.5f, 2147483648.f, 1e10f, kInf, -kInf, kNaN},
+                                        {min, min, -3, max, max, max, min, min});
+}
+
+TEST(PrecisionConvert, F16ToU8Saturates) {
+    testSaturation<__half, std::uint8_t>({-65504.f, -1.f, 3.5f, 256.f, 65504.f, kInf, -kInf, kNaN},
+                                         {0, 0, 3, 255, 255, 255, 0, 0});
+}
+
+TEST(PrecisionConvert, F16ToI16Saturates) {
+    testSaturation<__half, std::int16_t>({-65504.f, -40000.f, -3.5f, 40000.f, 65504.f, kInf, -kInf, kNaN},
+                                         {-32768, -32768, -3, 32767, 32767, 32767, -32768, -32768});
+}
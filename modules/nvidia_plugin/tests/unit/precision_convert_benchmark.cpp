@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utils/precision_convert.hpp>
+#include <vector>
+
+namespace {
+
+using microseconds = std::chrono::duration<double, std::micro>;
+constexpr int kNumAttempts = 20;
+
+template <typename F>
+double measure(F&& convert) {
+    convert();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumAttempts; i++) {
+        convert();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return microseconds{end - start}.count() / kNumAttempts;
+}
+
+template <typename SrcT, typename DstT>
+void benchmark(const std::string& name) {
+    using namespace ov::nvidia_gpu;
+    // 224x224 and Full HD and 4K RGB images
+    for (std::size_t size : {224 * 224 * 3, 1920 * 1080 * 3, 3840 * 2160 * 3}) {
+        const std::vector<SrcT> src(size);
+        std::vector<DstT> dst(size);
+        const auto scalar = measure([&] { utils::convertPrecisionScalar(src.data(), dst.data(), size); });
+        const auto optimized = measure([&] { utils::convertPrecision(src.data(), dst.data(), size); });
+        std::cout << std::fixed << std::setprecision(3) << name << " Elements: " << size << " Scalar: " << scalar
+                  << " us Optimized: " << optimized << " us Speedup: " << scalar / optimized << "\n";
+    }
+}
+
+TEST(PrecisionConvertBenchmark, DISABLED_benchmark) {
+    benchmark<std::uint8_t, __half>("u8->f16");
+    benchmark<std::uint8_t, float>("u8->f32");
+    benchmark<float, __half>("f32->f16");
+    benchmark<__half, float>("f16->f32");
+    benchmark<float, std::uint8_t>("f32->u8");
+}
+
+}  // namespace
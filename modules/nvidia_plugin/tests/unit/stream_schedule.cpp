@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_stream_schedule.hpp>
+#include <random>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+using Accesses = StreamSchedule::StepAccesses;
+
+StreamSchedule::Access whole(StreamSchedule::Buffer buffer) { return {buffer, 0, 64}; }
+
+/**
+ * Checks that every pair of steps which use the same memory is ordered
+ */
+void expectConflictsOrdered(const std::vector<Accesses>& steps, const StreamSchedule& schedule) {
+    const auto conflict = [](const auto& first, const auto& second) {
+        return first.buffer == second.buffer && first.offset < second.offset + second.size &&
+               second.offset < first.offset + first.size;
+    };
+    for (std::size_t second = 0; second < steps.size(); ++second) {
+        for (std::size_t first = 0; first < second; ++first) {
+            bool conflicting = false;
+            for (const auto& write : steps[first].writes) {
+                for (const auto& access : steps[second].reads) conflicting |= conflict(write, access);
+                for (const auto& access : steps[second].writes) conflicting |= conflict(write, access);
+            }
+            for (const auto& read : steps[first].reads) {
+                for (const auto& access : steps[second].writes) conflicting |= conflict(read, access);
+            }
+            if (conflicting) {
+                EXPECT_TRUE(schedule.HappensBefore(first, second)) << first << " -> " << second;
+            }
+        }
+    }
+}
+
+/**
+ * Step 0 produces buffer 0, every branch reads it, produces a temporary buffer and
+ * then its output, the last step reads outputs of all branches
+ */
+std::vector<Accesses> branches(unsigned numBranches) {
+    std::vector<Accesses> steps{{{}, {whole(0)}}};
+    std::vector<StreamSchedule::Access> outputs;
+    for (unsigned branch = 0; branch < numBranches; ++branch) {
+        const StreamSchedule::Buffer temporary = 100 + branch;
+        const StreamSchedule::Buffer output = 200 + branch;
+        steps.push_back({{whole(0)}, {whole(temporary)}});
+        steps.push_back({{whole(temporary)}, {whole(output)}});
+        outputs.push_back(whole(output));
+    }
+    steps.push_back({outputs, {whole(1)}});
+    return steps;
+}
+
+}  // namespace
+
+TEST(StreamScheduleTest, ChainUsesSingleLane) {
+    const std::vector<Accesses> steps{{{}, {whole(0)}}, {{whole(0)}, {whole(1)}}, {{whole(1)}, {whole(2)}}};
+    const StreamSchedule schedule{steps, 4};
+    ASSERT_EQ(schedule.NumLanes(), 1);
+    ASSERT_EQ(schedule.NumSignals(), 0);
+    for (const auto& step : schedule.Steps()) {
+        ASSERT_EQ(step.lane, 0);
+        ASSERT_TRUE(step.waits.empty());
+    }
+    ASSERT_TRUE(schedule.HappensBefore(0, 2));
+}
+
+TEST(StreamScheduleTest, BranchesUseSeparateLanes) {
+    const auto steps = branches(3);
+    const StreamSchedule schedule{steps, 4};
+    ASSERT_EQ(schedule.NumLanes(), 3);
+    const auto& scheduled = schedule.Steps();
+    // Branches: steps 1-2, 3-4, 5-6
+    ASSERT_EQ(scheduled[1].lane, 0);
+    ASSERT_EQ(scheduled[3].lane, 1);
+    ASSERT_EQ(scheduled[5].lane, 2);
+    ASSERT_EQ(scheduled[4].lane, scheduled[3].lane);
+    ASSERT_EQ(scheduled[3].waits, (std::vector<std::size_t>{0}));
+    ASSERT_FALSE(schedule.HappensBefore(2, 3));
+    ASSERT_FALSE(schedule.HappensBefore(4, 5));
+    // The join continues the last branch and waits for the other ones
+    ASSERT_EQ(scheduled[7].lane, 2);
+    ASSERT_EQ(scheduled[7].waits, (std::vector<std::size_t>{4, 2}));
+    ASSERT_NE(scheduled[0].signal, StreamSchedule::Step::kNoSignal);
+    ASSERT_NE(scheduled[2].signal, StreamSchedule::Step::kNoSignal);
+    ASSERT_EQ(scheduled[1].signal, StreamSchedule::Step::kNoSignal);
+    ASSERT_EQ(schedule.NumSignals(), 3);
+    expectConflictsOrdered(steps, schedule);
+}
+
+TEST(StreamScheduleTest, SingleLaneIsSerial) {
+    const auto steps = branches(3);
+    const StreamSchedule schedule{steps, 1};
+    ASSERT_EQ(schedule.NumLanes(), 1);
+    ASSERT_EQ(schedule.NumSignals(), 0);
+    for (std::size_t step = 1; step < steps.size(); ++step) {
+        ASSERT_TRUE(schedule.HappensBefore(step - 1, step));
+    }
+}
+
+TEST(StreamScheduleTest, LaneLimit) {
+    const auto steps = branches(5);
+    const StreamSchedule schedule{steps, 2};
+    ASSERT_EQ(schedule.NumLanes(), 2);
+    expectConflictsOrdered(steps, schedule);
+}
+
+TEST(StreamScheduleTest, DisjointRegionsAreIndependent) {
+    // Two producers write halves of buffer 1, like inputs of an optimized concat
+    const std::vector<Accesses> steps{{{}, {whole(0)}},
+                                      {{whole(0)}, {{1, 0, 32}}},
+                                      {{whole(0)}, {{1, 32, 32}}},
+                                      {{whole(1)}, {whole(2)}}};
+    const StreamSchedule schedule{steps, 2};
+    ASSERT_FALSE(schedule.HappensBefore(1, 2));
+    ASSERT_TRUE(schedule.HappensBefore(1, 3));
+    ASSERT_TRUE(schedule.HappensBefore(2, 3));
+}
+
+TEST(StreamScheduleTest, LifespansOfConcurrentBuffersOverlap) {
+    const auto steps = branches(2);
+    // Temporaries of the branches: 100 is used by steps 1-2, 101 by steps 3-4
+    const StreamSchedule serial{steps, 1};
+    ASSERT_EQ(serial.LifespanStart(100), 1);
+    ASSERT_EQ(serial.LifespanEnd(100), 2);
+    ASSERT_EQ(serial.LifespanStart(101), 3);
+
+    const StreamSchedule concurrent{steps, 2};
+    ASSERT_EQ(concurrent.LifespanStart(100), 1);
+    ASSERT_EQ(concurrent.LifespanEnd(100), 4);
+    ASSERT_EQ(concurrent.LifespanStart(101), 3);
+    ASSERT_EQ(concurrent.LifespanEnd(101), 4);
+    // Input may still be read by the first branch until the join
+    ASSERT_EQ(serial.LifespanEnd(0), 3);
+    ASSERT_EQ(concurrent.LifespanEnd(0), 4);
+    ASSERT_FALSE(concurrent.LifespanEnd(42).has_value());
+}
+
+TEST(StreamScheduleTest, RandomGraphs) {
+    std::mt19937 random{42};
+    for (int graph = 0; graph < 50; ++graph) {
+        std::vector<Accesses> steps;
+        const int numSteps = 40;
+        for (int step = 0; step < numSteps; ++step) {
+            Accesses accesses;
+            for (int input = 0; input < step && input < 2; ++input) {
+                accesses.reads.push_back(whole(random() % step));
+            }
+            accesses.writes.push_back(whole(step));
+            steps.push_back(accesses);
+        }
+        for (std::size_t maxLanes : {1, 2, 4, 8}) {
+            const StreamSchedule schedule{steps, maxLanes};
+            ASSERT_LE(schedule.NumLanes(), maxLanes);
+            expectConflictsOrdered(steps, schedule);
+            // Buffers with disjoint lifespans are never used concurrently
+            for (unsigned first = 0; first < numSteps; ++first) {
+                for (unsigned second = 0; second < numSteps; ++second) {
+                    if (*schedule.LifespanEnd(first) >= *schedule.LifespanStart(second)) {
+                        continue;
+                    }
+                    for (std::size_t a = 0; a < steps.size(); ++a) {
+                        for (std::size_t b = 0; b < steps.size(); ++b) {
+                            const auto uses = [&](std::size_t step, unsigned buffer) {
+                                for (const auto& access : steps[step].reads) {
+                                    if (access.buffer == buffer) return true;
+                                }
+                                return steps[step].writes.front().buffer == buffer;
+                            };
+                            if (uses(a, first) && uses(b, second)) {
+                                ASSERT_TRUE(schedule.HappensBefore(a, b));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(StreamScheduleTest, LargeGraph) {
+    // Ordering is kept per lane, so graphs of this size take a few megabytes
+    std::mt19937 random{42};
+    const unsigned numSteps = 100000;
+    std::vector<Accesses> steps;
+    for (unsigned step = 0; step < numSteps; ++step) {
+        Accesses accesses;
+        for (unsigned input = 0; input < step && input < 2; ++input) {
+            accesses.reads.push_back(whole(step - 1 - random() % std::min(step, 64u)));
+        }
+        accesses.writes.push_back(whole(step));
+        steps.push_back(accesses);
+    }
+    const StreamSchedule schedule{steps, 4};
+    ASSERT_EQ(schedule.NumLanes(), 4);
+    for (unsigned buffer = 0; buffer < numSteps; ++buffer) {
+        const auto end = schedule.LifespanEnd(buffer);
+        ASSERT_TRUE(end.has_value());
+        ASSERT_GE(*end, *schedule.LifespanStart(buffer));
+        if (*end + 1 < numSteps) {
+            ASSERT_TRUE(schedule.HappensBefore(*schedule.LifespanStart(buffer), *end + 1));
+        }
+    }
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utils/strided_copy.hpp>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+/**
+ * Reference gather which computes source index of every element from scratch
+ */
+std::vector<std::uint8_t> referenceCopy(const std::vector<std::uint8_t>& src,
+                                        const BlockingDesc& desc,
+                                        const SizeVector& dims,
+                                        const std::size_t elementSize) {
+    const auto& blockDims = desc.getBlockDims();
+    const auto& order = desc.getOrder();
+    std::size_t numElements = 1;
+    for (auto d : dims) {
+        numElements *= d;
+    }
+    std::vector<std::uint8_t> dst(numElements * elementSize);
+    for (std::size_t e = 0; e < numElements; ++e) {
+        SizeVector rest(dims.size());
+        for (std::size_t axis = dims.size(), val = e; axis-- > 0;) {
+            rest[axis] = val % dims[axis];
+            val /= dims[axis];
+        }
+        std::size_t srcIdx = 0;
+        for (std::size_t i = blockDims.size(); i-- > 0;) {
+            const auto axis = order[i];
+            bool outermost = true;
+            for (std::size_t j = 0; j < i; ++j) {
+                outermost = outermost && order[j] != axis;
+            }
+            const auto coordinate = outermost ? rest[axis] : rest[axis] % blockDims[i];
+            rest[axis] = outermost ? 0 : rest[axis] / blockDims[i];
+            srcIdx += (coordinate + desc.getOffsetPaddingToData()[i]) * desc.getStrides()[i];
+        }
+        std::copy_n(&src[srcIdx * elementSize], elementSize, &dst[e * elementSize]);
+    }
+    return dst;
+}
+
+void testCopy(const BlockingDesc& desc,
+              const SizeVector& dims,
+              const std::size_t srcSize,
+              const std::size_t elementSize) {
+    std::vector<std::uint8_t> src(srcSize * elementSize);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<std::uint8_t>(i * 7 + i / 251);
+    }
+    const auto expected = referenceCopy(src, desc, dims, elementSize);
+    std::vector<std::uint8_t> actual(expected.size());
+    utils::copyToDense(src.data(), actual.data(), desc, dims, elementSize);
+    ASSERT_EQ(expected, actual);
+}
+
+}  // namespace
+
+TEST(StridedCopy, IsDenseDesc) {
+    ASSERT_TRUE(utils::isDenseDesc(BlockingDesc{{1, 3, 4, 5}, {0, 1, 2, 3}}, {1, 3, 4, 5}));
+    ASSERT_FALSE(utils::isDenseDesc(BlockingDesc{{1, 4, 5, 3}, {0, 2, 3, 1}}, {1, 3, 4, 5}));
+    ASSERT_FALSE(utils::isDenseDesc(BlockingDesc{{1, 3, 4, 5}, {0, 1, 2, 3}, 0, {0, 0, 1, 0}, {120, 40, 10, 1}},
+                                    {1, 3, 4, 5}));
+}
+
+TEST(StridedCopy, Roi) {
+    // 1x3x50x60 crop at (10, 20) of 1x3x100x200 frame
+    testCopy(BlockingDesc{{1, 3, 50, 60}, {0, 1, 2, 3}, 0, {0, 0, 10, 20}, {60000, 20000, 200, 1}},
+             {1, 3, 50, 60},
+             60000,
+             1);
+}
+
+TEST(StridedCopy, LargeRoi) {
+    testCopy(BlockingDesc{{1, 3, 500, 600}, {0, 1, 2, 3}, 0, {0, 0, 100, 200}, {3000000, 1000000, 1000, 1}},
+             {1, 3, 500, 600},
+             3000000,
+             1);
+}
+
+TEST(StridedCopy, FullWidthRoi) {
+    testCopy(BlockingDesc{{1, 3, 50, 200}, {0, 1, 2, 3}, 0, {0, 0, 10, 0}, {60000, 20000, 200, 1}},
+             {1, 3, 50, 200},
+             60000,
+             4);
+}
+
+TEST(StridedCopy, MixedAxesOrderRoi) {
+    // NHWC 1x100x200x3 frame, crop of height 50 and width 60 at (10, 20)
+    testCopy(BlockingDesc{{1, 50, 60, 3}, {0, 2, 3, 1}, 0, {0, 10, 20, 0}, {60000, 600, 3, 1}},
+             {1, 3, 50, 60},
+             60000,
+             2);
+}
+
+TEST(StridedCopy, BlockedLayout) {
+    // nChw8c with 13 channels padded to 16
+    testCopy(BlockingDesc{{1, 2, 4, 5, 8}, {0, 1, 2, 3, 1}, 0, {0, 0, 0, 0, 0}, {320, 160, 40, 8, 1}},
+             {1, 13, 4, 5},
+             320,
+             4);
+}
+
+TEST(StridedCopy, StridedInnermostAxis) {
+    testCopy(BlockingDesc{{4, 5}, {0, 1}, 0, {1, 1}, {20, 2}}, {3, 4}, 100, 3);
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cuda_task_queue.hpp>
+#include <cuda_unique_task.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+TEST(CudaUniqueTaskTest, Empty) {
+    CudaUniqueTask task;
+    ASSERT_FALSE(task);
+}
+
+TEST(CudaUniqueTaskTest, MoveOnlyCallable) {
+    auto value = std::make_unique<int>(0);
+    auto* valuePtr = value.get();
+    CudaUniqueTask task{[value = std::move(value)] { ++*value; }};
+    ASSERT_TRUE(task);
+    CudaUniqueTask moved{std::move(task)};
+    ASSERT_FALSE(task);
+    moved();
+    ASSERT_EQ(*valuePtr, 1);
+}
+
+TEST(CudaUniqueTaskTest, LargeCallable) {
+    auto counter = std::make_shared<int>(0);
+    std::array<char, 2 * CudaUniqueTask::kBufferSize> payload{};
+    CudaUniqueTask task{[counter, payload] { *counter += payload.size(); }};
+    CudaUniqueTask other;
+    other = std::move(task);
+    other();
+    ASSERT_EQ(*counter, payload.size());
+    ASSERT_EQ(counter.use_count(), 2);
+    other.reset();
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(CudaUniqueTaskTest, DestroysInlineCallable) {
+    auto counter = std::make_shared<int>(0);
+    {
+        CudaUniqueTask task{[counter] {}};
+        ASSERT_EQ(counter.use_count(), 2);
+    }
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(CudaTaskQueueTest, Fifo) {
+    CudaTaskQueue queue{4};
+    std::vector<int> order;
+    for (int i = 0; i < 4; ++i) {
+        CudaUniqueTask task{[&order, i] { order.push_back(i); }};
+        ASSERT_TRUE(queue.TryPush(task));
+        ASSERT_FALSE(task);
+    }
+    CudaUniqueTask task{[] {}};
+    ASSERT_FALSE(queue.TryPush(task));
+    ASSERT_TRUE(task);
+
+    CudaUniqueTask popped;
+    while (queue.TryPop(popped)) {
+        popped();
+    }
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+    ASSERT_TRUE(queue.TryPush(task));
+}
+
+TEST(CudaTaskQueueTest, MultipleProducersAndConsumers) {
+    constexpr int kNumThreads = 4;
+    constexpr int kTasksPerProducer = 100000;
+    CudaTaskQueue queue{64};
+    std::atomic<long long> sum{0};
+    std::atomic<int> executed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kNumThreads; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= kTasksPerProducer; ++i) {
+                CudaUniqueTask task{[&sum, i] { sum += i; }};
+                while (!queue.TryPush(task)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < kNumThreads; ++c) {
+        threads.emplace_back([&] {
+            CudaUniqueTask task;
+            while (executed < kNumThreads * kTasksPerProducer) {
+                if (queue.TryPop(task)) {
+                    task();
+                    ++executed;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(sum, static_cast<long long>(kNumThreads) * kTasksPerProducer * (kTasksPerProducer + 1) / 2);
+}
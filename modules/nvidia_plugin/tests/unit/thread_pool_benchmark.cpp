@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cuda_thread_pool.hpp>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using microseconds = std::chrono::duration<double, std::micro>;
+constexpr unsigned kNumPoolThreads = 4;
+constexpr int kTasksPerSubmitter = 20000;
+
+/**
+ * Thread pool with a single mutex protected queue, which CudaThreadPool used before
+ */
+class MutexThreadPool {
+public:
+    explicit MutexThreadPool(unsigned numThreads) {
+        for (unsigned i = 0; i < numThreads; ++i) {
+            threads_.emplace_back([this] {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mtx_);
+                        cond_var_.wait(lock, [&] { return !queue_.empty() || is_stopped_; });
+                        if (is_stopped_) {
+                            break;
+                        }
+                        task = std::move(queue_.front());
+                        queue_.pop_front();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~MutexThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            is_stopped_ = true;
+        }
+        cond_var_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void run(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            queue_.push_back(task);
+        }
+        cond_var_.notify_one();
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cond_var_;
+    std::deque<std::function<void()>> queue_;
+    bool is_stopped_ = false;
+    std::vector<std::thread> threads_;
+};
+
+/**
+ * Every submitter posts tiny tasks like infer requests of a tiny model do, which
+ * are executed asynchronously, and waits until all of them are done
+ */
+template <typename Pool>
+double measure(Pool& pool, unsigned numSubmitters) {
+    std::atomic<int> done{0};
+    const int total = numSubmitters * kTasksPerSubmitter;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> submitters;
+    for (unsigned s = 0; s < numSubmitters; ++s) {
+        submitters.emplace_back([&] {
+            for (int i = 0; i < kTasksPerSubmitter; ++i) {
+                pool.run([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+    while (done.load() < total) {
+        std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return microseconds{end - start}.count() / total;
+}
+
+TEST(CudaThreadPoolBenchmark, DISABLED_benchmark) {
+    for (unsigned numSubmitters : {1u, 4u, 16u, 64u}) {
+        MutexThreadPool mutexPool{kNumPoolThreads};
+        const auto mutexTime = measure(mutexPool, numSubmitters);
+        ov::nvidia_gpu::CudaThreadPool cudaPool{CUDA::Device{}, kNumPoolThreads};
+        const auto cudaTime = measure(cudaPool, numSubmitters);
+        std::cout << std::fixed << std::setprecision(3) << "Submitters: " << numSubmitters
+                  << " Mutex pool: " << mutexTime << " us/task CudaThreadPool: " << cudaTime
+                  << " us/task Speedup: " << mutexTime / cudaTime << "\n";
+    }
+}
+
+}  // namespace
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cuda_trace_writer.hpp>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace ov::nvidia_gpu;
+
+class TraceWriterTest : public testing::Test {
+    void SetUp() override { std::remove(path_.c_str()); }
+
+    void TearDown() override { std::remove(path_.c_str()); }
+
+public:
+    std::string ReadTrace() const {
+        std::ifstream file{path_};
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static std::size_t Count(const std::string& text, const std::string& pattern) {
+        std::size_t count = 0;
+        for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    const std::string path_ = testing::TempDir() + "nvidia_trace_writer_test.json";
+};
+
+TEST_F(TraceWriterTest, Empty) {
+    { TraceWriter writer{path_}; }
+    ASSERT_EQ(ReadTrace(), "[\n]\n");
+}
+
+TEST_F(TraceWriterTest, HostAndDeviceSpans) {
+    {
+        TraceWriter writer{path_};
+        const auto start = TraceWriter::Time::now();
+        writer.WriteHostSpan("Preprocess", "stage", start, start + std::chrono::microseconds{10}, "Req0");
+        writer.WriteDeviceSpan("Convolution_1", "op", start, TraceWriter::Duration{2.5}, "Req0");
+        writer.WriteDeviceSpan("Convolution_1", "op", start, TraceWriter::Duration{2.5}, "Req1");
+    }
+    const auto trace = ReadTrace();
+    ASSERT_EQ(trace.front(), '[');
+    ASSERT_EQ(trace.substr(trace.size() - 3), "\n]\n");
+    ASSERT_EQ(Count(trace, R"("ph":"X")"), 3u);
+    // One lane of the calling thread and one per infer request on device
+    ASSERT_EQ(Count(trace, R"("name":"thread_name")"), 3u);
+    ASSERT_EQ(Count(trace, R"("name":"Req0 device")"), 1u);
+    ASSERT_EQ(Count(trace, R"("dur":10.000)"), 1u);
+    ASSERT_EQ(Count(trace, R"("args":{"request":"Req1"})"), 1u);
+}
+
+TEST_F(TraceWriterTest, EscapesNames) {
+    {
+        TraceWriter writer{path_};
+        const auto start = TraceWriter::Time::now();
+        writer.WriteHostSpan("a\"b\\c", "stage", start, start, "Req0");
+    }
+    ASSERT_EQ(Count(ReadTrace(), R"("name":"a\"b\\c")"), 1u);
+}
+
+TEST_F(TraceWriterTest, LanePerThread) {
+    {
+        TraceWriter writer{path_};
+        const auto start = TraceWriter::Time::now();
+        writer.WriteHostSpan("Preprocess", "stage", start, start, "Req0");
+        std::thread{[&] { writer.WriteHostSpan("WaitPipeline", "stage", start, start, "Req0"); }}.join();
+    }
+    const auto trace = ReadTrace();
+    ASSERT_EQ(Count(trace, R"("name":"Host thread 0")"), 1u);
+    ASSERT_EQ(Count(trace, R"("name":"Host thread 1")"), 1u);
+}
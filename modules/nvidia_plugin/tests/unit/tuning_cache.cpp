@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cuda_tuning_cache.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <string>
+#include <vector>
+
+using namespace ov::nvidia_gpu;
+
+class TuningCacheTest : public testing::Test {
+    void SetUp() override { std::remove(path_.c_str()); }
+
+    void TearDown() override { std::remove(path_.c_str()); }
+
+public:
+    const std::string path_ = testing::TempDir() + "nvidia_tuning_cache_test.txt";
+};
+
+TEST_F(TuningCacheTest, Disabled) {
+    const TuningCache cache{""};
+    ASSERT_FALSE(cache.Enabled());
+    cache.Set("key", 4);
+    ASSERT_FALSE(cache.Get("key").has_value());
+}
+
+TEST_F(TuningCacheTest, MissingFile) {
+    const TuningCache cache{path_};
+    ASSERT_TRUE(cache.Enabled());
+    ASSERT_FALSE(cache.Get("key").has_value());
+}
+
+TEST_F(TuningCacheTest, SetAndGet) {
+    {
+        const TuningCache cache{path_};
+        cache.Set("first", 4);
+        cache.Set("second", 2);
+        cache.Set("first", 3);
+    }
+    const TuningCache cache{path_};
+    ASSERT_EQ(cache.Get("first"), 3u);
+    ASSERT_EQ(cache.Get("second"), 2u);
+    ASSERT_FALSE(cache.Get("third").has_value());
+}
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeNetwork(float bias, const std::string& name = "Add") {
+    using namespace ngraph::opset1;
+    auto parameter = std::make_shared<Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    auto constant = Constant::create(ngraph::element::f32, ngraph::Shape{1, 8}, std::vector<float>(8, bias));
+    auto add = std::make_shared<Add>(parameter, constant);
+    add->set_friendly_name(name);
+    auto relu = std::make_shared<Relu>(add);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{parameter});
+}
+
+}  // namespace
+
+TEST(TuningCacheKey, SameNetworkSameDigest) {
+    ASSERT_EQ(TuningCache::NetworkDigest(*makeNetwork(1.f)), TuningCache::NetworkDigest(*makeNetwork(1.f)));
+}
+
+TEST(TuningCacheKey, NamesAreNotDigested) {
+    ASSERT_EQ(TuningCache::NetworkDigest(*makeNetwork(1.f, "first")),
+              TuningCache::NetworkDigest(*makeNetwork(1.f, "second")));
+}
+
+TEST(TuningCacheKey, ConstantsAreDigested) {
+    ASSERT_NE(TuningCache::NetworkDigest(*makeNetwork(1.f)), TuningCache::NetworkDigest(*makeNetwork(2.f)));
+}
+
+TEST(TuningCacheKey, AttributesAreDigested) {
+    using namespace ngraph::opset1;
+    auto makeClamp = [](double max) {
+        auto parameter = std::make_shared<Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+        auto clamp = std::make_shared<Clamp>(parameter, 0., max);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{clamp}, ngraph::ParameterVector{parameter});
+    };
+    ASSERT_NE(TuningCache::NetworkDigest(*makeClamp(1.)), TuningCache::NetworkDigest(*makeClamp(6.)));
+}